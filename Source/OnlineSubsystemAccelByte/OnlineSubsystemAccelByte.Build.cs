@@ -51,6 +51,15 @@ public class OnlineSubsystemAccelByte : ModuleRules
 		bool bEnableV2Sessions = false;
 		GetBoolFromEngineConfig("OnlineSubsystemAccelByte", "bEnableV2Sessions", out bEnableV2Sessions);
 		PublicDefinitions.Add(string.Format("AB_USE_V2_SESSIONS={0}", bEnableV2Sessions ? 1 : 0));
+
+		// Insights trace events are compiled in for everything but shipping builds, unless the config says otherwise
+		bool bEnableInsightsTrace = Target.Configuration != UnrealTargetConfiguration.Shipping;
+		bool bConfigEnableInsightsTrace = false;
+		if (GetBoolFromEngineConfig("OnlineSubsystemAccelByte", "bEnableInsightsTrace", out bConfigEnableInsightsTrace))
+		{
+			bEnableInsightsTrace = bConfigEnableInsightsTrace;
+		}
+		PrivateDefinitions.Add(string.Format("AB_OSS_TRACE_ENABLED={0}", bEnableInsightsTrace ? 1 : 0));
     }
 
 	private bool GetBoolFromEngineConfig(string Section, string Key, out bool Value)
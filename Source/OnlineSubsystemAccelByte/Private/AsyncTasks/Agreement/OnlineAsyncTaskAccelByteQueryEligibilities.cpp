@@ -108,4 +108,18 @@ void FOnlineAsyncTaskAccelByteQueryEligibilities::OnQueryEligibilitiesError(int3
 	ErrorStr = TEXT("request-failed-query-eligibilities-error");
 	UE_LOG_AB(Warning, TEXT("Failed to query user's eligible agreements! Error Code: %d; Error Message: %s"), ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
-}
\ No newline at end of file
+}
+
+void FOnlineAsyncTaskAccelByteQueryEligibilities::AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary)
+{
+	Super::AdoptResultsFrom(Primary);
+	const FOnlineAsyncTaskAccelByteQueryEligibilities& PrimaryTask = static_cast<const FOnlineAsyncTaskAccelByteQueryEligibilities&>(Primary);
+	Eligibilities = PrimaryTask.Eligibilities;
+	ErrorStr = PrimaryTask.ErrorStr;
+}
+
+FString FOnlineAsyncTaskAccelByteQueryEligibilities::GetDeduplicationArguments() const
+{
+	// bNotAcceptedOnly is left out, as it only filters the results as they are reported in TriggerDelegates
+	return FString::Printf(TEXT("%s|%s"), *UserId->GetAccelByteId(), LOG_BOOL_FORMAT(bAlwaysRequestToService));
+}
@@ -21,6 +21,7 @@ public:
 
 	virtual void Initialize() override;
 	virtual void TriggerDelegates() override;
+	virtual void AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary) override;
 
 protected:
 
@@ -29,6 +30,8 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteQueryEligibilities");
 	}
 
+	virtual FString GetDeduplicationArguments() const override;
+
 private:
 
 	/**
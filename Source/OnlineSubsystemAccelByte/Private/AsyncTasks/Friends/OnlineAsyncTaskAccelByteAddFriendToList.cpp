@@ -75,7 +75,7 @@ void FOnlineAsyncTaskAccelByteAddFriendToList::TriggerDelegates()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteAddFriendToList::OnQueryFriendComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried)
+void FOnlineAsyncTaskAccelByteAddFriendToList::OnQueryFriendComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds)
 {
 	if (bIsSuccessful && UsersQueried.IsValidIndex(0))
 	{
@@ -152,7 +152,7 @@ void FOnlineAsyncTaskAccelByteBlockPlayer::OnBlockPlayerResponse(const FAccelByt
 	}
 }
 
-void FOnlineAsyncTaskAccelByteBlockPlayer::OnQueryBlockedPlayerComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried)
+void FOnlineAsyncTaskAccelByteBlockPlayer::OnQueryBlockedPlayerComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds)
 {
 	if (bIsSuccessful && UsersQueried.IsValidIndex(0))
 	{
@@ -45,6 +45,6 @@ private:
 	void OnBlockPlayerResponse(const FAccelByteModelsBlockPlayerResponse& Result);
 
 	/** Delegate handler for when we complete a query for information about the newly blocked player */
-	void OnQueryBlockedPlayerComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried);
+	void OnQueryBlockedPlayerComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds);
 
 };
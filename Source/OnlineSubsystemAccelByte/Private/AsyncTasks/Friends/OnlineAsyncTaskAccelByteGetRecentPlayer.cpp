@@ -16,6 +16,7 @@ FOnlineAsyncTaskAccelByteGetRecentPlayer::FOnlineAsyncTaskAccelByteGetRecentPlay
 	, Namespace(InNamespace)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InUserId.AsShared());
+	Priority = EAccelByteAsyncTaskPriority::Low;
 }
 
 void FOnlineAsyncTaskAccelByteGetRecentPlayer::Initialize()
@@ -90,7 +91,7 @@ void FOnlineAsyncTaskAccelByteGetRecentPlayer::OnGetRecentPlayerError(int32 Erro
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 }
 
-void FOnlineAsyncTaskAccelByteGetRecentPlayer::OnQueryRecentPlayersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried)
+void FOnlineAsyncTaskAccelByteGetRecentPlayer::OnQueryRecentPlayersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds)
 {
 	if (bIsSuccessful)
 	{
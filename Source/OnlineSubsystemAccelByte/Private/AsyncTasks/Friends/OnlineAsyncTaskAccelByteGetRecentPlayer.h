@@ -46,6 +46,6 @@ private:
 	void OnGetRecentPlayerError(int32 ErrorCode, const FString& ErrorMessage);
 
 	/** Delegate handler for when we finish querying for recent player information */
-	void OnQueryRecentPlayersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried);
+	void OnQueryRecentPlayersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds);
 
 };
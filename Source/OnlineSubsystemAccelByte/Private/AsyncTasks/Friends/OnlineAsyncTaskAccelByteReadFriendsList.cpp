@@ -122,6 +122,7 @@ void FOnlineAsyncTaskAccelByteReadFriendsList::OnLoadFriendsListResponse(const F
 	// Add all friend IDs to an array to query at the end
 	FriendIdsToQuery.Append(Result.friendsId);
 	bHasReceivedResponseForCurrentFriends = true;
+	RequestTick();
 }
 
 void FOnlineAsyncTaskAccelByteReadFriendsList::OnListIncomingFriendsResponse(const FAccelByteModelsListIncomingFriendsResponse& Result)
@@ -143,6 +144,7 @@ void FOnlineAsyncTaskAccelByteReadFriendsList::OnListIncomingFriendsResponse(con
 	// Add all friend IDs to an array to query at the end
 	FriendIdsToQuery.Append(Result.friendsId);
 	bHasReceivedResponseForIncomingFriends = true;
+	RequestTick();
 }
 
 void FOnlineAsyncTaskAccelByteReadFriendsList::OnListOutgoingFriendsResponse(const FAccelByteModelsListOutgoingFriendsResponse& Result)
@@ -164,9 +166,10 @@ void FOnlineAsyncTaskAccelByteReadFriendsList::OnListOutgoingFriendsResponse(con
 	// Add all friend IDs to an array to query at the end
 	FriendIdsToQuery.Append(Result.friendsId);
 	bHasReceivedResponseForOutgoingFriends = true;
+	RequestTick();
 }
 
-void FOnlineAsyncTaskAccelByteReadFriendsList::OnQueryFriendInformationComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried)
+void FOnlineAsyncTaskAccelByteReadFriendsList::OnQueryFriendInformationComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds)
 {
 	SetLastUpdateTimeToCurrentTime();
 	if (bIsSuccessful)
@@ -191,4 +194,5 @@ void FOnlineAsyncTaskAccelByteReadFriendsList::OnQueryFriendInformationComplete(
 	}
 
 	bHasRecievedAllFriendInformation = true;
+	RequestTick();
 }
@@ -81,7 +81,7 @@ private:
 	void OnListOutgoingFriendsResponse(const FAccelByteModelsListOutgoingFriendsResponse& Result);
 
 	/** Delegate handler for when we successfully get all information for each user in our friends list */
-	void OnQueryFriendInformationComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried);
+	void OnQueryFriendInformationComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds);
 
 };
 
@@ -71,7 +71,7 @@ private:
 	void QueryInvitedFriend(const FString& FriendId);
 
 	/** Delegate handler for when we complete a query for joined party member information */
-	void OnQueryInvitedFriendComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried);
+	void OnQueryInvitedFriendComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds);
 
 	/** Delegate handler for when the request to send a friend invite completes */
 	void OnRequestFriendResponse(const FAccelByteModelsRequestFriendsResponse& Result);
@@ -6,14 +6,25 @@
 #include "OnlineAsyncTaskManager.h"
 #include "OnlineSubsystemAccelByteModule.h"
 #include "OnlineSubsystemAccelByteInternalHelpers.h"
+#include "OnlineSubsystemAccelByteTrace.h"
+#include "OnlineAsyncTaskPoolAccelByte.h"
 #include <Core/AccelByteMultiRegistry.h>
 #include <OnlineSubsystemAccelByteTypes.h>
 #include <OnlineIdentityInterfaceAccelByte.h>
 #include <OnlineSubsystemAccelByte.h>
-
-#define AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s::%s (AsyncTask method) was called. Args: ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__)
+#include <OnlineAsyncTaskMetricsAccelByte.h>
+#include <OnlineBackendAccelByte.h>
+#include <atomic>
+
+#define AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) do { \
+	AB_OSS_TRACE_BUFFER_RECORD(Begin, Format, ##__VA_ARGS__); \
+	AB_OSS_LOG_IF_ACTIVE(Verbosity, TEXT(">>> %s::%s (AsyncTask method) was called. Args: ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__) \
+} while (0)
 #define AB_OSS_ASYNC_TASK_TRACE_BEGIN(Format, ...) AB_OSS_ASYNC_TASK_TRACE_BEGIN_VERBOSITY(Verbose, Format, ##__VA_ARGS__)
-#define AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s::%s (AsyncTask method) has finished execution. ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbosity, Format, ...) do { \
+	AB_OSS_TRACE_BUFFER_RECORD(End, Format, ##__VA_ARGS__); \
+	AB_OSS_LOG_IF_ACTIVE(Verbosity, TEXT("<<< %s::%s (AsyncTask method) has finished execution. ") Format, *GetTaskName(), *FString(__func__), ##__VA_ARGS__) \
+} while (0)
 #define AB_OSS_ASYNC_TASK_TRACE_END(Format, ...) AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Verbose, Format, ##__VA_ARGS__)
 
 /**
@@ -40,13 +51,26 @@
  * On{Verb}SuccessDelegate, and be bound to the On{Verb}Success method of the class. Error delegate will have
  * the name On{Verb}ErrorDelegate, and be bound to the On{Verb}Error method of the class.
  * 
+ * Both delegates go through the task's cancellation token, so they are safely dropped if they fire after the task has
+ * completed or been destroyed. Each handler is also wrapped in a trace scope named after the handler.
+ * 
  * @param AsyncTaskClass Name of the class that we are binding delegate methods to
  * @param Verb Name of the action that is being handled by the two delegates, effects the name of the final delegates
  * @param SuccessType Delegate type for the success delegate
  */
 #define AB_ASYNC_TASK_DEFINE_SDK_DELEGATES(AsyncTaskClass, Verb, SuccessType) \
-	const SuccessType On##Verb##SuccessDelegate = SuccessType::CreateRaw(this, &AsyncTaskClass::On##Verb##Success); \
-	const FErrorHandler On##Verb##ErrorDelegate = FErrorHandler::CreateRaw(this, &AsyncTaskClass::On##Verb##Error);
+	const SuccessType On##Verb##SuccessDelegate = SuccessType::CreateLambda([this, Token = CancellationToken](auto&&... Args) { \
+		Token->Invoke([&]() { \
+			AB_OSS_TRACE_SCOPE(#AsyncTaskClass "::On" #Verb "Success"); \
+			this->On##Verb##Success(Forward<decltype(Args)>(Args)...); \
+		}); \
+	}); \
+	const FErrorHandler On##Verb##ErrorDelegate = FErrorHandler::CreateLambda([this, Token = CancellationToken](int32 ErrorCode, const FString& ErrorMessage) { \
+		Token->Invoke([&]() { \
+			AB_OSS_TRACE_SCOPE(#AsyncTaskClass "::On" #Verb "Error"); \
+			this->On##Verb##Error(ErrorCode, ErrorMessage); \
+		}); \
+	});
 
 /**
  * Convenience macro for async tasks to ensure that a expression evaluates to true, otherwise throwing an InvalidState error in the task.
@@ -122,6 +146,103 @@ enum class EAccelByteAsyncTaskFlags : uint8
 
 #define ASYNC_TASK_FLAG_BIT(Flag) static_cast<uint8>(Flag)
 
+/**
+ * Lets SDK callbacks, and anything else that may outlive an async task, ask for that task to be ticked. Shared between
+ * the task and whoever holds it, so that a late callback never touches a task that has already been destroyed.
+ */
+class FOnlineAsyncTaskAccelByteWakeHandle
+{
+public:
+
+	explicit FOnlineAsyncTaskAccelByteWakeHandle(const FOnlineAsyncTaskManagerAccelBytePtr& InTaskManager)
+		: TaskManager(InTaskManager)
+	{
+	}
+
+	/**
+	 * Flag the task as needing a tick, and wake the online thread to give it one
+	 */
+	void RequestTick()
+	{
+		bIsTickRequested.store(true, std::memory_order_release);
+
+		const FOnlineAsyncTaskManagerAccelBytePtr PinnedTaskManager = TaskManager.Pin();
+		if (PinnedTaskManager.IsValid())
+		{
+			PinnedTaskManager->WakeOnlineThread();
+		}
+	}
+
+	/**
+	 * Clear the tick request flag, returning whether a tick had been requested since the last call
+	 */
+	bool TakeTickRequest()
+	{
+		return bIsTickRequested.exchange(false, std::memory_order_acq_rel);
+	}
+
+private:
+
+	/** Manager ticking the task, woken whenever a tick is requested */
+	TWeakPtr<FOnlineAsyncTaskManagerAccelByte, ESPMode::ThreadSafe> TaskManager;
+
+	/** Whether a tick has been requested since the task was last ticked */
+	std::atomic<bool> bIsTickRequested{false};
+
+};
+
+/**
+ * Detaches SDK callbacks from an async task. The SDK cannot cancel a request once sent, so instead every callback bound
+ * through the token checks it before touching the task, and the task cancels the token once it no longer wants any
+ * responses, which is when it completes or is destroyed.
+ * 
+ * Callbacks run while holding the token's lock, so cancelling blocks until any callback already running has finished.
+ * This makes it safe to destroy the task straight after cancelling, whichever thread the SDK fires callbacks from.
+ */
+class FOnlineAsyncTaskAccelByteCancellationToken
+{
+public:
+
+	/**
+	 * Stop any further callbacks from running, waiting for one that is running on another thread to finish
+	 */
+	void Cancel()
+	{
+		FScopeLock ScopeLock(&InvokeLock);
+		bIsCancelled.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * Whether the token has been cancelled, callbacks should be dropped if so
+	 */
+	bool IsCancelled() const
+	{
+		return bIsCancelled.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * Run the callback passed in, unless the token has been cancelled
+	 */
+	template <typename FunctorType>
+	void Invoke(FunctorType&& Functor)
+	{
+		FScopeLock ScopeLock(&InvokeLock);
+		if (!bIsCancelled.load(std::memory_order_acquire))
+		{
+			Functor();
+		}
+	}
+
+private:
+
+	/** Held while running a callback and while cancelling */
+	FCriticalSection InvokeLock;
+
+	/** Whether the token has been cancelled */
+	std::atomic<bool> bIsCancelled{false};
+
+};
+
 /**
  * Base class for any async tasks created by the AccelByte OSS.
  * 
@@ -158,6 +279,7 @@ public:
 	explicit FOnlineAsyncTaskAccelByte(FOnlineSubsystemAccelByte* const InABSubsystem, uint8 InFlags)
 		: FOnlineAsyncTaskBasic(InABSubsystem)
 		, Flags(InFlags)
+		, WakeHandle(MakeShared<FOnlineAsyncTaskAccelByteWakeHandle, ESPMode::ThreadSafe>((InABSubsystem != nullptr) ? InABSubsystem->GetAsyncTaskManager() : nullptr))
 	{
 		bShouldUseTimeout = HasFlag(EAccelByteAsyncTaskFlags::UseTimeout);
 
@@ -165,9 +287,34 @@ public:
 		// that are supposed to run with these requests, if a timeout is quicker than a request could be received from the backend
 		// we may get a crash from that. To combat this for now, we want to set our default timeout to always be one second higher
 		// than the SDK HTTP timeout to give the SDK a chance to fire off its delegates for a timeout.
-		// Fix this once https://accelbyte.atlassian.net/browse/OSS-193 is implemented.
+		// Tasks that bind every SDK delegate through their cancellation token (see MakeCancellable) are safe from this, and
+		// can use SetTaskTimeout to time out sooner.
 		TaskTimeoutInSeconds = static_cast<double>(AccelByte::FHttpRetryScheduler::TotalTimeout) + 1.0;
+
+		QueuedTimeInSeconds = FPlatformTime::Seconds();
+	}
+
+	virtual ~FOnlineAsyncTaskAccelByte()
+	{
+		// The manager cancels before it starts tearing the task down, this is just a safety net for anything else
+		CancellationToken->Cancel();
+	}
+
+#if AB_OSS_ASYNC_TASK_POOL_ENABLED
+	/**
+	 * Allocate every task from the async task pool (see FOnlineAsyncTaskPoolAccelByte). The destructor being virtual means
+	 * delete passes the size of the most derived task, which is what lets the pool find the right size class again.
+	 */
+	static void* operator new(size_t Size)
+	{
+		return FOnlineAsyncTaskPoolAccelByte::Get().Allocate(Size);
+	}
+
+	static void operator delete(void* Ptr, size_t Size)
+	{
+		FOnlineAsyncTaskPoolAccelByte::Get().Free(Ptr, Size);
 	}
+#endif
 
 	/**
 	 * Simple tick override to check if we are using timeouts, and if so check the task timeout and complete the task unsuccessfully if it's over its timeout
@@ -183,6 +330,10 @@ public:
 		// If we are not currently in the working state, then kick off the work we need to do for the task
 		if (CurrentState != EAccelByteAsyncTaskState::Working)
 		{
+			// Serial tasks are initialized by the base manager right before their first tick, so that is when they sent
+			// their first request. Parallel tasks have already had this marked by our manager.
+			MarkRequestSent();
+
 			CurrentState = EAccelByteAsyncTaskState::Working;
 			OnTaskStartWorking();
 		}
@@ -195,6 +346,7 @@ public:
 	virtual void Initialize() override
 	{
 		CurrentState = EAccelByteAsyncTaskState::Initializing;
+		InitializedTimeInSeconds = FPlatformTime::Seconds();
 
 		// We only care about setting the last update time if we are using a timeout
 		if (bShouldUseTimeout)
@@ -220,6 +372,143 @@ public:
 		}
 	}
 
+	/**
+	 * Whether the task manager needs to tick this task right now. Tasks are only ticked to start working, when they have
+	 * asked for a tick through RequestTick, when their timeout is due, or when they have been idle for longer than the
+	 * given interval as a safety net. Completed tasks are never ticked, the manager just hands them to the game thread.
+	 * Only called from the online thread.
+	 */
+	bool ShouldTick(double CurrentTimeInSeconds, double IdleTickIntervalSeconds)
+	{
+		const bool bWasTickRequested = WakeHandle->TakeTickRequest();
+		if (bIsComplete)
+		{
+			return false;
+		}
+
+		const bool bShouldTick = bWasTickRequested
+			|| CurrentState != EAccelByteAsyncTaskState::Working
+			|| CurrentTimeInSeconds >= GetNextTickTimeInSeconds(IdleTickIntervalSeconds);
+
+		if (bShouldTick)
+		{
+			LastTickTimeInSeconds = CurrentTimeInSeconds;
+		}
+		return bShouldTick;
+	}
+
+	/**
+	 * Time in seconds by which this task will need a tick without being asked for one, either to check its timeout or as
+	 * an idle safety net. Only called from the online thread.
+	 */
+	double GetNextTickTimeInSeconds(double IdleTickIntervalSeconds) const
+	{
+		double NextTickTimeInSeconds = LastTickTimeInSeconds + IdleTickIntervalSeconds;
+		if (bShouldUseTimeout)
+		{
+			NextTickTimeInSeconds = FMath::Min(NextTickTimeInSeconds, LastTaskUpdateInSeconds.load(std::memory_order_relaxed) + TaskTimeoutInSeconds);
+		}
+		return NextTickTimeInSeconds;
+	}
+
+	/**
+	 * Key used to order this task against other parallel tasks when the task manager ticks them from a worker pool. Tasks
+	 * sharing a key are never ticked at the same time, and tick in the order that they were dispatched. By default tasks
+	 * are not ordered at all, returning INVALID_CONTROLLERID.
+	 *
+	 * Override to return LocalUserNum only for a task that must not tick alongside or ahead of other ordered tasks for the
+	 * same user, such as logging in or changing party and session membership. Every task ordered this way is ticked in
+	 * series with the others for its user, so keep the set small.
+	 */
+	virtual int32 GetOrderingKey() const
+	{
+		return INVALID_CONTROLLERID;
+	}
+
+	/**
+	 * Priority class that the task manager schedules this task in when dispatched in parallel
+	 */
+	EAccelByteAsyncTaskPriority GetPriority() const
+	{
+		return Priority;
+	}
+
+	/**
+	 * Override the priority class of this task, only has an effect if called before the task is dispatched. Prefer
+	 * passing the priority to CreateAndDispatchAsyncTaskParallel over calling this directly.
+	 */
+	void SetPriority(EAccelByteAsyncTaskPriority InPriority)
+	{
+		Priority = InPriority;
+	}
+
+	/**
+	 * Key identifying tasks that would make the same request as this one, or empty if this task is never merged with
+	 * another. See GetDeduplicationArguments.
+	 */
+	FString GetDeduplicationKey() const
+	{
+		const FString Arguments = GetDeduplicationArguments();
+		return Arguments.IsEmpty() ? FString() : FString::Printf(TEXT("%s|%s"), *GetTaskName(), *Arguments);
+	}
+
+	/**
+	 * Take on the results of the identical task that this task was merged into, so that TriggerDelegates reports them to
+	 * this task's own caller. Called from the game thread after the other task has triggered its delegates, and only
+	 * ever with a task of the same type. Tasks that opt into deduplication override this to copy whatever their
+	 * TriggerDelegates reads, calling the super method first.
+	 */
+	virtual void AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary)
+	{
+		bWasSuccessful = Primary.bWasSuccessful;
+		CompleteState = Primary.CompleteState;
+	}
+
+	/**
+	 * Detach every SDK callback bound through this task's cancellation token, waiting on any that is already running.
+	 * Called by the task manager before destroying the task.
+	 */
+	void CancelPendingRequests()
+	{
+		CancellationToken->Cancel();
+	}
+
+	/**
+	 * Mark the point where this task has sent its first request, which for most tasks is when Initialize returns. Only
+	 * the first call has any effect.
+	 */
+	void MarkRequestSent()
+	{
+		double Unset = 0.0;
+		RequestSentTimeInSeconds.compare_exchange_strong(Unset, FPlatformTime::Seconds(), std::memory_order_release);
+	}
+
+	/**
+	 * Report the timestamps recorded over the life of this task to the metrics passed in. Called by the task manager
+	 * from the game thread once it is done with the task.
+	 */
+	void RecordMetrics(FOnlineAsyncTaskMetricsAccelByte& Metrics, double FinalizeStartedInSeconds, double DelegatesStartedInSeconds, double DoneInSeconds) const
+	{
+		FAccelByteAsyncTaskTimestamps Timestamps;
+		Timestamps.Queued = QueuedTimeInSeconds;
+		Timestamps.Initialized = InitializedTimeInSeconds;
+		Timestamps.RequestSent = RequestSentTimeInSeconds.load(std::memory_order_acquire);
+		Timestamps.ResponseReceived = ResponseReceivedTimeInSeconds.load(std::memory_order_acquire);
+		Timestamps.Completed = CompletedTimeInSeconds;
+		Timestamps.FinalizeStarted = FinalizeStartedInSeconds;
+		Timestamps.DelegatesStarted = DelegatesStartedInSeconds;
+		Timestamps.Done = DoneInSeconds;
+		Metrics.RecordTask(GetTaskName(), Timestamps, bWasSuccessful, CompleteState == EAccelByteAsyncTaskCompleteState::TimedOut);
+	}
+
+	/**
+	 * Name for trace events covering the given phase of this task, such as Initialize or Tick
+	 */
+	FString GetTraceEventName(const TCHAR* Phase) const
+	{
+		return FString::Printf(TEXT("%s::%s"), *GetTaskName(), Phase);
+	}
+
 	virtual FString ToString() const override
 	{
 		const FString CompleteStateString = AsyncTaskCompleteStateToString(CompleteState);
@@ -237,17 +526,38 @@ protected:
 	/** Enum representing the state that a task has finished in */
 	EAccelByteAsyncTaskCompleteState CompleteState = EAccelByteAsyncTaskCompleteState::Incomplete;
 
+	/**
+	 * Priority class of this task, which latency critical and background tasks set in their constructor. Dispatching
+	 * with an explicit priority overrides this.
+	 */
+	EAccelByteAsyncTaskPriority Priority = EAccelByteAsyncTaskPriority::Normal;
+
 	/** Whether this task requires a timeout to be used, will be set up through the constructor for the task */
 	bool bShouldUseTimeout = false;
 
 	/** Time in seconds since the last time an async portion of a task has updated its timeout */
-	double LastTaskUpdateInSeconds = 0.0;
+	std::atomic<double> LastTaskUpdateInSeconds{0.0};
 
 	/** Time in seconds that we should timeout this request, set to 30 seconds by default */
 	double TaskTimeoutInSeconds = 30.0;
 
-	/** Critical section for locking the last update time in seconds */
-	FCriticalSection TimeoutLock;
+	/** Time in seconds that the task manager last decided to tick this task, only touched from the online thread */
+	double LastTickTimeInSeconds = 0.0;
+
+	/** Time in seconds that this task was created and dispatched */
+	double QueuedTimeInSeconds = 0.0;
+
+	/** Time in seconds that Initialize was called for this task */
+	double InitializedTimeInSeconds = 0.0;
+
+	/** Time in seconds that this task sent its first request, see MarkRequestSent */
+	std::atomic<double> RequestSentTimeInSeconds{0.0};
+
+	/** Time in seconds that the first response came back after the first request was sent */
+	std::atomic<double> ResponseReceivedTimeInSeconds{0.0};
+
+	/** Time in seconds that this task was marked complete */
+	double CompletedTimeInSeconds = 0.0;
 
 	/**
 	 * Index of the user that we want to perform actions with, can be blank in favor of a user ID. Will be set to
@@ -264,6 +574,49 @@ protected:
 	/** Flags associated with this async task */
 	uint8 Flags = 0;
 
+	/** Handle used to ask the task manager for a tick, which can be handed to anything that may outlive this task */
+	TSharedRef<FOnlineAsyncTaskAccelByteWakeHandle, ESPMode::ThreadSafe> WakeHandle;
+
+	/** Token that SDK callbacks are bound through, cancelled once this task no longer wants any responses */
+	TSharedRef<FOnlineAsyncTaskAccelByteCancellationToken, ESPMode::ThreadSafe> CancellationToken = MakeShared<FOnlineAsyncTaskAccelByteCancellationToken, ESPMode::ThreadSafe>();
+
+	/**
+	 * Wrap an SDK delegate so that it only runs while this task's cancellation token has not been cancelled. Wrap every
+	 * delegate that is bound to this task before passing it to the SDK, so that a late response can never touch the
+	 * task after it has completed or been destroyed.
+	 */
+	template <typename DelegateType>
+	DelegateType MakeCancellable(const DelegateType& Delegate) const
+	{
+		return DelegateType::CreateLambda([Token = CancellationToken, Delegate](auto&&... Args) {
+			Token->Invoke([&]() {
+				Delegate.ExecuteIfBound(Forward<decltype(Args)>(Args)...);
+			});
+		});
+	}
+
+	/**
+	 * Opt this task into deduplication by returning every argument that affects its request, joined into a string. When
+	 * deduplication is enabled in the task manager, a task dispatched while an identical task is still in flight is
+	 * merged into it rather than sending a request of its own. Only Finalize of the first task runs, and then
+	 * TriggerDelegates of every merged task in dispatch order, after AdoptResultsFrom. Only opt in for queries whose
+	 * Finalize does not depend on which caller asked.
+	 */
+	virtual FString GetDeduplicationArguments() const
+	{
+		return FString();
+	}
+
+	/**
+	 * Turn on the timeout for this task and set how long it lasts. Only use a timeout shorter than the SDK's own retry
+	 * window if every SDK delegate for this task is bound through MakeCancellable or AB_ASYNC_TASK_DEFINE_SDK_DELEGATES.
+	 */
+	void SetTaskTimeout(double InTaskTimeoutInSeconds)
+	{
+		bShouldUseTimeout = true;
+		TaskTimeoutInSeconds = InTaskTimeoutInSeconds;
+	}
+
 	/**
 	 * Basic method to get the current name of the task, used for ToString on tasks as well as trace logs.
 	 *
@@ -289,32 +642,69 @@ protected:
 			return;
 		}
 
+		CompletedTimeInSeconds = FPlatformTime::Seconds();
 		CurrentState = EAccelByteAsyncTaskState::Completed;
 		CompleteState = InCompleteState;
 		bWasSuccessful = (CompleteState == EAccelByteAsyncTaskCompleteState::Success);
 		bIsComplete = true;
+
+		// Any response still in flight is no longer wanted, such as after timing out, so drop it rather than letting it
+		// touch the task while it is handed over to the game thread
+		CancellationToken->Cancel();
+
+		// Wake the manager so that it hands us over to the game thread straight away. Timing out is not a response, so
+		// leave it out of the request latency.
+		if (CompleteState != EAccelByteAsyncTaskCompleteState::TimedOut)
+		{
+			MarkResponseReceived();
+		}
+		WakeHandle->RequestTick();
+	}
+
+	/**
+	 * Ask the task manager to tick this task as soon as it can. Tasks are not ticked while idle, so call this from SDK
+	 * callbacks after changing any state that this task's Tick checks.
+	 */
+	void RequestTick()
+	{
+		MarkResponseReceived();
+		WakeHandle->RequestTick();
+	}
+
+	/**
+	 * Mark the first response to come back after this task sent its first request. Called for us whenever a callback
+	 * requests a tick, completes the task or updates the timeout, so tasks do not need to call this themselves.
+	 */
+	void MarkResponseReceived()
+	{
+		if (RequestSentTimeInSeconds.load(std::memory_order_acquire) <= 0.0)
+		{
+			return;
+		}
+
+		double Unset = 0.0;
+		ResponseReceivedTimeInSeconds.compare_exchange_strong(Unset, FPlatformTime::Seconds(), std::memory_order_acq_rel);
 	}
 
 	/**
-	 * Method for checking in tick whether we should consider this task as timed out, will handle locking mechanisms
+	 * Method for checking in tick whether we should consider this task as timed out, safe to call from any thread
 	 */
 	virtual bool HasTaskTimedOut()
 	{
-		FScopeLock ScopeLock(&TimeoutLock);
 		const double CurrentTimeInSeconds = FPlatformTime::Seconds();
-		return (CurrentTimeInSeconds - LastTaskUpdateInSeconds >= TaskTimeoutInSeconds);
+		return (CurrentTimeInSeconds - LastTaskUpdateInSeconds.load(std::memory_order_relaxed) >= TaskTimeoutInSeconds);
 	}
 
 	/**
-	 * Method for updating a timeout value with the current time in seconds, handles locking mechanisms.
+	 * Method for updating a timeout value with the current time in seconds, safe to call from any thread.
 	 *
 	 * This should be called for any task that utilizes a timeout either when getting a response back from an async request
 	 * or after kicking off async requests (ex. at the end of your Initialize method).
 	 */
 	virtual void SetLastUpdateTimeToCurrentTime()
 	{
-		FScopeLock ScopeLock(&TimeoutLock);
-		LastTaskUpdateInSeconds = FPlatformTime::Seconds();
+		MarkResponseReceived();
+		LastTaskUpdateInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
 	}
 
 	/**
@@ -21,6 +21,12 @@ public:
 	virtual void Initialize() override;
 	virtual void TriggerDelegates() override;
 
+	/** Ordered per user, so that connecting never ticks ahead of a login still in flight for the same user */
+	virtual int32 GetOrderingKey() const override
+	{
+		return LocalUserNum;
+	}
+
 protected:
 
 	virtual const FString GetTaskName() const override
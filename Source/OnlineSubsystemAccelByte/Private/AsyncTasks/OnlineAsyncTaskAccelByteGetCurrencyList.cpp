@@ -105,4 +105,17 @@ void FOnlineAsyncTaskAccelByteGetCurrencyList::OnGetCurrencyListError(int32 Erro
 	ErrorStr = TEXT("request-failed-get-currency-list-error");
 	UE_LOG_AB(Warning, TEXT("Failed to get currency list! Error Code: %d; Error Message: %s"), ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
-}
\ No newline at end of file
+}
+
+void FOnlineAsyncTaskAccelByteGetCurrencyList::AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary)
+{
+	Super::AdoptResultsFrom(Primary);
+	const FOnlineAsyncTaskAccelByteGetCurrencyList& PrimaryTask = static_cast<const FOnlineAsyncTaskAccelByteGetCurrencyList&>(Primary);
+	CachedCurrencyList = PrimaryTask.CachedCurrencyList;
+	ErrorStr = PrimaryTask.ErrorStr;
+}
+
+FString FOnlineAsyncTaskAccelByteGetCurrencyList::GetDeduplicationArguments() const
+{
+	return FString::Printf(TEXT("%s|%s"), *UserId->GetAccelByteId(), LOG_BOOL_FORMAT(bAlwaysRequestToService));
+}
@@ -29,6 +29,12 @@ public:
 	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
+	/** Ordered per user, so that a login never ticks alongside a lobby connect or another login for the same user */
+	virtual int32 GetOrderingKey() const override
+	{
+		return LocalUserNum;
+	}
+
 protected:
 
 	virtual const FString GetTaskName() const override
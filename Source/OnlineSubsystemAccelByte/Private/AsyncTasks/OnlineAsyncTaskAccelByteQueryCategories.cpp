@@ -66,6 +66,7 @@ void FOnlineAsyncTaskAccelByteQueryCategories::HandleGetRootCategorySuccess(cons
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT(""));
 	TaskLeft = AccelByteModelsCategoryInfos.Num();
+	RequestTick();
 	for(const FAccelByteModelsCategoryInfo& CategoryInfo : AccelByteModelsCategoryInfos)
 	{
 		FOnlineStoreCategory& Category = CategoryMap.FindOrAdd(CategoryInfo.CategoryPath);
@@ -91,6 +92,7 @@ void FOnlineAsyncTaskAccelByteQueryCategories::HandleGetDescendantCategoriesSucc
 		CategoryMap.Add(Descendant.Id, Descendant);
 	}
 	TaskLeft--;
+	RequestTick();
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
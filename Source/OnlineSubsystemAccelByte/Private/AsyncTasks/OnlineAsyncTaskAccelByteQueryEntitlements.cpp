@@ -9,6 +9,7 @@ FOnlineAsyncTaskAccelByteQueryEntitlements::FOnlineAsyncTaskAccelByteQueryEntitl
 	PagedQuery(InPage)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InUserId.AsShared());
+	Priority = EAccelByteAsyncTaskPriority::Low;
 }
 
 void FOnlineAsyncTaskAccelByteQueryEntitlements::Initialize()
@@ -124,3 +125,14 @@ void FOnlineAsyncTaskAccelByteQueryEntitlements::HandleQueryEntitlementError(int
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
+
+void FOnlineAsyncTaskAccelByteQueryEntitlements::AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary)
+{
+	Super::AdoptResultsFrom(Primary);
+	ErrorMessage = static_cast<const FOnlineAsyncTaskAccelByteQueryEntitlements&>(Primary).ErrorMessage;
+}
+
+FString FOnlineAsyncTaskAccelByteQueryEntitlements::GetDeduplicationArguments() const
+{
+	return FString::Printf(TEXT("%s|%s|%d|%d"), *UserId->GetAccelByteId(), *Namespace, PagedQuery.Start, PagedQuery.Count);
+}
@@ -12,6 +12,7 @@ public:
 
 	virtual void Initialize() override;
 	virtual void TriggerDelegates() override;
+	virtual void AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary) override;
 
 protected:
 
@@ -20,6 +21,8 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteQueryEntitlements");
 	}
 
+	virtual FString GetDeduplicationArguments() const override;
+
 private:
 	void QueryEntitlement(int32 Offset, int32 Limit);
 	void HandleQueryEntitlementSuccess(FAccelByteModelsEntitlementPagingSlicedResult const& Result);
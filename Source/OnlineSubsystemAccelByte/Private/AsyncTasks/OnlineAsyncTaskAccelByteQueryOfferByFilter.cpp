@@ -15,6 +15,7 @@ FOnlineAsyncTaskAccelByteQueryOfferByFilter::FOnlineAsyncTaskAccelByteQueryOffer
 	Delegate = InDelegate;
 	
 	Language = Subsystem->GetLanguage();
+	Priority = EAccelByteAsyncTaskPriority::Low;
 	
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
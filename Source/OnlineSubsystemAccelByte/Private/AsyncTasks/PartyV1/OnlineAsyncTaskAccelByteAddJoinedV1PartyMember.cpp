@@ -67,7 +67,7 @@ bool FOnlineAsyncTaskAccelByteAddJoinedV1PartyMember::HasFinishedAsyncWork()
 	return bHasRetrievedMemberInfo /*&& bHasRetrievedMemberStats && bHasRetrievedMemberCustomizations && bHasRetrievedMemberProgression && bHasRetrievedMemberDailyPlayStreak && bHasRetrievedMemberRanks*/;
 }
 
-void FOnlineAsyncTaskAccelByteAddJoinedV1PartyMember::OnQueryJoinedPartyMemberComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried)
+void FOnlineAsyncTaskAccelByteAddJoinedV1PartyMember::OnQueryJoinedPartyMemberComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds)
 {
 	SetLastUpdateTimeToCurrentTime();
 
@@ -82,4 +82,5 @@ void FOnlineAsyncTaskAccelByteAddJoinedV1PartyMember::OnQueryJoinedPartyMemberCo
 	}
 
 	bHasRetrievedMemberInfo = true;
+	RequestTick();
 }
@@ -59,7 +59,7 @@ private:
 	FThreadSafeBool bHasRetrievedMemberRanks = false;
 
 	/** Delegate handler for when we complete a query for joined party member information */
-	void OnQueryJoinedPartyMemberComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried);
+	void OnQueryJoinedPartyMemberComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds);
 
 };
 
@@ -21,6 +21,12 @@ public:
 	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
+	/** Ordered per user, so that membership changes reach the backend in the order they were made */
+	virtual int32 GetOrderingKey() const override
+	{
+		return LocalUserNum;
+	}
+
 protected:
 
 	virtual const FString GetTaskName() const override
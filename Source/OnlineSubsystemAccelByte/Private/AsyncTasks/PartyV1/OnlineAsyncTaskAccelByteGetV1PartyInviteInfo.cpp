@@ -55,7 +55,7 @@ void FOnlineAsyncTaskAccelByteGetV1PartyInviteInfo::Finalize()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteGetV1PartyInviteInfo::OnQueryNotificationSenderComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried)
+void FOnlineAsyncTaskAccelByteGetV1PartyInviteInfo::OnQueryNotificationSenderComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds)
 {
 	if (bIsSuccessful && UsersQueried.IsValidIndex(0))
 	{
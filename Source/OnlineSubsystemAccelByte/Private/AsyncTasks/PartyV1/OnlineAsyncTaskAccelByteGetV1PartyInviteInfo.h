@@ -36,7 +36,7 @@ private:
 	TSharedPtr<FAccelByteUserInfo> NotificationSenderInfo;
 
 	/** Delegate handler for when we complete a query for joined party member information */
-	void OnQueryNotificationSenderComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried);
+	void OnQueryNotificationSenderComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds);
 
 };
 
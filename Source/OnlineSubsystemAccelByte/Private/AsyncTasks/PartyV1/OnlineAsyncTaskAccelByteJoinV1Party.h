@@ -35,6 +35,12 @@ public:
 	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
 
+	/** Ordered against other membership changes for the same user, see FOnlineAsyncTaskAccelByte::GetOrderingKey */
+	virtual int32 GetOrderingKey() const override
+	{
+		return LocalUserNum;
+	}
+
 protected:
 
 	virtual const FString GetTaskName() const override
@@ -88,7 +88,7 @@ bool FOnlineAsyncTaskAccelByteQueryV1PartyInfo::HasFinishedAsyncWork()
 		bHasRetrievedPartyStorage;
 }
 
-void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnQueryPartyMembersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried)
+void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnQueryPartyMembersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds)
 {
 	SetLastUpdateTimeToCurrentTime();
 	if (bIsSuccessful)
@@ -100,6 +100,7 @@ void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnQueryPartyMembersComplete(bool
 		UE_LOG_AB(Warning, TEXT("Failed to query information about party members!"));
 	}
 	bHasRetrievedPartyMemberInfo = true;
+	RequestTick();
 }
 
 void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnGetPartyStorageSuccess(const FAccelByteModelsPartyDataNotif& Result)
@@ -113,6 +114,7 @@ void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnGetPartyStorageSuccess(const F
 	{
 		AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Failed to get party storage as the JSON object representing the custom storage attributes is not valid!"));
 		bHasRetrievedPartyStorage = true;
+		RequestTick();
 		return;
 	}
 
@@ -122,6 +124,7 @@ void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnGetPartyStorageSuccess(const F
 	{
 		AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Failed to get party storage as we could not convert the JSON object to a string!"));
 		bHasRetrievedPartyStorage = true;
+		RequestTick();
 		return;
 	}
 
@@ -138,6 +141,7 @@ void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnGetPartyStorageSuccess(const F
 	// Finally, we can provide this JSON string to the FromJson method of our PartyData instance which will populate our values
 	PartyInfo.PartyData->FromJson(JSONString);
 	bHasRetrievedPartyStorage = true;
+	RequestTick();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -147,6 +151,7 @@ void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnGetPartyStorageError(int32 Err
 	SetLastUpdateTimeToCurrentTime();
 	UE_LOG_AB(Warning, TEXT("Failed to get party storage for party %s as the request to the backend failed! Error code: %d; Error message: %s"), *PartyId, ErrorCode, *ErrorMessage);
 	bHasRetrievedPartyStorage = true;
+	RequestTick();
 }
 
 void FOnlineAsyncTaskAccelByteQueryV1PartyInfo::OnTaskTimedOut()
@@ -122,7 +122,7 @@ private:
 	bool HasFinishedAsyncWork();
 
 	/** Delegate handler for when our request to query all party members completes */
-	void OnQueryPartyMembersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried);
+	void OnQueryPartyMembersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds);
 
 	/** Delegate handler for when a request to get party storage data succeeds */
 	void OnGetPartyStorageSuccess(const FAccelByteModelsPartyDataNotif& Result);
@@ -59,7 +59,7 @@ void FOnlineAsyncTaskAccelByteUpdateV1PartyData::Initialize()
 
 	THandler<FAccelByteModelsPartyDataNotif> OnWritePartyStorageSuccessDelegate = THandler<FAccelByteModelsPartyDataNotif>::CreateRaw(this, &FOnlineAsyncTaskAccelByteUpdateV1PartyData::OnWritePartyStorageSuccess);
 	FErrorHandler OnWritePartyStorageErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteUpdateV1PartyData::OnWritePartyStorageError);
-	ApiClient->Lobby.WritePartyStorage(PartyId->ToString(), PartyStorageWriterFunction, OnWritePartyStorageSuccessDelegate, OnWritePartyStorageErrorDelegate);
+	Subsystem->GetBackend()->WritePartyStorage(ApiClient, PartyId->ToString(), PartyStorageWriterFunction, OnWritePartyStorageSuccessDelegate, OnWritePartyStorageErrorDelegate);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Sent off request to update party storage!"));
 }
@@ -4,6 +4,7 @@
 
 #include "OnlineAsyncTaskAccelByteFindV2PartyById.h"
 #include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineSessionSearchCacheAccelByte.h"
 
 FOnlineAsyncTaskAccelByteFindV2PartyById::FOnlineAsyncTaskAccelByteFindV2PartyById(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InSearchingPlayerId, const FUniqueNetId& InSessionId, const FOnSingleSessionResultCompleteDelegate& InDelegate)
     : FOnlineAsyncTaskAccelByte(InABInterface)
@@ -19,6 +20,17 @@ void FOnlineAsyncTaskAccelByteFindV2PartyById::Initialize()
 
     AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionId: %s"), *SessionId->ToDebugString());
 
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to find party by ID as our session interface is invalid!");
+
+	if (SessionInterface->GetSessionSearchCache()->GetSession(SessionId->ToString(), true, FoundSessionResult.Session))
+	{
+		bWasFoundInCache = true;
+		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Found party in search cache"));
+		return;
+	}
+
 	const THandler<FAccelByteModelsV2PartySession> OnGetPartySessionDetailsSuccessDelegate = THandler<FAccelByteModelsV2PartySession>::CreateRaw(this, &FOnlineAsyncTaskAccelByteFindV2PartyById::OnGetPartySessionDetailsSuccess);
 	const FErrorHandler OnGetPartySessionDetailsErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteFindV2PartyById::OnGetPartySessionDetailsError);
 	ApiClient->Session.GetPartyDetails(SessionId->ToString(), OnGetPartySessionDetailsSuccessDelegate, OnGetPartySessionDetailsErrorDelegate);
@@ -30,7 +42,7 @@ void FOnlineAsyncTaskAccelByteFindV2PartyById::Finalize()
 {
     AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
 
-	if (bWasSuccessful)
+	if (bWasSuccessful && !bWasFoundInCache)
 	{
 		const TSharedPtr<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe> SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
 		if (!ensure(SessionInterface.IsValid()))
@@ -39,7 +51,12 @@ void FOnlineAsyncTaskAccelByteFindV2PartyById::Finalize()
 			return;
 		}
 
-		SessionInterface->ConstructPartySessionFromBackendSessionModel(FoundPartySession, FoundSessionResult.Session);
+		const TSharedPtr<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe> SessionSearchCache = SessionInterface->GetSessionSearchCache();
+		if (!SessionSearchCache->GetSessionForVersion(FoundPartySession.ID, FoundPartySession.Version, true, FoundSessionResult.Session)
+			&& SessionInterface->ConstructPartySessionFromBackendSessionModel(FoundPartySession, FoundSessionResult.Session))
+		{
+			SessionSearchCache->AddSession(FoundPartySession.ID, FoundPartySession.Version, true, FoundSessionResult.Session);
+		}
 	}
 
     AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
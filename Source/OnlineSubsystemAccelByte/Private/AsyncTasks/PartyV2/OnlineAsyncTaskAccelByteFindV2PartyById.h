@@ -10,7 +10,8 @@
 #include "OnlineSessionSettings.h"
 
 /**
- * Try and find a single party session by its ID
+ * Try and find a single party session by its ID. Served from the session interface's search cache while the cached party
+ * is within its time to live, otherwise fetched from the backend and added to the cache.
  */
 class FOnlineAsyncTaskAccelByteFindV2PartyById : public FOnlineAsyncTaskAccelByte
 {
@@ -50,6 +51,11 @@ private:
 	 */
 	FOnlineSessionSearchResult FoundSessionResult;
 
+	/**
+	 * Whether FoundSessionResult was served from the search cache rather than fetched from the backend
+	 */
+	bool bWasFoundInCache{false};
+
 	void OnGetPartySessionDetailsSuccess(const FAccelByteModelsV2PartySession& InFoundPartySession);
 	void OnGetPartySessionDetailsError(int32 ErrorCode, const FString& ErrorMessage);
 
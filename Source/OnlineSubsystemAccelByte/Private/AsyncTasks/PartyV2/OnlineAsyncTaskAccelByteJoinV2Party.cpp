@@ -14,6 +14,9 @@ FOnlineAsyncTaskAccelByteJoinV2Party::FOnlineAsyncTaskAccelByteJoinV2Party(FOnli
 	, bIsRestoreSession(bInIsRestoreSession)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InLocalUserId.AsShared());
+
+	// Players are waiting on the join, so it should not queue up behind background work
+	Priority = EAccelByteAsyncTaskPriority::High;
 }
 
 void FOnlineAsyncTaskAccelByteJoinV2Party::Initialize()
@@ -118,7 +121,7 @@ void FOnlineAsyncTaskAccelByteJoinV2Party::TriggerDelegates()
 
 	SessionInterface->TriggerOnJoinSessionCompleteDelegates(SessionName, JoinSessionResult);
 
-	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""))
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
 void FOnlineAsyncTaskAccelByteJoinV2Party::OnJoinPartySuccess(const FAccelByteModelsV2PartySession& Result)
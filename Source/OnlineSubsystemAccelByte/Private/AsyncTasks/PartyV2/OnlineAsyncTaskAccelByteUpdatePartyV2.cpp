@@ -6,10 +6,11 @@
 #include "OnlineSessionInterfaceV2AccelByte.h"
 #include "OnlineSubsystemAccelByteSessionSettings.h"
 
-FOnlineAsyncTaskAccelByteUpdatePartyV2::FOnlineAsyncTaskAccelByteUpdatePartyV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings)
+FOnlineAsyncTaskAccelByteUpdatePartyV2::FOnlineAsyncTaskAccelByteUpdatePartyV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings, int32 InNumCoalescedCalls)
 	: FOnlineAsyncTaskAccelByte(InABInterface)
 	, SessionName(InSessionName)
 	, NewSessionSettings(InNewSessionSettings)
+	, NumCoalescedCalls(FMath::Max(InNumCoalescedCalls, 1))
 {
 	IOnlineSessionPtr SessionInterface = Subsystem->GetSessionInterface();
 	if (ensure(SessionInterface.IsValid()))
@@ -26,7 +27,7 @@ void FOnlineAsyncTaskAccelByteUpdatePartyV2::Initialize()
 {
 	Super::Initialize();
 
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionName: %s"), *SessionName.ToString());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionName: %s; NumCoalescedCalls: %d"), *SessionName.ToString(), NumCoalescedCalls);
 
 	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
 	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to update party session as our session interface is invalid!");
@@ -40,65 +41,90 @@ void FOnlineAsyncTaskAccelByteUpdatePartyV2::Initialize()
 	TSharedPtr<FAccelByteModelsV2PartySession> PartySessionBackendData = StaticCastSharedPtr<FAccelByteModelsV2PartySession>(SessionInfo->GetBackendSessionData());
 	AB_ASYNC_TASK_ENSURE(PartySessionBackendData.IsValid(), "Failed to update party session as our backend session information is invalid!");
 
+	SessionId = Session->GetSessionIdStr();
+	bSendAttributeDeltas = SessionInterface->ShouldSendSessionAttributeDeltas();
+	MaxConflictRetries = SessionInterface->GetMaxSessionUpdateConflictRetries();
+
+	// Work out which attributes we are changing against the last version of the party we got from the backend, so that
+	// the same changes can be applied again on top of a newer version if this one turns out to be stale
+	FOnlineSessionV2AccelByte::DiffSessionAttributes(PartySessionBackendData->Attributes.JsonObject, SessionInterface->ConvertSessionSettingsToJsonObject(NewSessionSettings), ChangedAttributes, RemovedAttributeFields);
+
+	SendUpdateRequest(*PartySessionBackendData);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdatePartyV2::SendUpdateRequest(const FAccelByteModelsV2PartySession& BaseSessionData)
+{
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to update party session as our session interface is invalid!");
+
 	FAccelByteModelsV2PartyUpdateRequest UpdateRequest;
 
-	// Set version for update to be the current version on backend
-	UpdateRequest.Version = PartySessionBackendData->Version;
+	// Set version for update to be the version of the party data we are building the update against
+	UpdateRequest.Version = BaseSessionData.Version;
 
-	// Currently we just want to update our attributes based on the new settings object passed in
-	UpdateRequest.Attributes.JsonObject = SessionInterface->ConvertSessionSettingsToJsonObject(NewSessionSettings);
+	// Removing an attribute needs the full set of attributes to be sent, as a delta has no way to express it
+	if (bSendAttributeDeltas && RemovedAttributeFields.Num() == 0)
+	{
+		UpdateRequest.Attributes.JsonObject = ChangedAttributes;
+	}
+	else
+	{
+		UpdateRequest.Attributes.JsonObject = FOnlineSessionV2AccelByte::MergeSessionAttributes(BaseSessionData.Attributes.JsonObject, ChangedAttributes, RemovedAttributeFields);
+	}
 	
 	// Check if joinability has changed and if so send it along to the backend
 	FString JoinTypeString;
 	NewSessionSettings.Get(SETTING_SESSION_JOIN_TYPE, JoinTypeString);
 	
 	const EAccelByteV2SessionJoinability JoinType = SessionInterface->GetJoinabilityFromString(JoinTypeString);
-	if (JoinType != PartySessionBackendData->Configuration.Joinability && JoinType != EAccelByteV2SessionJoinability::EMPTY)
+	if (JoinType != BaseSessionData.Configuration.Joinability && JoinType != EAccelByteV2SessionJoinability::EMPTY)
 	{
 		UpdateRequest.Joinability = JoinType;
 	}
 
 	int32 MinimumPlayers = 0;
-	if (NewSessionSettings.Get(SETTING_SESSION_MINIMUM_PLAYERS, MinimumPlayers) && MinimumPlayers != PartySessionBackendData->Configuration.MinPlayers)
+	if (NewSessionSettings.Get(SETTING_SESSION_MINIMUM_PLAYERS, MinimumPlayers) && MinimumPlayers != BaseSessionData.Configuration.MinPlayers)
 	{
 		UpdateRequest.MinPlayers = MinimumPlayers;
 	}
 
 	int32 InactiveTimeout = 0;
-	if (NewSessionSettings.Get(SETTING_SESSION_INACTIVE_TIMEOUT, InactiveTimeout) && MinimumPlayers != PartySessionBackendData->Configuration.InactiveTimeout)
+	if (NewSessionSettings.Get(SETTING_SESSION_INACTIVE_TIMEOUT, InactiveTimeout) && InactiveTimeout != BaseSessionData.Configuration.InactiveTimeout)
 	{
 		UpdateRequest.InactiveTimeout = InactiveTimeout;
 	}
 
 	int32 InviteTimeout = 0;
-	if (NewSessionSettings.Get(SETTING_SESSION_INVITE_TIMEOUT, InviteTimeout) && InviteTimeout > MinimumPlayers != PartySessionBackendData->Configuration.InviteTimeout)
+	if (NewSessionSettings.Get(SETTING_SESSION_INVITE_TIMEOUT, InviteTimeout) && InviteTimeout != BaseSessionData.Configuration.InviteTimeout)
 	{
 		UpdateRequest.InviteTimeout = InviteTimeout;
 	}
 
-	const THandler<FAccelByteModelsV2PartySession> OnUpdatePartySessionSuccessDelegate = THandler<FAccelByteModelsV2PartySession>::CreateRaw(this, &FOnlineAsyncTaskAccelByteUpdatePartyV2::OnUpdatePartySessionSuccess);
-	const FErrorHandler OnUpdatePartySessionErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteUpdatePartyV2::OnUpdatePartySessionError);
-	ApiClient->Session.UpdateParty(Session->GetSessionIdStr(), UpdateRequest, OnUpdatePartySessionSuccessDelegate, OnUpdatePartySessionErrorDelegate);
-
-	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+	AB_ASYNC_TASK_DEFINE_SDK_DELEGATES(FOnlineAsyncTaskAccelByteUpdatePartyV2, UpdatePartySession, THandler<FAccelByteModelsV2PartySession>);
+	ApiClient->Session.UpdateParty(SessionId, UpdateRequest, OnUpdatePartySessionSuccessDelegate, OnUpdatePartySessionErrorDelegate);
 }
 
 void FOnlineAsyncTaskAccelByteUpdatePartyV2::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
 
-	if (bWasSuccessful)
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	if (!ensure(SessionInterface.IsValid()))
 	{
-		const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
-		if (!ensure(SessionInterface.IsValid()))
-		{
-			AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Failed to finalize updating party session as our session interface is invalid!"));
-			return;
-		}
+		AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Failed to finalize updating party session as our session interface is invalid!"));
+		return;
+	}
 
+	if (bWasSuccessful)
+	{
 		SessionInterface->UpdateInternalPartySession(SessionName, NewSessionData);
 	}
 
+	// Let the session interface send any updates that were queued while this one was in flight
+	SessionInterface->OnSessionUpdateRequestComplete(SessionName);
+
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
@@ -113,7 +139,11 @@ void FOnlineAsyncTaskAccelByteUpdatePartyV2::TriggerDelegates()
 		return;
 	}
 
-	SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, bWasSuccessful);
+	// Each call that was coalesced into this task still expects its own completion delegate
+	for (int32 CallIndex = 0; CallIndex < NumCoalescedCalls; CallIndex++)
+	{
+		SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, bWasSuccessful);
+	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -130,6 +160,32 @@ void FOnlineAsyncTaskAccelByteUpdatePartyV2::OnUpdatePartySessionSuccess(const F
 
 void FOnlineAsyncTaskAccelByteUpdatePartyV2::OnUpdatePartySessionError(int32 ErrorCode, const FString& ErrorMessage)
 {
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	if (SessionInterface.IsValid() && SessionInterface->IsSessionVersionConflict(ErrorCode) && NumConflictRetries < MaxConflictRetries)
+	{
+		NumConflictRetries++;
+		UE_LOG_AB(Verbose, TEXT("Party session update was rejected for a stale version, fetching latest party data to retry (%d/%d)"), NumConflictRetries, MaxConflictRetries);
+
+		AB_ASYNC_TASK_DEFINE_SDK_DELEGATES(FOnlineAsyncTaskAccelByteUpdatePartyV2, RefreshPartySession, THandler<FAccelByteModelsV2PartySession>);
+		ApiClient->Session.GetPartyDetails(SessionId, OnRefreshPartySessionSuccessDelegate, OnRefreshPartySessionErrorDelegate);
+		return;
+	}
+
 	UE_LOG_AB(Warning, TEXT("Failed to update party session on backend! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 }
+
+void FOnlineAsyncTaskAccelByteUpdatePartyV2::OnRefreshPartySessionSuccess(const FAccelByteModelsV2PartySession& Result)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("LatestSessionVersion: %d"), Result.Version);
+
+	SendUpdateRequest(Result);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdatePartyV2::OnRefreshPartySessionError(int32 ErrorCode, const FString& ErrorMessage)
+{
+	UE_LOG_AB(Warning, TEXT("Failed to fetch latest party data to retry update! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
+	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+}
@@ -6,15 +6,21 @@
 #include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
 #include "OnlineSubsystemAccelByteTypes.h"
 #include "OnlineSessionSettings.h"
+#include "Dom/JsonObject.h"
 
 /**
  * Update a V2 party session instance with new settings
+ *
+ * Attributes are diffed and version conflicts retried the same way as FOnlineAsyncTaskAccelByteUpdateGameSessionV2.
  */
 class FOnlineAsyncTaskAccelByteUpdatePartyV2 : public FOnlineAsyncTaskAccelByte
 {
 public:
 
-	FOnlineAsyncTaskAccelByteUpdatePartyV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings);
+	/**
+	 * @param InNumCoalescedCalls Number of UpdateSession calls that this task stands in for, each getting a completion delegate
+	 */
+	FOnlineAsyncTaskAccelByteUpdatePartyV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings, int32 InNumCoalescedCalls = 1);
 
 	virtual void Initialize() override;
 	virtual void Finalize() override;
@@ -43,7 +49,35 @@ private:
 	 */
 	FAccelByteModelsV2PartySession NewSessionData;
 
-	void OnUpdatePartySessionSuccess(const FAccelByteModelsV2PartySession& BackendSessionData);
-	void OnUpdatePartySessionError(int32 ErrorCode, const FString& ErrorMessage);
+	/**
+	 * Number of UpdateSession calls that this task stands in for
+	 */
+	int32 NumCoalescedCalls{1};
+
+	/**
+	 * ID of the party on the backend
+	 */
+	FString SessionId{};
+
+	/**
+	 * Attributes that were added or changed from the backend session data, and fields that were removed
+	 */
+	TSharedRef<FJsonObject> ChangedAttributes{MakeShared<FJsonObject>()};
+	TArray<FString> RemovedAttributeFields{};
+
+	/**
+	 * Whether only changed attributes may be sent, and how many version conflicts are retried, from the session interface
+	 */
+	bool bSendAttributeDeltas{false};
+	int32 MaxConflictRetries{0};
+	int32 NumConflictRetries{0};
+
+	/**
+	 * Build an update request against the given backend party data and send it
+	 */
+	void SendUpdateRequest(const FAccelByteModelsV2PartySession& BaseSessionData);
+
+	AB_ASYNC_TASK_DECLARE_SDK_DELEGATES_WITH_RESULT(UpdatePartySession, FAccelByteModelsV2PartySession);
+	AB_ASYNC_TASK_DECLARE_SDK_DELEGATES_WITH_RESULT(RefreshPartySession, FAccelByteModelsV2PartySession);
 
 };
@@ -11,6 +11,8 @@ FOnlineAsyncTaskAccelByteAcceptBackfillProposal::FOnlineAsyncTaskAccelByteAccept
 	, bStopBackfilling(bInStopBackfilling)
 	, Delegate(InDelegate)
 {
+	// Proposals expire if not accepted in time, and players are waiting on the match
+	Priority = EAccelByteAsyncTaskPriority::High;
 }
 
 void FOnlineAsyncTaskAccelByteAcceptBackfillProposal::Initialize()
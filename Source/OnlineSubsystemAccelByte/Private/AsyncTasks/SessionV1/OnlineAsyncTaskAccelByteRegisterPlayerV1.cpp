@@ -176,6 +176,7 @@ void FOnlineAsyncTaskAccelByteRegisterPlayersV1::OnRegisterPlayerSuccess(const F
 
 	SetLastUpdateTimeToCurrentTime();
 	PendingPlayerRegistrations.Decrement();
+	RequestTick();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -184,5 +185,6 @@ void FOnlineAsyncTaskAccelByteRegisterPlayersV1::OnRegisterPlayerError(int32 Err
 {
 	UE_LOG_AB(Warning, TEXT("Failed to register player '%s' from session! Error code: %d; Error message: %s"), *PlayerId, ErrorCode, *ErrorMessage);
 	PendingPlayerRegistrations.Decrement();
+	RequestTick();
 	SetLastUpdateTimeToCurrentTime();
 }
@@ -122,6 +122,7 @@ void FOnlineAsyncTaskAccelByteUnregisterPlayersV1::OnUnregisterPlayerFromSession
 
 	SetLastUpdateTimeToCurrentTime();
 	PendingPlayerUnregistrations.Decrement();
+	RequestTick();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -130,5 +131,6 @@ void FOnlineAsyncTaskAccelByteUnregisterPlayersV1::OnUnregisterPlayerFromSession
 {
 	UE_LOG_AB(Warning, TEXT("Failed to unregister player '%s' from session! Error code: %d; Error message: %s"), *PlayerId, ErrorCode, *ErrorMessage);
 	PendingPlayerUnregistrations.Decrement();
+	RequestTick();
 	SetLastUpdateTimeToCurrentTime();
 }
@@ -109,7 +109,7 @@ void FOnlineAsyncTaskAccelByteRegisterDedicatedV1Session::TriggerDelegates()
 
 void FOnlineAsyncTaskAccelByteRegisterDedicatedV1Session::OnAuthenticateServerComplete(bool bAuthenticationSuccessful)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bAuthenticationSuccessful: %s"), LOG_BOOL_FORMAT(bAuthenticationSuccessful))
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bAuthenticationSuccessful: %s"), LOG_BOOL_FORMAT(bAuthenticationSuccessful));
 
 	if (!bAuthenticationSuccessful)
 	{
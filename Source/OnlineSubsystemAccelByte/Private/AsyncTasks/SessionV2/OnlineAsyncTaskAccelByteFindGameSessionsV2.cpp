@@ -4,6 +4,7 @@
 
 #include "OnlineAsyncTaskAccelByteFindGameSessionsV2.h"
 #include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineSessionSearchCacheAccelByte.h"
 #include "OnlineSessionSettingsAccelByte.h"
 #include "OnlineSubsystemAccelByteSessionSettings.h"
 
@@ -38,10 +39,17 @@ EAccelByteV2SessionQueryComparisonOp OSSComparisonOpToAccelByteOp(const EOnlineC
 FOnlineAsyncTaskAccelByteFindGameSessionsV2::FOnlineAsyncTaskAccelByteFindGameSessionsV2(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InSearchingPlayerId, const TSharedRef<FOnlineSessionSearch>& InSearchSettings)
 	: FOnlineAsyncTaskAccelByte(InABInterface, true)
 	, SearchSettings(InSearchSettings)
-	, ResultsRemaining(SearchSettings->MaxSearchResults)
+	// Always query at least one page, even if the search does not want any results
+	, NumPagesToQuery(FMath::Max(FMath::DivideAndRoundUp(SearchSettings->MaxSearchResults, ResultsPerPage), 1))
 {
-	// #TODO #SESSIONv2 Make this support the custom timeout value from the search settings handle eventually...
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InSearchingPlayerId.AsShared());
+
+	// Every page request is bound through our cancellation token, so we can honor the search's own timeout even when it
+	// is shorter than the SDK's retry window
+	if (SearchSettings->TimeoutInSeconds > 0.0f)
+	{
+		SetTaskTimeout(SearchSettings->TimeoutInSeconds);
+	}
 }
 
 void FOnlineAsyncTaskAccelByteFindGameSessionsV2::Initialize()
@@ -65,8 +73,13 @@ void FOnlineAsyncTaskAccelByteFindGameSessionsV2::Initialize()
 		AddVariantDataToQuery(QueryStruct, FieldName, QueryOperator, SearchParam.Value.Data);
 	}
 
-	// Query first page of results to start
-	QueryResultsPage(0);
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to find game sessions as our session interface is invalid!");
+
+	MaxConcurrentPages = SessionInterface->GetFindSessionsMaxConcurrentPages();
+
+	// Query the first pages of results to start
+	QueryMorePages();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -80,6 +93,13 @@ void FOnlineAsyncTaskAccelByteFindGameSessionsV2::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
 
+	// Append any results still waiting for the game thread, so that a search is never marked done without all of them
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->FlushFindSessionsResultsReceived();
+	}
+
 	SearchSettings->SearchState = (bWasSuccessful) ? EOnlineAsyncTaskState::Done : EOnlineAsyncTaskState::Failed;
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
@@ -96,14 +116,26 @@ void FOnlineAsyncTaskAccelByteFindGameSessionsV2::TriggerDelegates()
 		return;
 	}
 
+	// Deliver any results still waiting for the game thread, so that they never arrive after the search has completed
+	SessionInterface->FlushFindSessionsResultsReceived();
 	SessionInterface->TriggerOnFindSessionsCompleteDelegates(bWasSuccessful);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteFindGameSessionsV2::QueryResultsPage(int32 Offset)
+void FOnlineAsyncTaskAccelByteFindGameSessionsV2::QueryMorePages()
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Offset: %d"), Offset);
+	while (NumPagesInFlight < MaxConcurrentPages && NextPageToRequest < NumPagesToQuery && (LastPage == INDEX_NONE || NextPageToRequest <= LastPage))
+	{
+		QueryResultsPage(NextPageToRequest);
+		NextPageToRequest++;
+	}
+}
+
+void FOnlineAsyncTaskAccelByteFindGameSessionsV2::QueryResultsPage(int32 PageIndex)
+{
+	const int32 Offset = PageIndex * ResultsPerPage;
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("PageIndex: %d; Offset: %d"), PageIndex, Offset);
 
 	SetLastUpdateTimeToCurrentTime();
 
@@ -114,50 +146,91 @@ void FOnlineAsyncTaskAccelByteFindGameSessionsV2::QueryResultsPage(int32 Offset)
 	}
 
 	// Make call to query game sessions from offset with user defined limit
-	const THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult> OnQueryGameSessionsSuccessDelegate = THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult>::CreateRaw(this, &FOnlineAsyncTaskAccelByteFindGameSessionsV2::OnQueryGameSessionsSuccess, Offset);
-	const FErrorHandler OnQueryGameSessionsErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteFindGameSessionsV2::OnQueryGameSessionsError);
+	const THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult> OnQueryGameSessionsSuccessDelegate = MakeCancellable(THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult>::CreateRaw(this, &FOnlineAsyncTaskAccelByteFindGameSessionsV2::OnQueryGameSessionsSuccess, PageIndex));
+	const FErrorHandler OnQueryGameSessionsErrorDelegate = MakeCancellable(FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteFindGameSessionsV2::OnQueryGameSessionsError));
 
-	const int32 Limit = FMath::Min(ResultsRemaining, ResultsPerPage);
-	ApiClient->Session.QueryGameSessions(QueryStruct, OnQueryGameSessionsSuccessDelegate, OnQueryGameSessionsErrorDelegate, Offset, Limit);
+	const int32 Limit = FMath::Min(SearchSettings->MaxSearchResults - Offset, ResultsPerPage);
+	NumPagesInFlight++;
+	Subsystem->GetBackend()->QueryGameSessions(ApiClient, QueryStruct, OnQueryGameSessionsSuccessDelegate, OnQueryGameSessionsErrorDelegate, Offset, Limit);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteFindGameSessionsV2::OnQueryGameSessionsSuccess(const FAccelByteModelsV2PaginatedGameSessionQueryResult& Result, int32 LastOffset)
+void FOnlineAsyncTaskAccelByteFindGameSessionsV2::OnQueryGameSessionsSuccess(const FAccelByteModelsV2PaginatedGameSessionQueryResult& Result, int32 PageIndex)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionsFound: %d"), Result.Data.Num());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("PageIndex: %d; SessionsFound: %d"), PageIndex, Result.Data.Num());
 
 	SetLastUpdateTimeToCurrentTime();
+	NumPagesInFlight--;
 
 	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
 	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to construct game session search results as our session interface is invalid!");
 
-	ResultsRemaining -= Result.Data.Num();
+	// A page without a link to the next one is the last page with results, anything requested past it can be ignored
+	if (Result.Paging.Next.IsEmpty() && (LastPage == INDEX_NONE || PageIndex < LastPage))
+	{
+		LastPage = PageIndex;
+	}
+
+	const TSharedPtr<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe> SessionSearchCache = SessionInterface->GetSessionSearchCache();
+
+	TArray<FOnlineSessionSearchResult>& PageResults = PendingPages.Add(PageIndex);
+	PageResults.Reserve(Result.Data.Num());
 	for (const FAccelByteModelsV2GameSession& Session : Result.Data)
 	{
+		// Reuse the conversion of a session that has not changed since we last saw it
 		FOnlineSessionSearchResult SearchResult;
-		if (!SessionInterface->ConstructGameSessionFromBackendSessionModel(Session, SearchResult.Session))
+		if (!SessionSearchCache->GetSessionForVersion(Session.ID, Session.Version, false, SearchResult.Session))
 		{
-			UE_LOG_AB(Warning, TEXT("Failed to convert session with ID '%s' to a session search result during FindSessions! Skipping!"), *Session.ID);
-			continue;
+			if (!SessionInterface->ConstructGameSessionFromBackendSessionModel(Session, SearchResult.Session))
+			{
+				UE_LOG_AB(Warning, TEXT("Failed to convert session with ID '%s' to a session search result during FindSessions! Skipping!"), *Session.ID);
+				continue;
+			}
+
+			SessionSearchCache->AddSession(Session.ID, Session.Version, false, SearchResult.Session);
 		}
 
-		SearchSettings->SearchResults.Emplace(SearchResult);
+		PageResults.Emplace(MoveTemp(SearchResult));
 	}
 
-	if (ResultsRemaining > 0 && !Result.Paging.Next.IsEmpty())
-	{
-		// If we still have not hit our maximum search results, but we also have results to grab from backend, then make a request
-		// to get more results past the ones that we have already queried!
-		const int32 NewOffset = LastOffset + Result.Data.Num();
-		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Sending request to get more search results at offset %d"), NewOffset);
-		QueryResultsPage(NewOffset);
-	}
-	else
+	AddPendingPagesToResults();
+
+	const bool bHasAddedLastPage = LastPage != INDEX_NONE && NextPageToAdd > LastPage;
+	if (bHasAddedLastPage || NextPageToAdd >= NumPagesToQuery)
 	{
-		// Otherwise, just complete the task so that we can return these results to the game
+		// Either there are no more results on the backend, or we have filled the search results, so complete the task
+		// so that we can return these results to the game
 		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Found all possible results for this search, completing task!"));
 		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		return;
+	}
+
+	// Otherwise, keep requesting pages past the ones that we have already queried
+	QueryMorePages();
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Waiting on %d more pages of search results"), NumPagesInFlight);
+}
+
+void FOnlineAsyncTaskAccelByteFindGameSessionsV2::AddPendingPagesToResults()
+{
+	TArray<FOnlineSessionSearchResult> NewResults;
+	TArray<FOnlineSessionSearchResult> PageResults;
+	while ((LastPage == INDEX_NONE || NextPageToAdd <= LastPage) && PendingPages.RemoveAndCopyValue(NextPageToAdd, PageResults))
+	{
+		NewResults.Append(MoveTemp(PageResults));
+		NextPageToAdd++;
+	}
+
+	if (NewResults.Num() == 0)
+	{
+		return;
+	}
+
+	// Page responses may come in on any thread, so the session interface hands the new results to the game on the game thread
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	if (SessionInterface.IsValid())
+	{
+		SessionInterface->QueueFindSessionsResultsReceived(SearchSettings, MoveTemp(NewResults));
 	}
 }
 
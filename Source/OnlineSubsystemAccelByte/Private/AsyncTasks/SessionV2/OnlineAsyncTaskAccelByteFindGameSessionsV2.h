@@ -11,6 +11,11 @@
 
 /**
  * Task to query game sessions on backend.
+ *
+ * Pages of results are requested at fixed offsets, with up to the session interface's FindSessionsMaxConcurrentPages
+ * in flight at once. Pages are added to the search results in offset order however they arrive, on the game thread
+ * through the session interface, with OnFindSessionsResultsReceived fired for each batch added. The first page that comes back without a next page link
+ * marks the end of the results, and any pages requested past it are dropped.
  */
 class FOnlineAsyncTaskAccelByteFindGameSessionsV2 : public FOnlineAsyncTaskAccelByte
 {
@@ -40,15 +45,44 @@ private:
 	/** Amount of session results we want per page */
 	const int32 ResultsPerPage = 20;
 
-	/** Amount of sessions that we are trying to fill in the search results */
-	int32 ResultsRemaining = 0;
+	/** Number of pages needed to fill the maximum search results */
+	int32 NumPagesToQuery = 0;
+
+	/** Most pages that we have in flight at once */
+	int32 MaxConcurrentPages = 1;
+
+	/** Index of the next page to request */
+	int32 NextPageToRequest = 0;
+
+	/** Index of the next page to add to the search results, pages after it are held until it arrives */
+	int32 NextPageToAdd = 0;
+
+	/** Number of page requests that have yet to come back */
+	int32 NumPagesInFlight = 0;
+
+	/** Index of the last page with results on the backend, or INDEX_NONE until a page comes back without a next page */
+	int32 LastPage = INDEX_NONE;
+
+	/** Pages that came back ahead of NextPageToAdd, by page index */
+	TMap<int32, TArray<FOnlineSessionSearchResult>> PendingPages;
+
+	/**
+	 * Request pages until we either have as many in flight as allowed, or have requested every page we need
+	 */
+	void QueryMorePages();
+
+	/**
+	 * Query a single page of results
+	 */
+	void QueryResultsPage(int32 PageIndex);
 
 	/**
-	 * Query a single page of results. On complete if we need more results and have not reached the end, we will query another page.
+	 * Queue every page that is next in order with the session interface, which appends them to the search results and
+	 * fires OnFindSessionsResultsReceived with them on the game thread
 	 */
-	void QueryResultsPage(int32 Offset);
+	void AddPendingPagesToResults();
 
-	void OnQueryGameSessionsSuccess(const FAccelByteModelsV2PaginatedGameSessionQueryResult& Result, int32 LastOffset);
+	void OnQueryGameSessionsSuccess(const FAccelByteModelsV2PaginatedGameSessionQueryResult& Result, int32 PageIndex);
 	void OnQueryGameSessionsError(int32 ErrorCode, const FString& ErrorMessage);
 
 	bool AddVariantDataToQuery(FAccelByteModelsV2GameSessionQuery& Query, const FString& FieldName, const EAccelByteV2SessionQueryComparisonOp& Comparison, const FVariantData& Data) const;
@@ -4,6 +4,7 @@
 
 #include "OnlineAsyncTaskAccelByteFindV2GameSessionById.h"
 #include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineSessionSearchCacheAccelByte.h"
 
 FOnlineAsyncTaskAccelByteFindV2GameSessionById::FOnlineAsyncTaskAccelByteFindV2GameSessionById(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InSearchingPlayerId, const FUniqueNetId& InSessionId, const FOnSingleSessionResultCompleteDelegate& InDelegate)
 	// Initialize as a server task if we are running a server task, as this doubles as a server task. Otherwise, use no flags 
@@ -23,6 +24,17 @@ void FOnlineAsyncTaskAccelByteFindV2GameSessionById::Initialize()
 
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionId: %s"), *SessionId->ToDebugString());
 
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to find game session by ID as our session interface is invalid!");
+
+	if (SessionInterface->GetSessionSearchCache()->GetSession(SessionId->ToString(), false, FoundSessionResult.Session))
+	{
+		bWasFoundInCache = true;
+		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("Found game session in search cache"));
+		return;
+	}
+
 	// Send the API call based on whether we are a server or a client
 	AB_ASYNC_TASK_DEFINE_SDK_DELEGATES(FOnlineAsyncTaskAccelByteFindV2GameSessionById, GetGameSessionDetails, THandler<FAccelByteModelsV2GameSession>);
 	if (IsRunningDedicatedServer())
@@ -41,7 +53,7 @@ void FOnlineAsyncTaskAccelByteFindV2GameSessionById::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
 
-	if (bWasSuccessful)
+	if (bWasSuccessful && !bWasFoundInCache)
 	{
 		const TSharedPtr<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe> SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
 		if (!ensure(SessionInterface.IsValid()))
@@ -50,7 +62,12 @@ void FOnlineAsyncTaskAccelByteFindV2GameSessionById::Finalize()
 			return;
 		}
 
-		SessionInterface->ConstructGameSessionFromBackendSessionModel(FoundGameSession, FoundSessionResult.Session);
+		const TSharedPtr<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe> SessionSearchCache = SessionInterface->GetSessionSearchCache();
+		if (!SessionSearchCache->GetSessionForVersion(FoundGameSession.ID, FoundGameSession.Version, false, FoundSessionResult.Session)
+			&& SessionInterface->ConstructGameSessionFromBackendSessionModel(FoundGameSession, FoundSessionResult.Session))
+		{
+			SessionSearchCache->AddSession(FoundGameSession.ID, FoundGameSession.Version, false, FoundSessionResult.Session);
+		}
 	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
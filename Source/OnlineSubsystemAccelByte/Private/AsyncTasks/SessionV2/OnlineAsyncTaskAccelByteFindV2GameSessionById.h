@@ -9,7 +9,8 @@
 #include "OnlineSessionSettings.h"
 
 /**
- * Find a single session by its ID
+ * Find a single session by its ID. Served from the session interface's search cache while the cached session is within
+ * its time to live, otherwise fetched from the backend and added to the cache.
  */
 class FOnlineAsyncTaskAccelByteFindV2GameSessionById : public FOnlineAsyncTaskAccelByte
 {
@@ -49,6 +50,11 @@ private:
 	 */
 	FOnlineSessionSearchResult FoundSessionResult;
 
+	/**
+	 * Whether FoundSessionResult was served from the search cache rather than fetched from the backend
+	 */
+	bool bWasFoundInCache{false};
+
 	void OnGetGameSessionDetailsSuccess(const FAccelByteModelsV2GameSession& InFoundGameSession);
 	void OnGetGameSessionDetailsError(int32 ErrorCode, const FString& ErrorMessage);
 };
@@ -12,6 +12,9 @@ FOnlineAsyncTaskAccelByteJoinV2GameSession::FOnlineAsyncTaskAccelByteJoinV2GameS
 	, bIsRestoreSession(bInIsRestoreSession)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InLocalUserId.AsShared());
+
+	// Players are waiting on the join, so it should not queue up behind background work
+	Priority = EAccelByteAsyncTaskPriority::High;
 }
 
 void FOnlineAsyncTaskAccelByteJoinV2GameSession::Initialize()
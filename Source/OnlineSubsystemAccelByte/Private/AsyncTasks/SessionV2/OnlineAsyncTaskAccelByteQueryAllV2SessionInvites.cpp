@@ -98,6 +98,7 @@ void FOnlineAsyncTaskAccelByteQueryAllV2SessionInvites::OnGetGameSessionInvitesS
 	}
 
 	bHasReceivedGameSessionInviteResponse = true;
+	RequestTick();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -131,6 +132,7 @@ void FOnlineAsyncTaskAccelByteQueryAllV2SessionInvites::OnGetPartySessionInvites
 	}
 
 	bHasReceivedPartySessionInviteResponse = true;
+	RequestTick();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
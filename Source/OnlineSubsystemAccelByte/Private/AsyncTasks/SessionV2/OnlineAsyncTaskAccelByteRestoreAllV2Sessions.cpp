@@ -122,6 +122,7 @@ void FOnlineAsyncTaskAccelByteRestoreAllV2Sessions::OnGetMyGameSessionsSuccess(c
 	}
 
 	bHasRetrievedGameSessionInfo = true;
+	RequestTick();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -174,6 +175,7 @@ void FOnlineAsyncTaskAccelByteRestoreAllV2Sessions::OnGetMyPartiesSuccess(const
 	}
 
 	bHasRetrievedPartySessionInfo = true;
+	RequestTick();
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
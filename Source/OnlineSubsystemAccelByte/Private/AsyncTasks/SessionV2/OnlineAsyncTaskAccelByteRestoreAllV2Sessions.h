@@ -29,6 +29,12 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteRestoreAllV2Sessions");
 	}
 
+	/** Restored sessions are handed to the session interface in Finalize, so duplicates only need the result itself */
+	virtual FString GetDeduplicationArguments() const override
+	{
+		return UserId->GetAccelByteId();
+	}
+
 private:
 	/** Flag denoting when we get a response back for querying information about the user's party */
 	FThreadSafeBool bHasRetrievedPartySessionInfo = false;
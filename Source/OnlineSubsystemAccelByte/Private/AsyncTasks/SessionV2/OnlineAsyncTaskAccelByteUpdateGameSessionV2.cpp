@@ -9,11 +9,12 @@
 #include "GameServerApi/AccelByteServerSessionApi.h"
 #include "Api/AccelByteSessionApi.h"
 
-FOnlineAsyncTaskAccelByteUpdateGameSessionV2::FOnlineAsyncTaskAccelByteUpdateGameSessionV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings)
+FOnlineAsyncTaskAccelByteUpdateGameSessionV2::FOnlineAsyncTaskAccelByteUpdateGameSessionV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings, int32 InNumCoalescedCalls)
 	// Initialize as a server task if we are running a server task, as this doubles as a server task. Otherwise, use no flags
 	: FOnlineAsyncTaskAccelByte(InABInterface, (IsRunningDedicatedServer()) ? ASYNC_TASK_FLAG_BIT(EAccelByteAsyncTaskFlags::ServerTask) : ASYNC_TASK_FLAG_BIT(EAccelByteAsyncTaskFlags::None))
 	, SessionName(InSessionName)
 	, NewSessionSettings(InNewSessionSettings)
+	, NumCoalescedCalls(FMath::Max(InNumCoalescedCalls, 1))
 {
 	if (!IsRunningDedicatedServer())
 	{
@@ -33,7 +34,7 @@ void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::Initialize()
 {
 	Super::Initialize();
 
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionName: %s"), *SessionName.ToString());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("SessionName: %s; NumCoalescedCalls: %d"), *SessionName.ToString(), NumCoalescedCalls);
 
 	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
 	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to update game session as our session interface is invalid!");
@@ -47,26 +48,55 @@ void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::Initialize()
 	TSharedPtr<FAccelByteModelsV2GameSession> GameSessionBackendData = StaticCastSharedPtr<FAccelByteModelsV2GameSession>(SessionInfo->GetBackendSessionData());
 	AB_ASYNC_TASK_ENSURE(GameSessionBackendData.IsValid(), "Failed to update game session as our local backend session info is invalid!");
 
+	SessionId = SessionInfo->GetSessionId().ToString();
+	bSendAttributeDeltas = SessionInterface->ShouldSendSessionAttributeDeltas();
+	MaxConflictRetries = SessionInterface->GetMaxSessionUpdateConflictRetries();
+	MaxPlayers = SessionInterface->GetSessionMaxPlayerCount(SessionName);
+
+	// #NOTE Team assignments will override the session's members list on the backend!
+	Teams = SessionInfo->GetTeamAssignments();
+
+	// Work out which attributes we are changing against the last version of the session we got from the backend, so
+	// that the same changes can be applied again on top of a newer version if this one turns out to be stale
+	FOnlineSessionV2AccelByte::DiffSessionAttributes(GameSessionBackendData->Attributes.JsonObject, SessionInterface->ConvertSessionSettingsToJsonObject(NewSessionSettings), ChangedAttributes, RemovedAttributeFields);
+
+	SendUpdateRequest(*GameSessionBackendData);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::SendUpdateRequest(const FAccelByteModelsV2GameSession& BaseSessionData)
+{
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	AB_ASYNC_TASK_ENSURE(SessionInterface.IsValid(), "Failed to update game session as our session interface is invalid!");
+
 	FAccelByteModelsV2GameSessionUpdateRequest UpdateRequest;
 
-	// Set version for update to be the current version on backend
-	UpdateRequest.Version = GameSessionBackendData->Version;
+	// Set version for update to be the version of the session data we are building the update against
+	UpdateRequest.Version = BaseSessionData.Version;
 
-	// Currently we just want to update our attributes based on the new settings object passed in
-	UpdateRequest.Attributes.JsonObject = SessionInterface->ConvertSessionSettingsToJsonObject(NewSessionSettings);
+	// Removing an attribute needs the full set of attributes to be sent, as a delta has no way to express it
+	if (bSendAttributeDeltas && RemovedAttributeFields.Num() == 0)
+	{
+		UpdateRequest.Attributes.JsonObject = ChangedAttributes;
+	}
+	else
+	{
+		UpdateRequest.Attributes.JsonObject = FOnlineSessionV2AccelByte::MergeSessionAttributes(BaseSessionData.Attributes.JsonObject, ChangedAttributes, RemovedAttributeFields);
+	}
 	
 	// Check if joinability has changed and if so send it along to the backend
 	FString JoinTypeString;
 	NewSessionSettings.Get(SETTING_SESSION_JOIN_TYPE, JoinTypeString);
 	
 	const EAccelByteV2SessionJoinability JoinType = SessionInterface->GetJoinabilityFromString(JoinTypeString);
-	if (JoinType != GameSessionBackendData->Configuration.Joinability && JoinType != EAccelByteV2SessionJoinability::EMPTY)
+	if (JoinType != BaseSessionData.Configuration.Joinability && JoinType != EAccelByteV2SessionJoinability::EMPTY)
 	{
 		UpdateRequest.Joinability = JoinType;
 	}
 
 	// Update requested regions for the DS request if the settings have changed
-	const TArray<FString> OldRequestedRegions = GameSessionBackendData->Configuration.RequestedRegions;
+	const TArray<FString>& OldRequestedRegions = BaseSessionData.Configuration.RequestedRegions;
 	TArray<FString> NewRequestedRegions;
 	FOnlineSessionSettingsAccelByte::Get(NewSessionSettings, SETTING_GAMESESSION_REQUESTEDREGIONS, NewRequestedRegions);
 
@@ -89,37 +119,36 @@ void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::Initialize()
 	}
 
 	FString ClientVersion{};
-	if (NewSessionSettings.Get(SETTING_GAMESESSION_CLIENTVERSION, ClientVersion) && ClientVersion != GameSessionBackendData->Configuration.ClientVersion)
+	if (NewSessionSettings.Get(SETTING_GAMESESSION_CLIENTVERSION, ClientVersion) && ClientVersion != BaseSessionData.Configuration.ClientVersion)
 	{
 		UpdateRequest.ClientVersion = ClientVersion;
 	}
 
 	FString Deployment{};
-	if (NewSessionSettings.Get(SETTING_GAMESESSION_CLIENTVERSION, Deployment) && Deployment != GameSessionBackendData->Configuration.Deployment)
+	if (NewSessionSettings.Get(SETTING_GAMESESSION_DEPLOYMENT, Deployment) && Deployment != BaseSessionData.Configuration.Deployment)
 	{
 		UpdateRequest.Deployment = Deployment;
 	}
 
 	int32 MinimumPlayers = 0;
-	if (NewSessionSettings.Get(SETTING_SESSION_MINIMUM_PLAYERS, MinimumPlayers) && MinimumPlayers != GameSessionBackendData->Configuration.MinPlayers)
+	if (NewSessionSettings.Get(SETTING_SESSION_MINIMUM_PLAYERS, MinimumPlayers) && MinimumPlayers != BaseSessionData.Configuration.MinPlayers)
 	{
 		UpdateRequest.MinPlayers = MinimumPlayers;
 	}
 
-	int32 StoredMaximumPlayers = SessionInterface->GetSessionMaxPlayerCount(SessionName);
-	if (StoredMaximumPlayers != GameSessionBackendData->Configuration.MaxPlayers)
+	if (MaxPlayers != BaseSessionData.Configuration.MaxPlayers)
 	{
-		UpdateRequest.MaxPlayers = StoredMaximumPlayers;
+		UpdateRequest.MaxPlayers = MaxPlayers;
 	}
 
 	int32 InactiveTimeout = 0;
-	if (NewSessionSettings.Get(SETTING_SESSION_INACTIVE_TIMEOUT, InactiveTimeout) && InactiveTimeout != GameSessionBackendData->Configuration.InactiveTimeout)
+	if (NewSessionSettings.Get(SETTING_SESSION_INACTIVE_TIMEOUT, InactiveTimeout) && InactiveTimeout != BaseSessionData.Configuration.InactiveTimeout)
 	{
 		UpdateRequest.InactiveTimeout = InactiveTimeout;
 	}
 
 	int32 InviteTimeout = 0;
-	if (NewSessionSettings.Get(SETTING_SESSION_INVITE_TIMEOUT, InviteTimeout) && InviteTimeout != GameSessionBackendData->Configuration.InviteTimeout)
+	if (NewSessionSettings.Get(SETTING_SESSION_INVITE_TIMEOUT, InviteTimeout) && InviteTimeout != BaseSessionData.Configuration.InviteTimeout)
 	{
 		UpdateRequest.InviteTimeout = InviteTimeout;
 	}
@@ -127,45 +156,44 @@ void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::Initialize()
 	FString ServerTypeString{};
 	NewSessionSettings.Get(SETTING_SESSION_SERVER_TYPE, ServerTypeString);
 	const EAccelByteV2SessionConfigurationServerType ServerType = SessionInterface->GetServerTypeFromString(ServerTypeString);
-	if (ServerType != GameSessionBackendData->Configuration.Type && ServerType != EAccelByteV2SessionConfigurationServerType::EMPTY)
+	if (ServerType != BaseSessionData.Configuration.Type && ServerType != EAccelByteV2SessionConfigurationServerType::EMPTY)
 	{
 		UpdateRequest.Type = ServerType;
 	}
 
-	// #NOTE Team assignments will override the session's members list on the backend!
-	UpdateRequest.Teams = SessionInfo->GetTeamAssignments();
+	UpdateRequest.Teams = Teams;
 
 	// Send the API call based on whether we are a server or a client
-	const THandler<FAccelByteModelsV2GameSession> OnUpdateGameSessionSuccessDelegate = THandler<FAccelByteModelsV2GameSession>::CreateRaw(this, &FOnlineAsyncTaskAccelByteUpdateGameSessionV2::OnUpdateGameSessionSuccess);
-	const FErrorHandler OnUpdateGameSessionErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteUpdateGameSessionV2::OnUpdateGameSessionError);
+	AB_ASYNC_TASK_DEFINE_SDK_DELEGATES(FOnlineAsyncTaskAccelByteUpdateGameSessionV2, UpdateGameSession, THandler<FAccelByteModelsV2GameSession>);
 	if (IsRunningDedicatedServer())
 	{
-		FRegistry::ServerSession.UpdateGameSession(SessionInfo->GetSessionId().ToString(), UpdateRequest, OnUpdateGameSessionSuccessDelegate, OnUpdateGameSessionErrorDelegate);
+		FRegistry::ServerSession.UpdateGameSession(SessionId, UpdateRequest, OnUpdateGameSessionSuccessDelegate, OnUpdateGameSessionErrorDelegate);
 	}
 	else
 	{
-		ApiClient->Session.UpdateGameSession(SessionInfo->GetSessionId().ToString(), UpdateRequest, OnUpdateGameSessionSuccessDelegate, OnUpdateGameSessionErrorDelegate);
+		ApiClient->Session.UpdateGameSession(SessionId, UpdateRequest, OnUpdateGameSessionSuccessDelegate, OnUpdateGameSessionErrorDelegate);
 	}
-
-	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
 void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
 
-	if (bWasSuccessful)
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	if (!ensure(SessionInterface.IsValid()))
 	{
-		const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
-		if (!ensure(SessionInterface.IsValid()))
-		{
-			AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Failed to finalize updating game session as our session interface is invalid!"));
-			return;
-		}
+		AB_OSS_ASYNC_TASK_TRACE_END_VERBOSITY(Warning, TEXT("Failed to finalize updating game session as our session interface is invalid!"));
+		return;
+	}
 
+	if (bWasSuccessful)
+	{
 		SessionInterface->UpdateInternalGameSession(SessionName, NewSessionData);
 	}
 
+	// Let the session interface send any updates that were queued while this one was in flight
+	SessionInterface->OnSessionUpdateRequestComplete(SessionName);
+
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
@@ -180,7 +208,11 @@ void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::TriggerDelegates()
 		return;
 	}
 
-	SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, bWasSuccessful);
+	// Each call that was coalesced into this task still expects its own completion delegate
+	for (int32 CallIndex = 0; CallIndex < NumCoalescedCalls; CallIndex++)
+	{
+		SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, bWasSuccessful);
+	}
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -197,6 +229,39 @@ void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::OnUpdateGameSessionSuccess(co
 
 void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::OnUpdateGameSessionError(int32 ErrorCode, const FString& ErrorMessage)
 {
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	if (SessionInterface.IsValid() && SessionInterface->IsSessionVersionConflict(ErrorCode) && NumConflictRetries < MaxConflictRetries)
+	{
+		NumConflictRetries++;
+		UE_LOG_AB(Verbose, TEXT("Game session update was rejected for a stale version, fetching latest session data to retry (%d/%d)"), NumConflictRetries, MaxConflictRetries);
+
+		AB_ASYNC_TASK_DEFINE_SDK_DELEGATES(FOnlineAsyncTaskAccelByteUpdateGameSessionV2, RefreshGameSession, THandler<FAccelByteModelsV2GameSession>);
+		if (IsRunningDedicatedServer())
+		{
+			FRegistry::ServerSession.GetGameSessionDetails(SessionId, OnRefreshGameSessionSuccessDelegate, OnRefreshGameSessionErrorDelegate);
+		}
+		else
+		{
+			ApiClient->Session.GetGameSessionDetails(SessionId, OnRefreshGameSessionSuccessDelegate, OnRefreshGameSessionErrorDelegate);
+		}
+		return;
+	}
+
 	UE_LOG_AB(Warning, TEXT("Failed to update game session on backend! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
 	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 }
+
+void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::OnRefreshGameSessionSuccess(const FAccelByteModelsV2GameSession& Result)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("LatestSessionVersion: %d"), Result.Version);
+
+	SendUpdateRequest(Result);
+
+	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
+}
+
+void FOnlineAsyncTaskAccelByteUpdateGameSessionV2::OnRefreshGameSessionError(int32 ErrorCode, const FString& ErrorMessage)
+{
+	UE_LOG_AB(Warning, TEXT("Failed to fetch latest game session data to retry update! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
+	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+}
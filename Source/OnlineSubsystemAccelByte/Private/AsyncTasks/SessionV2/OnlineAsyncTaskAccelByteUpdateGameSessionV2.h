@@ -9,12 +9,20 @@
 
 /**
  * Update a V2 game session instance with new settings
+ *
+ * Attributes are diffed once against the session data we last got from the backend. Only changed attributes are sent
+ * when the session interface allows deltas, otherwise the changes are merged into the backend's attributes. If the
+ * backend rejects the update for having a stale version, the latest session data is fetched and the same changes are
+ * sent again on top of it, up to the session interface's retry limit.
  */
 class FOnlineAsyncTaskAccelByteUpdateGameSessionV2 : public FOnlineAsyncTaskAccelByte
 {
 public:
 
-	FOnlineAsyncTaskAccelByteUpdateGameSessionV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings);
+	/**
+	 * @param InNumCoalescedCalls Number of UpdateSession calls that this task stands in for, each getting a completion delegate
+	 */
+	FOnlineAsyncTaskAccelByteUpdateGameSessionV2(FOnlineSubsystemAccelByte* const InABInterface, const FName& InSessionName, const FOnlineSessionSettings& InNewSessionSettings, int32 InNumCoalescedCalls = 1);
 
 	virtual void Initialize() override;
 	virtual void Finalize() override;
@@ -43,7 +51,41 @@ private:
 	 */
 	FAccelByteModelsV2GameSession NewSessionData;
 
-	void OnUpdateGameSessionSuccess(const FAccelByteModelsV2GameSession& BackendSessionData);
-	void OnUpdateGameSessionError(int32 ErrorCode, const FString& ErrorMessage);
+	/**
+	 * Number of UpdateSession calls that this task stands in for
+	 */
+	int32 NumCoalescedCalls{1};
+
+	/**
+	 * ID of the session on the backend
+	 */
+	FString SessionId{};
+
+	/**
+	 * Attributes that were added or changed from the backend session data, and fields that were removed
+	 */
+	TSharedRef<FJsonObject> ChangedAttributes{MakeShared<FJsonObject>()};
+	TArray<FString> RemovedAttributeFields{};
+
+	/**
+	 * Team assignments and maximum player count from the local session, sent with each request
+	 */
+	TArray<FAccelByteModelsV2GameSessionTeam> Teams{};
+	int32 MaxPlayers{0};
+
+	/**
+	 * Whether only changed attributes may be sent, and how many version conflicts are retried, from the session interface
+	 */
+	bool bSendAttributeDeltas{false};
+	int32 MaxConflictRetries{0};
+	int32 NumConflictRetries{0};
+
+	/**
+	 * Build an update request against the given backend session data and send it
+	 */
+	void SendUpdateRequest(const FAccelByteModelsV2GameSession& BaseSessionData);
+
+	AB_ASYNC_TASK_DECLARE_SDK_DELEGATES_WITH_RESULT(UpdateGameSession, FAccelByteModelsV2GameSession);
+	AB_ASYNC_TASK_DECLARE_SDK_DELEGATES_WITH_RESULT(RefreshGameSession, FAccelByteModelsV2GameSession);
 
 };
@@ -102,7 +102,7 @@ void FOnlineAsyncTaskAccelByteQueryUserInfo::TriggerDelegates()
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUserInfo::OnQueryUsersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> InUsersQueried)
+void FOnlineAsyncTaskAccelByteQueryUserInfo::OnQueryUsersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> InUsersQueried, TArray<FString> FailedIds)
 {
 	if (bIsSuccessful)
 	{
@@ -112,7 +112,7 @@ void FOnlineAsyncTaskAccelByteQueryUserInfo::OnQueryUsersComplete(bool bIsSucces
 	else
 	{
 		ErrorStr = TEXT("query-users-error-response");
-		UE_LOG_AB(Warning, TEXT("Failed to query users from the backend!"));
+		UE_LOG_AB(Warning, TEXT("Failed to query users from the backend! Failed IDs: %s"), *FString::Join(FailedIds, TEXT(", ")));
 		CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
 	}
 }
@@ -49,6 +49,6 @@ private:
 	FString ErrorStr;
 
 	/** Delegate handler for when we complete a query for users from the backend */
-	void OnQueryUsersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> InUsersQueried);
+	void OnQueryUsersComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> InUsersQueried, TArray<FString> FailedIds);
 
 };
\ No newline at end of file
@@ -15,6 +15,10 @@ FOnlineAsyncTaskAccelByteQueryUserPresence::FOnlineAsyncTaskAccelByteQueryUserPr
 	, Delegate(InDelegate)
 {
 	LocalUserNum = InLocalUserNum;
+
+	// Presence is cheap to ask for again, so do not hold up whoever is waiting on it for the SDK's whole retry window.
+	// Safe as our request delegates are bound through our cancellation token.
+	SetTaskTimeout(QueryTimeoutInSeconds);
 }
 
 void FOnlineAsyncTaskAccelByteQueryUserPresence::Initialize() 
@@ -28,8 +32,8 @@ void FOnlineAsyncTaskAccelByteQueryUserPresence::Initialize()
 	UsersToQuery.Add(TargetUserId->GetAccelByteId());
 
 	// Send off the actual request to get user presence
-	THandler<FAccelByteModelsBulkUserStatusNotif> OnQueryUserPresenceSuccessDelegate = THandler<FAccelByteModelsBulkUserStatusNotif>::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUserPresence::OnQueryUserPresenceSuccess);
-	FErrorHandler OnQueryUserPresenceErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUserPresence::OnQueryUserPresenceError);
+	THandler<FAccelByteModelsBulkUserStatusNotif> OnQueryUserPresenceSuccessDelegate = MakeCancellable(THandler<FAccelByteModelsBulkUserStatusNotif>::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUserPresence::OnQueryUserPresenceSuccess));
+	FErrorHandler OnQueryUserPresenceErrorDelegate = MakeCancellable(FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUserPresence::OnQueryUserPresenceError));
 	ApiClient->Lobby.BulkGetUserPresence(UsersToQuery, OnQueryUserPresenceSuccessDelegate, OnQueryUserPresenceErrorDelegate, false);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
@@ -93,4 +97,15 @@ void FOnlineAsyncTaskAccelByteQueryUserPresence::OnQueryUserPresenceSuccess(cons
 	{
 		AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 	}
-}
\ No newline at end of file
+}
+
+void FOnlineAsyncTaskAccelByteQueryUserPresence::AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary)
+{
+	Super::AdoptResultsFrom(Primary);
+	LocalCachedPresence = static_cast<const FOnlineAsyncTaskAccelByteQueryUserPresence&>(Primary).LocalCachedPresence;
+}
+
+FString FOnlineAsyncTaskAccelByteQueryUserPresence::GetDeduplicationArguments() const
+{
+	return FString::Printf(TEXT("%d|%s"), LocalUserNum, *TargetUserId->GetAccelByteId());
+}
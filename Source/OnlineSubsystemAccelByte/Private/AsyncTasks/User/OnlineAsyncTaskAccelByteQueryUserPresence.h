@@ -18,6 +18,7 @@ public:
 	virtual void Initialize() override;
 	virtual void Finalize() override;
 	virtual void TriggerDelegates() override;
+	virtual void AdoptResultsFrom(const FOnlineAsyncTaskAccelByte& Primary) override;
 
 protected:
 
@@ -25,8 +26,13 @@ protected:
 		return TEXT("FOnlineAsyncTaskAccelByteQueryUserPresence");
 	}
 
+	virtual FString GetDeduplicationArguments() const override;
+
 private:
 
+	/** Time in seconds to wait for a presence response before giving up */
+	static constexpr double QueryTimeoutInSeconds = 10.0;
+
 	/** UserId of the friend we want to get the presence for */
 	TSharedRef<const FUniqueNetIdAccelByteUser> TargetUserId;
 
@@ -15,14 +15,17 @@
 FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByIds
 	( FOnlineSubsystemAccelByte* const InABSubsystem
 	, int32 InLocalUserNum
-	, const TArray<FString>& AccelByteIds
+	, TArray<FString> AccelByteIds
 	, bool InBIsImportant
-	, const FOnQueryUsersComplete& InDelegate )
+	, const FOnQueryUsersComplete& InDelegate
+	, bool bInRefreshStaleUsers )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(ACCELBYTE_QUERY_TYPE)
-	, UserIds(AccelByteIds)
+	, UserIds(MoveTemp(AccelByteIds))
 	, bIsImportant(InBIsImportant)
+	, bRefreshStaleUsers(bInRefreshStaleUsers)
 	, Delegate(InDelegate)
+	, PendingQuery(MakeShared<FAccelBytePendingUserQuery, ESPMode::ThreadSafe>())
 {
 	LocalUserNum = InLocalUserNum;
 }
@@ -31,14 +34,15 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 	( FOnlineSubsystemAccelByte* const InABSubsystem
 	, int32 InLocalUserNum
 	, const FString InPlatformType
-	, const TArray<FString>& PlatformIds
+	, TArray<FString> PlatformIds
 	, bool InBIsImportant
 	, const FOnQueryUsersComplete& InDelegate )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(InPlatformType)
-	, UserIds(PlatformIds)
+	, UserIds(MoveTemp(PlatformIds))
 	, bIsImportant(InBIsImportant)
 	, Delegate(InDelegate)
+	, PendingQuery(MakeShared<FAccelBytePendingUserQuery, ESPMode::ThreadSafe>())
 {
 	LocalUserNum = InLocalUserNum;
 }
@@ -46,14 +50,15 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByIds
 	( FOnlineSubsystemAccelByte* const InABSubsystem
 	, const FUniqueNetId& InUserId
-	, const TArray<FString>& AccelByteIds
+	, TArray<FString> AccelByteIds
 	, bool InBIsImportant
 	, const FOnQueryUsersComplete& InDelegate )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(ACCELBYTE_QUERY_TYPE)
-	, UserIds(AccelByteIds)
+	, UserIds(MoveTemp(AccelByteIds))
 	, bIsImportant(InBIsImportant)
 	, Delegate(InDelegate)
+	, PendingQuery(MakeShared<FAccelBytePendingUserQuery, ESPMode::ThreadSafe>())
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InUserId.AsShared());
 }
@@ -62,14 +67,15 @@ FOnlineAsyncTaskAccelByteQueryUsersByIds::FOnlineAsyncTaskAccelByteQueryUsersByI
 	( FOnlineSubsystemAccelByte* const InABSubsystem
 	, const FUniqueNetId& InUserId
 	, const FString InPlatformType
-	, const TArray<FString>& PlatformIds
+	, TArray<FString> PlatformIds
 	, bool InBIsImportant
 	, const FOnQueryUsersComplete& InDelegate )
 	: FOnlineAsyncTaskAccelByte(InABSubsystem, true)
 	, PlatformType(InPlatformType)
-	, UserIds(PlatformIds)
+	, UserIds(MoveTemp(PlatformIds))
 	, bIsImportant(InBIsImportant)
 	, Delegate(InDelegate)
+	, PendingQuery(MakeShared<FAccelBytePendingUserQuery, ESPMode::ThreadSafe>())
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InUserId.AsShared());
 }
@@ -87,6 +93,16 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Initialize()
 		return;
 	}
 
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("UserQueryChunkSize"), ChunkSize, GEngineIni);
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("MaxConcurrentUserQueryChunks"), MaxConcurrentChunks, GEngineIni);
+	ChunkSize = FMath::Max(ChunkSize, 1);
+	MaxConcurrentChunks = FMath::Max(MaxConcurrentChunks, 1);
+
+	// Users we attach to from other queries in flight are resolved by those queries, so have them wake us once they are
+	PendingQuery->SetOnResolved([TaskWakeHandle = WakeHandle]() {
+		TaskWakeHandle->RequestTick();
+	});
+
 	// If these are already AccelByte IDs, then we just want to run a bulk query for the users
 	if (PlatformType == ACCELBYTE_QUERY_TYPE)
 	{
@@ -94,12 +110,9 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Initialize()
 	}
 	else
 	{
-		EAccelBytePlatformType ABPlatformType;
 		if (Subsystem->GetAccelBytePlatformTypeFromAuthType(PlatformType, ABPlatformType))
 		{
-			const THandler<FBulkPlatformUserIdResponse> OnBulkGetUserSuccess = THandler<FBulkPlatformUserIdResponse>::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess);
-			const FErrorHandler OnBulkGetUserError = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError);
-			ApiClient->User.BulkGetUserByOtherPlatformUserIds(ABPlatformType, UserIds, OnBulkGetUserSuccess, OnBulkGetUserError);
+			StartChunkedRequests(EQueryChunkPhase::PlatformMappings, UserIds);
 		}
 	}
 
@@ -110,8 +123,22 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Tick()
 {
 	Super::Tick();
 
-	if (bHasQueriedBasicUserInfo && bHasQueriedUserPlatformInfo)
+	// Wait on both our own queries and any users we attached to from other queries in flight
+	if (bHasQueriedBasicUserInfo && bHasQueriedUserPlatformInfo && PendingQuery->IsResolved())
 	{
+		if (PendingQuery->HasFailure())
+		{
+			const TArray<FString> WaitedOnFailedIds = PendingQuery->GetFailedIds();
+			UE_LOG_AB(Warning, TEXT("Failed to get basic user information as a query we were waiting on failed to fetch %d of our users!"), WaitedOnFailedIds.Num());
+			{
+				FScopeLock ScopeLock(&ChunkLock);
+				FailedIds.Append(WaitedOnFailedIds);
+			}
+			CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+			return;
+		}
+
+		UsersCached.Append(PendingQuery->GetResolvedUsers());
 		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
 	}
 }
@@ -120,14 +147,9 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::Finalize()
 {
 	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("bWasSuccessful: %s"), LOG_BOOL_FORMAT(bWasSuccessful));
 
-	if (bWasSuccessful)
-	{
-		FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
-		if (UserCache.IsValid())
-		{
-			UserCache->AddUsersToCache(UsersQueried);
-		}
-	}
+	// Users are added to the cache as soon as they are fetched, this just makes sure that nothing we claimed is left
+	// in flight if we timed out or failed before our query came back
+	ResolvePendingUsers(UsersToQuery, TArray<TSharedRef<FAccelByteUserInfo>>(), false);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
@@ -147,37 +169,158 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::TriggerDelegates()
 	}
 
 	// Fire off the delegate
-	Delegate.ExecuteIfBound(bWasSuccessful, ReturnUsers);
+	Delegate.ExecuteIfBound(bWasSuccessful, ReturnUsers, FailedIds);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::StartChunkedRequests(EQueryChunkPhase InPhase, const TArray<FString>& Ids)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Mappings found: %d"), Result.UserIdPlatforms.Num());
+	{
+		FScopeLock ScopeLock(&ChunkLock);
+		ChunkPhase = InPhase;
+		Chunks.Reset();
+		for (int32 ChunkStart = 0; ChunkStart < Ids.Num(); ChunkStart += ChunkSize)
+		{
+			Chunks.Emplace(Ids.GetData() + ChunkStart, FMath::Min(ChunkSize, Ids.Num() - ChunkStart));
+		}
+		NextChunkIndex = 0;
+		NumChunksInFlight = 0;
+		NumChunksRemaining = Chunks.Num();
+		NumChunksFailed = 0;
+	}
 
-	if (Result.UserIdPlatforms.Num() > 0)
+	SendPendingChunks();
+}
+
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::SendPendingChunks()
+{
+	// Claim as many chunks as we have room for, then send them once we no longer hold the lock, as a request may
+	// complete synchronously and call back into us
+	TArray<int32> ChunksToSend;
 	{
-		TArray<FString> AccelByteIds;
-		for (const FPlatformUserIdMap& UserIdMapping : Result.UserIdPlatforms)
+		FScopeLock ScopeLock(&ChunkLock);
+		while (NextChunkIndex < Chunks.Num() && NumChunksInFlight < MaxConcurrentChunks)
 		{
-			AccelByteIds.Add(UserIdMapping.UserId);
+			ChunksToSend.Add(NextChunkIndex++);
+			NumChunksInFlight++;
 		}
+	}
+
+	for (const int32 ChunkIndex : ChunksToSend)
+	{
+		SendChunk(ChunkIndex);
+	}
+}
 
-		GetBasicUserInfo(AccelByteIds);
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::SendChunk(int32 ChunkIndex)
+{
+	// Chunks go out in waves that can outlast a single request, so every handler goes through our cancellation token to
+	// be dropped safely should the task time out or complete while a chunk is still in flight
+	if (ChunkPhase == EQueryChunkPhase::PlatformMappings)
+	{
+		const THandler<FBulkPlatformUserIdResponse> OnBulkGetUserSuccess = MakeCancellable(THandler<FBulkPlatformUserIdResponse>::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess, ChunkIndex));
+		const FErrorHandler OnBulkGetUserError = MakeCancellable(FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError, ChunkIndex));
+		Subsystem->GetBackend()->BulkGetUserByOtherPlatformUserIds(ApiClient, ABPlatformType, Chunks[ChunkIndex], OnBulkGetUserSuccess, OnBulkGetUserError);
 	}
 	else
 	{
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		const THandler<FListBulkUserInfo> OnBulkGetBasicUserInfoSuccessDelegate = MakeCancellable(THandler<FListBulkUserInfo>::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoSuccess, ChunkIndex));
+		const FErrorHandler OnBulkGetBasicUserInfoErrorDelegate = MakeCancellable(FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoError, ChunkIndex));
+		Subsystem->GetBackend()->BulkGetUserInfo(ApiClient, Chunks[ChunkIndex], OnBulkGetBasicUserInfoSuccessDelegate, OnBulkGetBasicUserInfoErrorDelegate);
 	}
+}
+
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnChunkComplete(bool bWasChunkSuccessful)
+{
+	bool bIsPhaseComplete = false;
+	int32 NumChunks = 0;
+	int32 NumFailed = 0;
+
+	// Each chunk that comes back shows the task is still making progress, so push back its timeout
+	SetLastUpdateTimeToCurrentTime();
+
+	{
+		FScopeLock ScopeLock(&ChunkLock);
+		NumChunksInFlight--;
+		NumChunksRemaining--;
+		if (!bWasChunkSuccessful)
+		{
+			NumChunksFailed++;
+		}
+
+		bIsPhaseComplete = NumChunksRemaining <= 0;
+		NumChunks = Chunks.Num();
+		NumFailed = NumChunksFailed;
+	}
+
+	if (!bIsPhaseComplete)
+	{
+		SendPendingChunks();
+		return;
+	}
+
+	// Every chunk has resolved its own users by now, so waiters on chunks that succeeded still get their users even
+	// though this query fails as a whole
+	if (NumFailed > 0)
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to query users as %d of %d chunks failed!"), NumFailed, NumChunks);
+		CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+		return;
+	}
+
+	if (ChunkPhase == EQueryChunkPhase::PlatformMappings)
+	{
+		if (MappedAccelByteIds.Num() <= 0)
+		{
+			CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		}
+		else
+		{
+			GetBasicUserInfo(MappedAccelByteIds);
+		}
+		return;
+	}
+
+	if (NativePlatformIdsToQuery.Num() > 0)
+	{
+		QueryUsersOnNativePlatform(NativePlatformIdsToQuery);
+	}
+	else
+	{
+		// Just set this flag to true so that we aren't waiting on it
+		bHasQueriedUserPlatformInfo = true;
+	}
+
+	bHasQueriedBasicUserInfo = true;
+	RequestTick();
+}
+
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result, int32 ChunkIndex)
+{
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("Mappings found: %d; Chunk: %d"), Result.UserIdPlatforms.Num(), ChunkIndex);
+
+	{
+		FScopeLock ScopeLock(&ChunkLock);
+		for (const FPlatformUserIdMap& UserIdMapping : Result.UserIdPlatforms)
+		{
+			MappedAccelByteIds.Add(UserIdMapping.UserId);
+		}
+	}
+
+	OnChunkComplete(true);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex)
 {
-	UE_LOG_AB(Warning, TEXT("Could not query for AccelByte IDs from %s platform IDs in bulk! Error code: %d; Error message: %s"), *PlatformType, ErrorCode, *ErrorMessage);
-	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+	UE_LOG_AB(Warning, TEXT("Could not query for AccelByte IDs from %s platform IDs in bulk for chunk %d of %d (%d IDs)! Error code: %d; Error message: %s"), *PlatformType, ChunkIndex + 1, Chunks.Num(), Chunks[ChunkIndex].Num(), ErrorCode, *ErrorMessage);
+	{
+		FScopeLock ScopeLock(&ChunkLock);
+		FailedIds.Append(Chunks[ChunkIndex]);
+	}
+	OnChunkComplete(false);
 }
 
 void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetBasicUserInfo(const TArray<FString>& AccelByteIds)
@@ -199,27 +342,31 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::GetBasicUserInfo(const TArray<FSt
 		return;
 	}
 
-	// Get users that we already have cached and users that we need to query, filters from the AccelByteIds array
-	UserCache->GetQueryAndCacheArrays(AccelByteIds, UsersToQuery, UsersCached);
+	// Get users that we already have cached and users that we need to query, filters from the AccelByteIds array. Users
+	// that another query is already fetching are left out of both, and we wait on that query's result instead.
+	UserCache->GetQueryAndCacheArrays(PendingQuery, AccelByteIds, UsersToQuery, UsersCached, bRefreshStaleUsers);
 
-	// This means these users are already in the cache, so we can just skip the query and successfully complete
+	// This means these users are already in the cache or in flight, so we can just skip the query and complete once any
+	// users we are waiting on have been resolved
 	if (UsersToQuery.Num() <= 0)
 	{
-		CompleteTask(EAccelByteAsyncTaskCompleteState::Success);
+		bHasQueriedBasicUserInfo = true;
+		bHasQueriedUserPlatformInfo = true;
+		AB_OSS_ASYNC_TASK_TRACE_END(TEXT("All users cached or already in flight, skipping query"));
 		return;
 	}
 
-	const THandler<FListBulkUserInfo> OnBulkGetBasicUserInfoSuccessDelegate = THandler<FListBulkUserInfo>::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoSuccess);
-	const FErrorHandler OnBulkGetBasicUserInfoErrorDelegate = FErrorHandler::CreateRaw(this, &FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoError);
-	ApiClient->User.BulkGetUserInfo(UsersToQuery, OnBulkGetBasicUserInfoSuccessDelegate, OnBulkGetBasicUserInfoErrorDelegate);
+	// Split the users into chunks that the backend will accept in one call, and run a bounded number of them at once
+	StartChunkedRequests(EQueryChunkPhase::BasicUserInfo, UsersToQuery);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoSuccess(const FListBulkUserInfo& Result)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoSuccess(const FListBulkUserInfo& Result, int32 ChunkIndex)
 {
-	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("User information received: %d"), Result.Data.Num());
+	AB_OSS_ASYNC_TASK_TRACE_BEGIN(TEXT("User information received: %d; Chunk: %d"), Result.Data.Num(), ChunkIndex);
 
+	TArray<TSharedRef<FAccelByteUserInfo>> ChunkUsersQueried;
 	TArray<TSharedRef<const FUniqueNetId>> PlatformIdsToQuery;
 	for (const FBaseUserInfo& BasicInfo : Result.Data)
 	{
@@ -237,7 +384,7 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoSuccess(const F
 		User->Id = FUniqueNetIdAccelByteUser::Create(CompositeId);
 
 		// Add the user to our successful queries
-		UsersQueried.Add(User);
+		ChunkUsersQueried.Add(User);
 
 		// Also query the user on the native platform, if we have their platform information
 		TSharedPtr<const FUniqueNetId> PlatformUniqueId = User->Id->GetPlatformUniqueId();
@@ -247,25 +394,36 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoSuccess(const F
 		}
 	}
 
-	if (PlatformIdsToQuery.Num() > 0)
-	{
-		QueryUsersOnNativePlatform(PlatformIdsToQuery);
-	}
-	else
 	{
-		// Just set this flag to true so that we aren't waiting on it
-		bHasQueriedUserPlatformInfo = true;
+		FScopeLock ScopeLock(&ChunkLock);
+		UsersQueried.Append(ChunkUsersQueried);
+		NativePlatformIdsToQuery.Append(PlatformIdsToQuery);
 	}
 
-	bHasQueriedBasicUserInfo = true;
+	ResolvePendingUsers(Chunks[ChunkIndex], ChunkUsersQueried, true);
+	OnChunkComplete(true);
 
 	AB_OSS_ASYNC_TASK_TRACE_END(TEXT(""));
 }
 
-void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoError(int32 ErrorCode, const FString& ErrorMessage)
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::OnGetBasicUserInfoError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex)
 {
-	UE_LOG_AB(Warning, TEXT("Failed to get basic user information from backend! Error code: %d; Error message: %s"), ErrorCode, *ErrorMessage);
-	CompleteTask(EAccelByteAsyncTaskCompleteState::RequestFailed);
+	UE_LOG_AB(Warning, TEXT("Failed to get basic user information from backend for chunk %d of %d (%d IDs)! Error code: %d; Error message: %s"), ChunkIndex + 1, Chunks.Num(), Chunks[ChunkIndex].Num(), ErrorCode, *ErrorMessage);
+	{
+		FScopeLock ScopeLock(&ChunkLock);
+		FailedIds.Append(Chunks[ChunkIndex]);
+	}
+	ResolvePendingUsers(Chunks[ChunkIndex], TArray<TSharedRef<FAccelByteUserInfo>>(), false);
+	OnChunkComplete(false);
+}
+
+void FOnlineAsyncTaskAccelByteQueryUsersByIds::ResolvePendingUsers(const TArray<FString>& AccelByteIds, const TArray<TSharedRef<FAccelByteUserInfo>>& Users, bool bWasQuerySuccessful)
+{
+	const FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
+	if (UserCache.IsValid())
+	{
+		UserCache->ResolvePendingUsers(PendingQuery, AccelByteIds, Users, bWasQuerySuccessful);
+	}
 }
 
 void FOnlineAsyncTaskAccelByteQueryUsersByIds::QueryUsersOnNativePlatform(const TArray<TSharedRef<const FUniqueNetId>>& PlatformUniqueIds)
@@ -286,4 +444,5 @@ void FOnlineAsyncTaskAccelByteQueryUsersByIds::QueryUsersOnNativePlatform(const
 	// of these so this can just be a fire and forget
 	NativeUserInterface->QueryUserInfo(LocalUserNum, PlatformUniqueIds);
 	bHasQueriedUserPlatformInfo = true;
+	RequestTick();
 }
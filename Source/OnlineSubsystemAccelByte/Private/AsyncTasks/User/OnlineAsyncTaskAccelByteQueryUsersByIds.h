@@ -10,29 +10,35 @@
 
 /**
  * Task to query a bulk of users by AccelByte or platform IDs, will add these users to the user cache.
+ * 
+ * IDs are sent to the backend in chunks. The query is all or nothing: if any chunk fails, or another query that we
+ * were waiting on fails to fetch some of our users, the whole query fails and the IDs that could not be fetched are
+ * handed to the delegate. Users from chunks that succeeded are still added to the cache.
  */
 class FOnlineAsyncTaskAccelByteQueryUsersByIds : public FOnlineAsyncTaskAccelByte
 {
 public:
 	/**
 	 * Queries a bulk of AccelByte IDs using a local user index
+	 * 
+	 * @param bInRefreshStaleUsers Whether users that are cached but stale should be fetched again rather than served
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const TArray<FString>& AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, TArray<FString> AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate, bool bInRefreshStaleUsers = false);
 	
 	/**
 	 * Queries a bulk of platform IDs to attempt to get AccelByte accounts using a local user index
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const FString InPlatformType, const TArray<FString>& PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, int32 InLocalUserNum, const FString InPlatformType, TArray<FString> PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
 
 	/**
 	 * Queries a bulk of AccelByte IDs using a user ID
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, const TArray<FString>& AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, TArray<FString> AccelByteIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
 
 	/**
 	 * Queries a bulk of platform IDs to attempt to get AccelByte accounts using a user ID
 	 */
-	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, const FString InPlatformType, const TArray<FString>& PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
+	FOnlineAsyncTaskAccelByteQueryUsersByIds(FOnlineSubsystemAccelByte* const InABSubsystem, const FUniqueNetId& InUserId, const FString InPlatformType, TArray<FString> PlatformIds, bool InBIsImportant, const FOnQueryUsersComplete& InDelegate);
 
 	virtual void Initialize() override;
 	virtual void Tick() override;
@@ -48,6 +54,15 @@ protected:
 
 private:
 
+	/**
+	 * Which set of bulk requests our chunks currently belong to
+	 */
+	enum class EQueryChunkPhase : uint8
+	{
+		PlatformMappings,
+		BasicUserInfo
+	};
+
 	/**
 	 * Type of platform that we are querying these users from.
 	 * Will be set to ACCELBYTE if these are all AccelByte IDs, or the specific platform name otherwise.
@@ -59,11 +74,21 @@ private:
 	 */
 	TArray<FString> UserIds;
 
+	/**
+	 * AccelByte platform type that the platform IDs we are querying belong to, if we are not querying AccelByte IDs
+	 */
+	EAccelBytePlatformType ABPlatformType;
+
 	/**
 	 * Whether all of these users that we are querying will be marked as important.
 	 */
 	bool bIsImportant;
 
+	/**
+	 * Whether users that are cached but stale should be fetched again rather than served from the cache
+	 */
+	bool bRefreshStaleUsers = false;
+
 	/**
 	 * Delegate that will be fired once the queries complete
 	 */
@@ -84,6 +109,74 @@ private:
 	 */
 	TArray<TSharedRef<FAccelByteUserInfo>> UsersCached;
 
+	/**
+	 * State shared with the user cache for users that this query is fetching, or waiting on another query to fetch
+	 */
+	FAccelBytePendingUserQueryRef PendingQuery;
+
+	/**
+	 * Maximum number of IDs sent to the backend in a single bulk request. Configured with `UserQueryChunkSize` in the
+	 * `OnlineSubsystemAccelByte` settings.
+	 */
+	int32 ChunkSize = 100;
+
+	/**
+	 * Maximum number of chunk requests in flight at once. Configured with `MaxConcurrentUserQueryChunks` in the
+	 * `OnlineSubsystemAccelByte` settings.
+	 */
+	int32 MaxConcurrentChunks = 4;
+
+	/**
+	 * Lock guarding chunk bookkeeping and results merged from chunk responses, as chunks may complete on other threads
+	 */
+	FCriticalSection ChunkLock;
+
+	/**
+	 * Set of bulk requests that the current chunks belong to
+	 */
+	EQueryChunkPhase ChunkPhase = EQueryChunkPhase::BasicUserInfo;
+
+	/**
+	 * IDs for the current phase, split into chunks of at most ChunkSize
+	 */
+	TArray<TArray<FString>> Chunks;
+
+	/**
+	 * Index of the next chunk to send
+	 */
+	int32 NextChunkIndex = 0;
+
+	/**
+	 * Number of chunks that have been sent and not yet completed
+	 */
+	int32 NumChunksInFlight = 0;
+
+	/**
+	 * Number of chunks in the current phase that have not yet completed
+	 */
+	int32 NumChunksRemaining = 0;
+
+	/**
+	 * Number of chunks in the current phase that failed
+	 */
+	int32 NumChunksFailed = 0;
+
+	/**
+	 * IDs from chunks that failed, or that other queries failed to fetch for us. Platform IDs if the platform mapping
+	 * phase failed, otherwise AccelByte IDs.
+	 */
+	TArray<FString> FailedIds;
+
+	/**
+	 * AccelByte IDs merged from platform mapping chunks
+	 */
+	TArray<FString> MappedAccelByteIds;
+
+	/**
+	 * Platform IDs merged from basic user info chunks, to query on the native platform once all chunks complete
+	 */
+	TArray<TSharedRef<const FUniqueNetId>> NativePlatformIdsToQuery;
+
 	/**
 	 * Flag representing whether we have finished querying basic user info
 	 */
@@ -95,14 +188,34 @@ private:
 	FThreadSafeBool bHasQueriedUserPlatformInfo = false;
 
 	/**
-	 * Delegate handler for when querying platform ID mappings in bulk succeeds
+	 * Split IDs into chunks for the given phase and start sending them
+	 */
+	void StartChunkedRequests(EQueryChunkPhase InPhase, const TArray<FString>& Ids);
+
+	/**
+	 * Send as many unsent chunks as we have room for under MaxConcurrentChunks
+	 */
+	void SendPendingChunks();
+
+	/**
+	 * Send a single chunk's bulk request for the current phase
+	 */
+	void SendChunk(int32 ChunkIndex);
+
+	/**
+	 * Record that a chunk has completed, sending the next chunk or moving on once every chunk in the phase is done
+	 */
+	void OnChunkComplete(bool bWasChunkSuccessful);
+
+	/**
+	 * Delegate handler for when querying platform ID mappings in bulk succeeds for a chunk
 	 */
-	void OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result);
+	void OnBulkQueryPlatformIdMappingsSuccess(const FBulkPlatformUserIdResponse& Result, int32 ChunkIndex);
 
 	/**
-	 * Delegate handler for when querying platform ID mappings in bulk fails
+	 * Delegate handler for when querying platform ID mappings in bulk fails for a chunk
 	 */
-	void OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage);
+	void OnBulkQueryPlatformIdMappingsError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex);
 
 	/**
 	 * Calls method to get basic user information by an array of AccelByte IDs
@@ -110,14 +223,19 @@ private:
 	void GetBasicUserInfo(const TArray<FString>& AccelByteIds);
 
 	/**
-	 * Delegate handler for when querying basic user information by AccelByte IDs succeeds
+	 * Delegate handler for when querying basic user information by AccelByte IDs succeeds for a chunk
+	 */
+	void OnGetBasicUserInfoSuccess(const FListBulkUserInfo& Result, int32 ChunkIndex);
+
+	/**
+	 * Delegate handler for when querying basic user information by AccelByte IDs fails for a chunk
 	 */
-	void OnGetBasicUserInfoSuccess(const FListBulkUserInfo& Result);
+	void OnGetBasicUserInfoError(int32 ErrorCode, const FString& ErrorMessage, int32 ChunkIndex);
 
 	/**
-	 * Delegate handler for when querying basic user information by platform IDs fails
+	 * Mark users that this query was fetching as no longer in flight, handing results to queries waiting on them
 	 */
-	void OnGetBasicUserInfoError(int32 ErrorCode, const FString& ErrorMessage);
+	void ResolvePendingUsers(const TArray<FString>& AccelByteIds, const TArray<TSharedRef<FAccelByteUserInfo>>& Users, bool bWasQuerySuccessful);
 
 	/**
 	 * Make a call to query the user manually on the platform that corresponds to the one we are currently on
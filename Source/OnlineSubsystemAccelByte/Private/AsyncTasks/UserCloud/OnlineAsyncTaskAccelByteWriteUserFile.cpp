@@ -8,10 +8,10 @@
 #include "Core/AccelByteRegistry.h"
 #include "Api/AccelByteCloudStorageApi.h"
 
-FOnlineAsyncTaskAccelByteWriteUserFile::FOnlineAsyncTaskAccelByteWriteUserFile(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InUserId, const FString& InFileName, const TArray<uint8>& InFileContents, bool InBCompressBeforeUpload)
+FOnlineAsyncTaskAccelByteWriteUserFile::FOnlineAsyncTaskAccelByteWriteUserFile(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InUserId, const FString& InFileName, TArray<uint8> InFileContents, bool InBCompressBeforeUpload)
 	: FOnlineAsyncTaskAccelByte(InABInterface, true)
 	, FileName(InFileName)
-	, FileContents(InFileContents)
+	, FileContents(MoveTemp(InFileContents))
 	, bCompressBeforeUpload(InBCompressBeforeUpload)
 {
 	UserId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(InUserId.AsShared());
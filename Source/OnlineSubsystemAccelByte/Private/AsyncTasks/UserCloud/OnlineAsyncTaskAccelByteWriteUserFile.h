@@ -13,7 +13,7 @@ class FOnlineAsyncTaskAccelByteWriteUserFile : public FOnlineAsyncTaskAccelByte
 {
 public:
 
-	FOnlineAsyncTaskAccelByteWriteUserFile(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InUserId, const FString& InFileName, const TArray<uint8>& InFileContents, bool InBCompressBeforeUpload);
+	FOnlineAsyncTaskAccelByteWriteUserFile(FOnlineSubsystemAccelByte* const InABInterface, const FUniqueNetId& InUserId, const FString& InFileName, TArray<uint8> InFileContents, bool InBCompressBeforeUpload);
 
 	virtual void Initialize() override;
 	virtual void Finalize() override;
@@ -54,6 +54,11 @@ public:
 	 */
 	virtual bool Run() { return true; };
 
+	/**
+	 * Ticked by the subsystem on the game thread until the test is complete, for tests that need to poll for progress.
+	 */
+	virtual void Tick(float DeltaTime) {};
+
 protected:
 
 	/** World associated with this exec test */
@@ -0,0 +1,303 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "ExecTestBenchmarkFakeBackend.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_OSS_FAKE_BACKEND_ENABLED
+
+#include "OnlineSubsystemUtils.h"
+#include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineAsyncTaskMetricsAccelByte.h"
+#include "AsyncTasks/PartyV1/OnlineAsyncTaskAccelByteUpdateV1PartyData.h"
+
+namespace
+{
+	/** Number of friends looked up along with each user on login */
+	constexpr int32 FriendsPerUser = 20;
+
+	/** Most game sessions returned to each user's session search */
+	constexpr int32 SearchResultsPerUser = 20;
+
+	/** Number of made up game sessions that the fake backend pages through */
+	constexpr int32 NumScriptedGameSessions = 200;
+
+	/** Number of users started on each tick, to ramp load up rather than dispatching everything in a single frame */
+	constexpr int32 UsersStartedPerTick = 100;
+
+	/** Time after which the run gives up on users that have yet to finish */
+	constexpr double RunTimeoutSeconds = 300.0;
+
+	FString MakeFakeAccelByteId()
+	{
+		return FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+	}
+
+	double GetPercentile(const TArray<double>& SortedSeconds, double Percentile)
+	{
+		if (SortedSeconds.Num() == 0)
+		{
+			return 0.0;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedSeconds.Num()) - 1, 0, SortedSeconds.Num() - 1);
+		return SortedSeconds[Index];
+	}
+}
+
+FExecTestBenchmarkFakeBackend::FExecTestBenchmarkFakeBackend(UWorld* InWorld, const FName& InSubsystemName, int32 InNumUsers, float InLatencyMs, float InErrorPercent)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, NumUsers(FMath::Max(InNumUsers, 1))
+	, LatencyMs(FMath::Max(InLatencyMs, 0.0f))
+	, ErrorPercent(FMath::Clamp(InErrorPercent, 0.0f, 100.0f))
+{
+}
+
+bool FExecTestBenchmarkFakeBackend::Run()
+{
+	Subsystem = static_cast<FOnlineSubsystemAccelByte*>(Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr || !Subsystem->GetUserCache().IsValid())
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to run fake backend benchmark as the subsystem is not available!"));
+		bIsComplete = true;
+		return false;
+	}
+
+	const double LatencySeconds = LatencyMs / 1000.0;
+	FakeBackend = MakeShared<FOnlineFakeBackendAccelByte, ESPMode::ThreadSafe>(Subsystem);
+	FakeBackend->SetAllSettings(LatencySeconds * 0.5, LatencySeconds * 1.5, ErrorPercent / 100.0f);
+	FakeBackend->SetNumScriptedGameSessions(NumScriptedGameSessions);
+
+	PreviousBackend = Subsystem->GetBackend();
+	Subsystem->SetBackend(FakeBackend);
+
+	const FOnlineAsyncTaskMetricsAccelBytePtr Metrics = Subsystem->GetAsyncTaskMetrics();
+	if (Metrics.IsValid())
+	{
+		Metrics->Reset();
+	}
+
+	Users.SetNum(NumUsers);
+	for (int32 UserIndex = 0; UserIndex < NumUsers; UserIndex++)
+	{
+		FSimulatedUser& User = Users[UserIndex];
+		User.UserId = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(MakeFakeAccelByteId()));
+		User.PartyId = MakeShared<FOnlinePartyIdAccelByte>(MakeFakeAccelByteId());
+	}
+
+	LoginLatencies.Seconds.Reserve(NumUsers);
+	MatchmakingLatencies.Seconds.Reserve(NumUsers);
+	FlowLatencies.Seconds.Reserve(NumUsers);
+	FakeAccelByteIds.Reserve(NumUsers * (FriendsPerUser + 1));
+
+	UE_LOG_AB(Log, TEXT("Starting fake backend benchmark with %d user(s), %.0f ms average latency, %.1f%% errors"), NumUsers, LatencyMs, ErrorPercent);
+	RunStartTime = FPlatformTime::Seconds();
+	return true;
+}
+
+void FExecTestBenchmarkFakeBackend::Tick(float DeltaTime)
+{
+	const int32 LastUserIndex = FMath::Min(NextUserIndex + UsersStartedPerTick, NumUsers);
+	for (; NextUserIndex < LastUserIndex; NextUserIndex++)
+	{
+		StartUser(NextUserIndex);
+	}
+
+	// Session searches have no delegate of their own to wait on, so poll each search still in flight
+	for (int32 UserIndex = 0; UserIndex < NextUserIndex; UserIndex++)
+	{
+		const FSimulatedUser& User = Users[UserIndex];
+		if (User.Step != EUserStep::Matchmaking || !User.SessionSearch.IsValid())
+		{
+			continue;
+		}
+
+		const EOnlineAsyncTaskState::Type SearchState = User.SessionSearch->SearchState;
+		if (SearchState == EOnlineAsyncTaskState::Done || SearchState == EOnlineAsyncTaskState::Failed)
+		{
+			FinishUser(UserIndex, SearchState == EOnlineAsyncTaskState::Done);
+		}
+	}
+
+	// Wait for party writes and notifications still held by the fake backend as well, so they count towards the run
+	if (NumUsersDone >= NumUsers && FakeBackend->GetNumPendingResponses() == 0)
+	{
+		FinishRun(false);
+	}
+	else if (FPlatformTime::Seconds() - RunStartTime > RunTimeoutSeconds)
+	{
+		FinishRun(true);
+	}
+}
+
+void FExecTestBenchmarkFakeBackend::StartUser(int32 UserIndex)
+{
+	FSimulatedUser& User = Users[UserIndex];
+	User.Step = EUserStep::Login;
+	User.StartTime = FPlatformTime::Seconds();
+	User.StepStartTime = User.StartTime;
+
+	TArray<FString> AccelByteIds;
+	AccelByteIds.Reserve(FriendsPerUser + 1);
+	AccelByteIds.Add(User.UserId->GetAccelByteId());
+	for (int32 FriendIndex = 0; FriendIndex < FriendsPerUser; FriendIndex++)
+	{
+		AccelByteIds.Add(MakeFakeAccelByteId());
+	}
+	FakeAccelByteIds.Append(AccelByteIds);
+
+	const FOnQueryUsersComplete OnQueryUsersCompleteDelegate = FOnQueryUsersComplete::CreateSP(AsShared(), &FExecTestBenchmarkFakeBackend::OnLoginQueryComplete, UserIndex);
+	if (!Subsystem->GetUserCache()->QueryUsersByAccelByteIds(TEST_USER_INDEX, AccelByteIds, OnQueryUsersCompleteDelegate))
+	{
+		LoginLatencies.NumFailed++;
+		FinishUser(UserIndex, false);
+	}
+}
+
+void FExecTestBenchmarkFakeBackend::OnLoginQueryComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds, int32 UserIndex)
+{
+	if (!Users.IsValidIndex(UserIndex) || Users[UserIndex].Step != EUserStep::Login)
+	{
+		return;
+	}
+
+	const FSimulatedUser& User = Users[UserIndex];
+	if (!bIsSuccessful)
+	{
+		LoginLatencies.NumFailed++;
+		FinishUser(UserIndex, false);
+		return;
+	}
+
+	LoginLatencies.Seconds.Add(FPlatformTime::Seconds() - User.StepStartTime);
+	StartPartyAndMatchmaking(UserIndex);
+}
+
+void FExecTestBenchmarkFakeBackend::StartPartyAndMatchmaking(int32 UserIndex)
+{
+	FSimulatedUser& User = Users[UserIndex];
+	User.Step = EUserStep::Matchmaking;
+	User.StepStartTime = FPlatformTime::Seconds();
+
+	FOnlinePartyData PartyData;
+	PartyData.SetAttribute(FString::Printf(TEXT("Member_%s"), *User.UserId->GetAccelByteId()), FVariantData(TEXT("Ready")));
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdateV1PartyData>(Subsystem, *User.UserId, *User.PartyId, NAME_None, PartyData);
+
+#if AB_USE_V2_SESSIONS
+	const IOnlineSessionPtr SessionInterface = Subsystem->GetSessionInterface();
+	if (SessionInterface.IsValid())
+	{
+		User.SessionSearch = MakeShared<FOnlineSessionSearch>();
+		User.SessionSearch->MaxSearchResults = SearchResultsPerUser;
+		if (SessionInterface->FindSessions(*User.UserId, User.SessionSearch.ToSharedRef()))
+		{
+			return;
+		}
+	}
+
+	User.SessionSearch.Reset();
+	MatchmakingLatencies.NumFailed++;
+	FinishUser(UserIndex, false);
+#else
+	// Without V2 sessions there is nothing to matchmake into, so the flow ends with the party write
+	FinishUser(UserIndex, true);
+#endif
+}
+
+void FExecTestBenchmarkFakeBackend::FinishUser(int32 UserIndex, bool bWasSuccessful)
+{
+	FSimulatedUser& User = Users[UserIndex];
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	if (User.Step == EUserStep::Matchmaking && User.SessionSearch.IsValid())
+	{
+		if (bWasSuccessful)
+		{
+			MatchmakingLatencies.Seconds.Add(CurrentTime - User.StepStartTime);
+		}
+		else
+		{
+			MatchmakingLatencies.NumFailed++;
+		}
+
+		// Join the first session found, as far as the session interface can tell from its notifications
+		if (bWasSuccessful && User.SessionSearch->SearchResults.Num() > 0)
+		{
+			FAccelByteModelsV2GameSessionMembersChangedEvent Notification;
+			Notification.SessionID = User.SessionSearch->SearchResults[0].GetSessionIdStr();
+			Notification.JoinerID = User.UserId->GetAccelByteId();
+
+			FAccelByteModelsV2SessionUser& Member = Notification.Members.AddDefaulted_GetRef();
+			Member.ID = Notification.JoinerID;
+			Member.Status = EAccelByteV2SessionMemberStatus::JOINED;
+
+			FakeBackend->QueueGameSessionMembersChangedNotification(TEST_USER_INDEX, Notification);
+		}
+
+		User.SessionSearch.Reset();
+	}
+
+	if (bWasSuccessful)
+	{
+		FlowLatencies.Seconds.Add(CurrentTime - User.StartTime);
+	}
+	else
+	{
+		FlowLatencies.NumFailed++;
+	}
+
+	User.Step = EUserStep::Done;
+	NumUsersDone++;
+}
+
+void FExecTestBenchmarkFakeBackend::FinishRun(bool bTimedOut)
+{
+	const double ElapsedSeconds = FPlatformTime::Seconds() - RunStartTime;
+
+	UE_LOG_AB(Log, TEXT("Fake backend benchmark, %d user(s), %.0f ms average latency, %.1f%% errors%s:"), NumUsers, LatencyMs, ErrorPercent, bTimedOut ? TEXT(", TIMED OUT") : TEXT(""));
+	UE_LOG_AB(Log, TEXT("  %d of %d user(s) done in %.3f s; %.1f flows/s"), NumUsersDone, NumUsers, ElapsedSeconds, NumUsersDone / FMath::Max(ElapsedSeconds, SMALL_NUMBER));
+	LogStepLatencies(TEXT("Login"), LoginLatencies);
+	LogStepLatencies(TEXT("Matchmaking"), MatchmakingLatencies);
+	LogStepLatencies(TEXT("Whole flow"), FlowLatencies);
+
+	for (int32 OperationIndex = 0; OperationIndex < static_cast<int32>(EAccelByteFakeBackendOperation::Num); OperationIndex++)
+	{
+		int32 NumRequests = 0;
+		int32 NumErrors = 0;
+		FakeBackend->GetOperationCounts(static_cast<EAccelByteFakeBackendOperation>(OperationIndex), NumRequests, NumErrors);
+		UE_LOG_AB(Log, TEXT("  %-20s %8d request(s); %6d failed"), LexToString(static_cast<EAccelByteFakeBackendOperation>(OperationIndex)), NumRequests, NumErrors);
+	}
+
+	const FOnlineAsyncTaskMetricsAccelBytePtr Metrics = Subsystem->GetAsyncTaskMetrics();
+	if (Metrics.IsValid() && Metrics->IsEnabled())
+	{
+		Metrics->Dump(*GLog);
+	}
+
+	Subsystem->SetBackend(PreviousBackend);
+	PreviousBackend.Reset();
+	Users.Empty();
+
+	// Take the made up users back out of the user cache, so that they are not served to the game after the run. Users from
+	// a fake backend are never persisted, so there is nothing to clean up on disk.
+	const int32 NumUsersRemoved = Subsystem->GetUserCache()->RemoveUsers(FakeAccelByteIds);
+	UE_LOG_AB(Log, TEXT("  Removed %d made up user(s) from the user cache"), NumUsersRemoved);
+	FakeAccelByteIds.Empty();
+
+	bIsComplete = true;
+}
+
+void FExecTestBenchmarkFakeBackend::LogStepLatencies(const TCHAR* StepName, FStepLatencies& Latencies)
+{
+	Latencies.Seconds.Sort();
+	UE_LOG_AB(Log, TEXT("  %-12s %8d ok; %6d failed; p50 %8.2f ms; p95 %8.2f ms; p99 %8.2f ms; max %8.2f ms"),
+		StepName,
+		Latencies.Seconds.Num(),
+		Latencies.NumFailed,
+		GetPercentile(Latencies.Seconds, 0.50) * 1000.0,
+		GetPercentile(Latencies.Seconds, 0.95) * 1000.0,
+		GetPercentile(Latencies.Seconds, 0.99) * 1000.0,
+		GetPercentile(Latencies.Seconds, 1.0) * 1000.0);
+}
+
+#endif
@@ -0,0 +1,136 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineFakeBackendAccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "OnlinePartyInterfaceAccelByte.h"
+#include "OnlineSessionSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_OSS_FAKE_BACKEND_ENABLED
+
+/**
+ * End to end benchmark of our async task flows against the fake backend, so that throughput and tail latency can be
+ * measured on any machine without AccelByte services. Swaps a fake backend into the subsystem for the length of the run,
+ * then drives a number of simulated users through the following flow, starting a batch of users each tick:
+ *
+ * - Login: querying the user along with their friends through the user cache, as happens right after a login
+ * - Party: writing the user's party storage, sent off once login completes and not waited on
+ * - Matchmaking: searching for game sessions through FindSessions
+ * - Session: pushing a members changed notification for the first session found, as if the user joined it
+ *
+ * Reports wall time, flow throughput, latency percentiles for each step, request counts from the fake backend, and the
+ * async task metrics for the run, which are reset when the run starts. Matchmaking and session steps need V2 sessions.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST BENCHMARK FAKEBACKEND <Users> <LatencyMs> <ErrorPercent>
+ */
+class FExecTestBenchmarkFakeBackend : public FExecTestBase, public TSharedFromThis<FExecTestBenchmarkFakeBackend>
+{
+public:
+
+	/**
+	 * Constructs an instance of the fake backend benchmark.
+	 *
+	 * @param InNumUsers Number of simulated users to drive through the flow
+	 * @param InLatencyMs Average latency of fake backend responses, in milliseconds, spread by half either way
+	 * @param InErrorPercent Percentage of fake backend requests that fail
+	 */
+	FExecTestBenchmarkFakeBackend(UWorld* InWorld, const FName& InSubsystemName, int32 InNumUsers, float InLatencyMs, float InErrorPercent);
+
+	virtual bool Run() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+private:
+
+	/** Step of the flow that a simulated user is on */
+	enum class EUserStep : uint8
+	{
+		NotStarted,
+		Login,
+		Matchmaking,
+		Done
+	};
+
+	/** State of a single simulated user */
+	struct FSimulatedUser
+	{
+		TSharedPtr<const FUniqueNetIdAccelByteUser> UserId;
+		TSharedPtr<const FOnlinePartyIdAccelByte> PartyId;
+		EUserStep Step = EUserStep::NotStarted;
+		double StartTime = 0.0;
+		double StepStartTime = 0.0;
+		TSharedPtr<FOnlineSessionSearch> SessionSearch;
+	};
+
+	/** Latencies of every run of a step, in seconds, along with how many runs failed */
+	struct FStepLatencies
+	{
+		TArray<double> Seconds;
+		int32 NumFailed = 0;
+	};
+
+	/** Number of simulated users to drive through the flow */
+	int32 NumUsers;
+
+	/** Average latency of fake backend responses, in milliseconds */
+	float LatencyMs;
+
+	/** Percentage of fake backend requests that fail */
+	float ErrorPercent;
+
+	/** Subsystem that the benchmark is running against */
+	FOnlineSubsystemAccelByte* Subsystem = nullptr;
+
+	/** Fake backend swapped in for the run */
+	TSharedPtr<FOnlineFakeBackendAccelByte, ESPMode::ThreadSafe> FakeBackend;
+
+	/** Backend that the subsystem was using before the run, restored once it is done */
+	IOnlineBackendAccelBytePtr PreviousBackend;
+
+	/** Every simulated user, in the order they are started */
+	TArray<FSimulatedUser> Users;
+
+	/** AccelByte IDs of every made up user queried through the user cache, removed from the cache once the run is done */
+	TArray<FString> FakeAccelByteIds;
+
+	/** Index of the next user to start */
+	int32 NextUserIndex = 0;
+
+	/** Number of users that have finished the flow */
+	int32 NumUsersDone = 0;
+
+	/** Time the run started, in FPlatformTime::Seconds */
+	double RunStartTime = 0.0;
+
+	FStepLatencies LoginLatencies;
+	FStepLatencies MatchmakingLatencies;
+	FStepLatencies FlowLatencies;
+
+	/** Start a simulated user on the login step */
+	void StartUser(int32 UserIndex);
+
+	/** Delegate handler for when the login query for a simulated user completes */
+	void OnLoginQueryComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds, int32 UserIndex);
+
+	/** Send off a simulated user's party storage write, and start them on the matchmaking step */
+	void StartPartyAndMatchmaking(int32 UserIndex);
+
+	/** Push the session notification for a simulated user that has finished matchmaking, and mark them done */
+	void FinishUser(int32 UserIndex, bool bWasSuccessful);
+
+	/** Log the results of the run, restore the previous backend, remove made up users from the cache, and mark the test complete */
+	void FinishRun(bool bTimedOut);
+
+	/** Log the percentiles of a single step's latencies */
+	static void LogStepLatencies(const TCHAR* StepName, FStepLatencies& Latencies);
+
+};
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestBenchmarkPlatformUserKey.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	/** Number of users seeded into both the legacy map and the cache */
+	constexpr int32 SeededUserCount = 4096;
+
+	/** Log the average cost of a single lookup over all iterations of a benchmarked path */
+	void LogBenchmarkResult(const TCHAR* Label, double ElapsedSeconds, int32 Iterations)
+	{
+		const double NanosecondsPerOp = (ElapsedSeconds * 1e9) / FMath::Max(Iterations, 1);
+		UE_LOG_AB(Log, TEXT("  %-32s %10.3f ms total; %10.1f ns/op"), Label, ElapsedSeconds * 1000.0, NanosecondsPerOp);
+	}
+}
+
+FExecTestBenchmarkPlatformUserKey::FExecTestBenchmarkPlatformUserKey(UWorld* InWorld, const FName& InSubsystemName, int32 InIterations)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Iterations(FMath::Max(InIterations, 1))
+{
+}
+
+bool FExecTestBenchmarkPlatformUserKey::Run()
+{
+	// Use a standalone cache so that we neither pollute nor purge the subsystem's real cache
+	FOnlineUserCacheAccelByte UserCache(nullptr);
+
+	// Seed the cache, and a map keyed the way the cache used to key platform users, with the same users
+	TArray<TSharedRef<FAccelByteUserInfo>> SeededUsers;
+	SeededUsers.Reserve(SeededUserCount);
+	TMap<FString, TSharedRef<FAccelByteUserInfo>> LegacyPlatformMap;
+	LegacyPlatformMap.Reserve(SeededUserCount);
+	for (int32 Index = 0; Index < SeededUserCount; Index++)
+	{
+		TSharedRef<FAccelByteUserInfo> User = MakeShared<FAccelByteUserInfo>();
+		const FString AccelByteId = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		User->Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, TEXT("STEAM"), FString::Printf(TEXT("7656119%010d"), Index)));
+		SeededUsers.Add(User);
+		LegacyPlatformMap.Add(FString::Printf(TEXT("%s;%s"), *User->Id->GetPlatformType(), *User->Id->GetPlatformId()), User);
+	}
+	UserCache.AddUsersToCache(SeededUsers);
+
+	// Pick the users to look up ahead of time, with only platform information so that the cache cannot use the AccelByte ID
+	TArray<FAccelByteUniqueIdComposite> Lookups;
+	Lookups.Reserve(Iterations);
+	FRandomStream Random(1);
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		const TSharedRef<FAccelByteUserInfo>& User = SeededUsers[Random.RandRange(0, SeededUsers.Num() - 1)];
+		Lookups.Emplace(TEXT(""), User->Id->GetPlatformType(), User->Id->GetPlatformId());
+	}
+
+	// Legacy lookup: join type and ID into a string key, then probe. Takes a read lock like the cache does, to compare fairly.
+	FRWLock LegacyLock;
+	int32 LegacyFoundCount = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (const FAccelByteUniqueIdComposite& Lookup : Lookups)
+	{
+		const FString PlatformKey = FString::Printf(TEXT("%s;%s"), *Lookup.PlatformType, *Lookup.PlatformId);
+		FReadScopeLock ReadLock(LegacyLock);
+		if (LegacyPlatformMap.Find(PlatformKey) != nullptr)
+		{
+			LegacyFoundCount++;
+		}
+	}
+	const double LegacyLookupSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Cache lookup through the platform key
+	int32 CacheFoundCount = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (const FAccelByteUniqueIdComposite& Lookup : Lookups)
+	{
+		if (UserCache.IsUserCached(Lookup))
+		{
+			CacheFoundCount++;
+		}
+	}
+	const double CacheLookupSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG_AB(Log, TEXT("Platform user key benchmark, %d lookups over %d users:"), Iterations, SeededUserCount);
+	LogBenchmarkResult(TEXT("Legacy Printf string key"), LegacyLookupSeconds, Iterations);
+	LogBenchmarkResult(TEXT("User cache platform key"), CacheLookupSeconds, Iterations);
+
+	if (LegacyFoundCount != Iterations || CacheFoundCount != Iterations)
+	{
+		UE_LOG_AB(Error, TEXT("Platform user key benchmark missed users! Legacy found: %d; Cache found: %d; Expected: %d"), LegacyFoundCount, CacheFoundCount, Iterations);
+	}
+
+	bIsComplete = true;
+	return true;
+}
+
+#endif
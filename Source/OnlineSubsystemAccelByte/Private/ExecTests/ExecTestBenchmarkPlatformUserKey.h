@@ -0,0 +1,39 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Benchmark for looking users up in the user cache by platform type and ID. Compares the legacy key, a "TYPE;ID" string
+ * built with Printf on every probe, against the user cache's platform key, which is hashed in place and never allocates.
+ * 
+ * Console command for running is as follows:
+ * ONLINE TEST BENCHMARK PLATFORMKEY <Iterations>
+ */
+class FExecTestBenchmarkPlatformUserKey : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the platform user key benchmark.
+	 * 
+	 * @param InIterations Number of lookups to run through each path
+	 */
+	FExecTestBenchmarkPlatformUserKey(UWorld* InWorld, const FName& InSubsystemName, int32 InIterations);
+
+	virtual bool Run() override;
+
+private:
+
+	/** Number of lookups to run through each path */
+	int32 Iterations;
+
+};
+
+#endif
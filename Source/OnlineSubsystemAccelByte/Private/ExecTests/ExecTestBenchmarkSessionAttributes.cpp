@@ -0,0 +1,165 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "ExecTestBenchmarkSessionAttributes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_USE_V2_SESSIONS
+
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemUtils.h"
+#include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineSessionSettingsAccelByte.h"
+
+namespace
+{
+	/** Number of items in each array attribute */
+	constexpr int32 ItemsPerArrayAttribute = 8;
+
+	/** Log the average cost of converting the settings once over all iterations of a benchmarked path */
+	void LogBenchmarkResult(const TCHAR* Label, double ElapsedSeconds, int32 Iterations)
+	{
+		const double MicrosecondsPerOp = (ElapsedSeconds * 1e6) / FMath::Max(Iterations, 1);
+		UE_LOG_AB(Log, TEXT("  %-32s %10.3f ms total; %10.2f us/op"), Label, ElapsedSeconds * 1000.0, MicrosecondsPerOp);
+	}
+
+	/**
+	 * Time converting the settings to attributes and back through the session interface, with whichever schema it has
+	 */
+	void RunConversions(const FOnlineSessionV2AccelByte& SessionInterface, const FOnlineSessionSettings& Settings, int32 Iterations, double& OutWriteSeconds, double& OutReadSeconds, int32& OutNumSettingsRead)
+	{
+		const TSharedRef<FJsonObject> Attributes = SessionInterface.ConvertSessionSettingsToJsonObject(Settings);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			SessionInterface.ConvertSessionSettingsToJsonObject(Settings);
+		}
+		OutWriteSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			OutNumSettingsRead = SessionInterface.ReadSessionSettingsFromJsonObject(Attributes).Settings.Num();
+		}
+		OutReadSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+}
+
+FExecTestBenchmarkSessionAttributes::FExecTestBenchmarkSessionAttributes(UWorld* InWorld, const FName& InSubsystemName, int32 InIterations, int32 InNumAttributes)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Iterations(FMath::Max(InIterations, 1))
+	, NumAttributes(FMath::Max(InNumAttributes, 1))
+{
+}
+
+bool FExecTestBenchmarkSessionAttributes::Run()
+{
+	bIsComplete = true;
+
+	const FOnlineSubsystemAccelByte* Subsystem = static_cast<FOnlineSubsystemAccelByte*>(Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr)
+	{
+		UE_LOG_AB(Warning, TEXT("Session attributes benchmark failed as the AccelByte subsystem could not be found!"));
+		return false;
+	}
+
+	const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+	if (!SessionInterface.IsValid())
+	{
+		UE_LOG_AB(Warning, TEXT("Session attributes benchmark failed as the session interface is invalid!"));
+		return false;
+	}
+
+	// Build settings with a spread of every type the schema supports, registering each one in the schema as we go
+	const EOnlineKeyValuePairDataType::Type ScalarTypes[] = {
+		EOnlineKeyValuePairDataType::String,
+		EOnlineKeyValuePairDataType::Int32,
+		EOnlineKeyValuePairDataType::Double,
+		EOnlineKeyValuePairDataType::Bool,
+		EOnlineKeyValuePairDataType::Int64,
+		EOnlineKeyValuePairDataType::Float
+	};
+	constexpr int32 NumScalarTypes = UE_ARRAY_COUNT(ScalarTypes);
+
+	FOnlineSessionSettings Settings;
+	TArray<FSessionAttributeSchemaFieldAccelByte> SchemaFields;
+	SchemaFields.Reserve(NumAttributes);
+	for (int32 Index = 0; Index < NumAttributes; Index++)
+	{
+		const FName Name(*FString::Printf(TEXT("BenchmarkAttribute%d"), Index));
+
+		// Every eighth attribute is an array, alternating between strings and doubles
+		if (Index % 8 == 7)
+		{
+			const bool bIsStringArray = (Index / 8) % 2 == 0;
+			if (bIsStringArray)
+			{
+				TArray<FString> Array;
+				for (int32 Item = 0; Item < ItemsPerArrayAttribute; Item++)
+				{
+					Array.Add(FString::Printf(TEXT("item-%d"), Item));
+				}
+				FOnlineSessionSettingsAccelByte::Set(Settings, Name, Array);
+			}
+			else
+			{
+				TArray<double> Array;
+				for (int32 Item = 0; Item < ItemsPerArrayAttribute; Item++)
+				{
+					Array.Add(Item * 0.5);
+				}
+				FOnlineSessionSettingsAccelByte::Set(Settings, Name, Array);
+			}
+
+			SchemaFields.Emplace(Name, bIsStringArray ? EOnlineKeyValuePairDataType::String : EOnlineKeyValuePairDataType::Double, true);
+			continue;
+		}
+
+		const EOnlineKeyValuePairDataType::Type Type = ScalarTypes[Index % NumScalarTypes];
+		switch (Type)
+		{
+			case EOnlineKeyValuePairDataType::String: Settings.Set(Name, FString::Printf(TEXT("value-%d"), Index)); break;
+			case EOnlineKeyValuePairDataType::Int32: Settings.Set(Name, Index); break;
+			case EOnlineKeyValuePairDataType::Double: Settings.Set(Name, Index * 1.5); break;
+			case EOnlineKeyValuePairDataType::Bool: Settings.Set(Name, Index % 2 == 0); break;
+			case EOnlineKeyValuePairDataType::Int64: Settings.Set(Name, static_cast<int64>(Index) << 20); break;
+			case EOnlineKeyValuePairDataType::Float: Settings.Set(Name, Index * 0.25f); break;
+			default: break;
+		}
+		SchemaFields.Emplace(Name, Type);
+	}
+
+	const FOnlineSessionAttributeSchemaAccelBytePtr PreviousSchema = SessionInterface->GetSessionAttributeSchema();
+
+	// Without a schema, the way every attribute was converted before schemas could be registered
+	double DynamicWriteSeconds = 0.0;
+	double DynamicReadSeconds = 0.0;
+	int32 DynamicNumSettingsRead = 0;
+	SessionInterface->SetSessionAttributeSchema(nullptr);
+	RunConversions(*SessionInterface, Settings, Iterations, DynamicWriteSeconds, DynamicReadSeconds, DynamicNumSettingsRead);
+
+	// With a schema covering every attribute
+	double SchemaWriteSeconds = 0.0;
+	double SchemaReadSeconds = 0.0;
+	int32 SchemaNumSettingsRead = 0;
+	SessionInterface->RegisterSessionAttributeSchema(SchemaFields);
+	RunConversions(*SessionInterface, Settings, Iterations, SchemaWriteSeconds, SchemaReadSeconds, SchemaNumSettingsRead);
+
+	SessionInterface->SetSessionAttributeSchema(PreviousSchema);
+
+	UE_LOG_AB(Log, TEXT("Session attributes benchmark, %d conversions each way of %d attributes:"), Iterations, NumAttributes);
+	LogBenchmarkResult(TEXT("Write without schema"), DynamicWriteSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Write with schema"), SchemaWriteSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Read without schema"), DynamicReadSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Read with schema"), SchemaReadSeconds, Iterations);
+
+	if (DynamicNumSettingsRead != NumAttributes || SchemaNumSettingsRead != NumAttributes)
+	{
+		UE_LOG_AB(Error, TEXT("Session attributes benchmark read back the wrong number of settings! Without schema: %d; With schema: %d; Expected: %d"), DynamicNumSettingsRead, SchemaNumSettingsRead, NumAttributes);
+	}
+
+	return true;
+}
+
+#endif
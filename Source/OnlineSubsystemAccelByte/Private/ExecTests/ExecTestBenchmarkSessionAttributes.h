@@ -0,0 +1,45 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_USE_V2_SESSIONS
+
+/**
+ * Benchmark for converting session settings to and from session attributes, as happens on every session create, update,
+ * update notification and search result. Runs the same settings through the session interface with no attribute schema,
+ * working out the type and names of every attribute on each conversion, and then with a schema registered for them.
+ * Any schema that the game registered is put back once the run is done.
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST BENCHMARK SESSIONATTRIBUTES <Iterations> <Attributes>
+ */
+class FExecTestBenchmarkSessionAttributes : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the session attributes benchmark.
+	 *
+	 * @param InIterations Number of times to convert the settings each way through each path
+	 * @param InNumAttributes Number of attributes in the settings converted, spread across every supported type
+	 */
+	FExecTestBenchmarkSessionAttributes(UWorld* InWorld, const FName& InSubsystemName, int32 InIterations, int32 InNumAttributes);
+
+	virtual bool Run() override;
+
+private:
+
+	/** Number of times to convert the settings each way through each path */
+	int32 Iterations;
+
+	/** Number of attributes in the settings converted */
+	int32 NumAttributes;
+
+};
+
+#endif
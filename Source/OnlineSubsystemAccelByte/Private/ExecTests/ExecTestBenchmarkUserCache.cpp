@@ -0,0 +1,111 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestBenchmarkUserCache.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "Async/Async.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	/** Number of users seeded into the cache before each pass */
+	constexpr int32 SeededUserCount = 4096;
+
+	/** Every Nth operation on a thread is a bulk insert rather than a lookup */
+	constexpr int32 InsertEveryNthOp = 16;
+
+	/** Number of users added to the cache per bulk insert, matching a typical bulk user query */
+	constexpr int32 InsertBatchSize = 50;
+}
+
+FExecTestBenchmarkUserCache::FExecTestBenchmarkUserCache(UWorld* InWorld, const FName& InSubsystemName, int32 InNumThreads, int32 InOpsPerThread)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, NumThreads(FMath::Max(InNumThreads, 1))
+	, OpsPerThread(FMath::Max(InOpsPerThread, 1))
+{
+}
+
+bool FExecTestBenchmarkUserCache::Run()
+{
+	const double SingleThreadSeconds = RunPass(1);
+	const double MultiThreadSeconds = RunPass(NumThreads);
+
+	const double SingleThreadOpsPerSecond = OpsPerThread / FMath::Max(SingleThreadSeconds, SMALL_NUMBER);
+	const double MultiThreadOpsPerSecond = (static_cast<double>(OpsPerThread) * NumThreads) / FMath::Max(MultiThreadSeconds, SMALL_NUMBER);
+
+	UE_LOG_AB(Log, TEXT("User cache contention benchmark, %d ops per thread, one insert of %d users every %d ops:"), OpsPerThread, InsertBatchSize, InsertEveryNthOp);
+	UE_LOG_AB(Log, TEXT("  %3d thread(s): %10.3f ms total; %12.0f ops/s"), 1, SingleThreadSeconds * 1000.0, SingleThreadOpsPerSecond);
+	UE_LOG_AB(Log, TEXT("  %3d thread(s): %10.3f ms total; %12.0f ops/s; %.2fx single thread throughput"), NumThreads, MultiThreadSeconds * 1000.0, MultiThreadOpsPerSecond, MultiThreadOpsPerSecond / FMath::Max(SingleThreadOpsPerSecond, SMALL_NUMBER));
+
+	bIsComplete = true;
+	return true;
+}
+
+double FExecTestBenchmarkUserCache::RunPass(int32 ThreadCount) const
+{
+	// Use a standalone cache so that we neither pollute nor purge the subsystem's real cache
+	FOnlineUserCacheAccelByte UserCache(nullptr);
+
+	TArray<TSharedRef<FAccelByteUserInfo>> SeededUsers;
+	SeededUsers.Reserve(SeededUserCount);
+	for (int32 Index = 0; Index < SeededUserCount; Index++)
+	{
+		TSharedRef<FAccelByteUserInfo> User = MakeShared<FAccelByteUserInfo>();
+		const FString AccelByteId = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		User->Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, TEXT("STEAM"), FString::Printf(TEXT("7656119%010d"), Index)));
+		User->DisplayName = FString::Printf(TEXT("User%d"), Index);
+		SeededUsers.Add(User);
+	}
+	UserCache.AddUsersToCache(SeededUsers);
+
+	// Gate all threads on a single event so that they start hammering the cache at the same moment
+	FEvent* StartEvent = FPlatformProcess::GetSynchEventFromPool(true);
+
+	TArray<TFuture<void>> Workers;
+	Workers.Reserve(ThreadCount);
+	for (int32 ThreadIndex = 0; ThreadIndex < ThreadCount; ThreadIndex++)
+	{
+		Workers.Add(Async(EAsyncExecution::Thread, [&UserCache, &SeededUsers, StartEvent, ThreadIndex, Ops = OpsPerThread]()
+		{
+			FRandomStream Random(ThreadIndex + 1);
+			TArray<TSharedRef<FAccelByteUserInfo>> InsertBatch;
+			InsertBatch.Reserve(InsertBatchSize);
+
+			StartEvent->Wait();
+			for (int32 Op = 0; Op < Ops; Op++)
+			{
+				if (Op % InsertEveryNthOp == 0)
+				{
+					InsertBatch.Reset();
+					for (int32 BatchIndex = 0; BatchIndex < InsertBatchSize; BatchIndex++)
+					{
+						InsertBatch.Add(SeededUsers[Random.RandRange(0, SeededUsers.Num() - 1)]);
+					}
+					UserCache.AddUsersToCache(InsertBatch);
+				}
+				else
+				{
+					const TSharedRef<FAccelByteUserInfo>& User = SeededUsers[Random.RandRange(0, SeededUsers.Num() - 1)];
+					UserCache.GetUser(*User->Id);
+				}
+			}
+		}));
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	StartEvent->Trigger();
+	for (TFuture<void>& Worker : Workers)
+	{
+		Worker.Wait();
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	FPlatformProcess::ReturnSynchEventToPool(StartEvent);
+	return ElapsedSeconds;
+}
+
+#endif
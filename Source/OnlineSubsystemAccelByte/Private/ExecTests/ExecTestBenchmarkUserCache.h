@@ -0,0 +1,49 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Contention benchmark for the user cache. Spins up a number of dedicated threads that all hammer a standalone cache
+ * instance at the same time with a mix of lookups and bulk inserts, similar to game thread GetUser calls racing query
+ * tasks finalizing. Runs once with a single thread as a baseline and once with the requested thread count.
+ * 
+ * Console command for running is as follows:
+ * ONLINE TEST BENCHMARK USERCACHE <Threads> <OpsPerThread>
+ */
+class FExecTestBenchmarkUserCache : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the user cache contention benchmark.
+	 * 
+	 * @param InNumThreads Number of threads to run against the cache at once
+	 * @param InOpsPerThread Number of cache operations that each thread will perform
+	 */
+	FExecTestBenchmarkUserCache(UWorld* InWorld, const FName& InSubsystemName, int32 InNumThreads, int32 InOpsPerThread);
+
+	virtual bool Run() override;
+
+private:
+
+	/** Number of threads to run against the cache at once */
+	int32 NumThreads;
+
+	/** Number of cache operations that each thread will perform */
+	int32 OpsPerThread;
+
+	/**
+	 * Run a single pass of the benchmark with the given thread count, returning the elapsed wall time in seconds.
+	 */
+	double RunPass(int32 ThreadCount) const;
+
+};
+
+#endif
@@ -0,0 +1,153 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestBenchmarkUserId.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+#include "Misc/Base64.h"
+#include "JsonObjectConverter.h"
+
+namespace
+{
+	/** Log the average cost of a single operation over all iterations of a benchmarked path */
+	void LogBenchmarkResult(const TCHAR* Label, double ElapsedSeconds, int32 Iterations)
+	{
+		const double NanosecondsPerOp = (ElapsedSeconds * 1e9) / FMath::Max(Iterations, 1);
+		UE_LOG_AB(Log, TEXT("  %-32s %10.3f ms total; %10.1f ns/op"), Label, ElapsedSeconds * 1000.0, NanosecondsPerOp);
+	}
+}
+
+FExecTestBenchmarkUserId::FExecTestBenchmarkUserId(UWorld* InWorld, const FName& InSubsystemName, int32 InIterations)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, Iterations(FMath::Max(InIterations, 1))
+{
+}
+
+bool FExecTestBenchmarkUserId::Run()
+{
+	// Build up a set of composites to run through each path up front, so that generating IDs is not part of our timings
+	TArray<FAccelByteUniqueIdComposite> Composites;
+	Composites.Reserve(Iterations);
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		const FString AccelByteId = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		const FString PlatformId = FString::Printf(TEXT("7656119%010d"), Index);
+		Composites.Emplace(AccelByteId, TEXT("STEAM"), PlatformId);
+	}
+
+	TArray<FString> LegacyEncoded;
+	LegacyEncoded.Reserve(Iterations);
+	TArray<FString> BinaryEncoded;
+	BinaryEncoded.Reserve(Iterations);
+
+	// Legacy encode: JSON serialize the composite and Base64 encode the result
+	double StartTime = FPlatformTime::Seconds();
+	for (const FAccelByteUniqueIdComposite& Composite : Composites)
+	{
+		FString EncodedString;
+		FUniqueNetIdAccelByteUser::EncodeCompositeId(Composite, EncodedString, false);
+		LegacyEncoded.Add(MoveTemp(EncodedString));
+	}
+	const double LegacyEncodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Binary encode
+	StartTime = FPlatformTime::Seconds();
+	for (const FAccelByteUniqueIdComposite& Composite : Composites)
+	{
+		FString EncodedString;
+		FUniqueNetIdAccelByteUser::EncodeCompositeId(Composite, EncodedString, true);
+		BinaryEncoded.Add(MoveTemp(EncodedString));
+	}
+	const double BinaryEncodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Legacy decode and validate: Base64 decode, JSON parse, and check the ID format
+	int32 LegacyValidCount = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (const FString& Encoded : LegacyEncoded)
+	{
+		FString JSONString;
+		FAccelByteUniqueIdComposite Decoded;
+		if (FBase64::Decode(Encoded, JSONString)
+			&& FJsonObjectConverter::JsonObjectStringToUStruct(JSONString, &Decoded, 0, 0)
+			&& IsAccelByteIDValid(Decoded.Id))
+		{
+			LegacyValidCount++;
+		}
+	}
+	const double LegacyDecodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Binary decode and validate
+	int32 BinaryValidCount = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (const FString& Encoded : BinaryEncoded)
+	{
+		FAccelByteUniqueIdComposite Decoded;
+		if (FUniqueNetIdAccelByteUser::DecodeCompositeId(Encoded, Decoded) && IsAccelByteIDValid(Decoded.Id))
+		{
+			BinaryValidCount++;
+		}
+	}
+	const double BinaryDecodeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Full create and validate through the public API, from a composite and from both string forms
+	StartTime = FPlatformTime::Seconds();
+	for (const FAccelByteUniqueIdComposite& Composite : Composites)
+	{
+		FUniqueNetIdAccelByteUser::Create(Composite)->IsValid();
+	}
+	const double CreateFromCompositeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (const FString& Encoded : BinaryEncoded)
+	{
+		FUniqueNetIdAccelByteUser::Create(Encoded)->IsValid();
+	}
+	const double CreateFromBinarySeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (const FString& Encoded : LegacyEncoded)
+	{
+		FUniqueNetIdAccelByteUser::Create(Encoded)->IsValid();
+	}
+	const double CreateFromLegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG_AB(Log, TEXT("User ID encoding benchmark over %d IDs:"), Iterations);
+	LogBenchmarkResult(TEXT("Legacy JSON encode"), LegacyEncodeSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Binary encode"), BinaryEncodeSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Legacy JSON decode + validate"), LegacyDecodeSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Binary decode + validate"), BinaryDecodeSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Create from composite"), CreateFromCompositeSeconds, Iterations);
+	LogBenchmarkResult(TEXT("Create from binary string"), CreateFromBinarySeconds, Iterations);
+	LogBenchmarkResult(TEXT("Create from legacy string"), CreateFromLegacySeconds, Iterations);
+	UE_LOG_AB(Log, TEXT("  Encoded length: legacy %d chars; binary %d chars"), LegacyEncoded[0].Len(), BinaryEncoded[0].Len());
+
+	if (LegacyValidCount != Iterations || BinaryValidCount != Iterations)
+	{
+		UE_LOG_AB(Error, TEXT("User ID encoding benchmark decoded invalid IDs! Legacy valid: %d; Binary valid: %d; Expected: %d"), LegacyValidCount, BinaryValidCount, Iterations);
+	}
+
+	// The same ID in either encoding has to be interchangeable as a map key
+	int32 MismatchedCount = 0;
+	for (int32 Index = 0; Index < Iterations; Index++)
+	{
+		const FUniqueNetIdAccelByteUserRef LegacyId = FUniqueNetIdAccelByteUser::Create(LegacyEncoded[Index]);
+		const FUniqueNetIdAccelByteUserRef BinaryId = FUniqueNetIdAccelByteUser::Create(BinaryEncoded[Index]);
+		if (!(LegacyId.Get() == BinaryId.Get()) || GetTypeHash(LegacyId.Get()) != GetTypeHash(BinaryId.Get()))
+		{
+			MismatchedCount++;
+		}
+	}
+
+	if (MismatchedCount > 0)
+	{
+		UE_LOG_AB(Error, TEXT("User ID encoding benchmark found %d IDs that differ in equality or hash between encodings!"), MismatchedCount);
+	}
+
+	bIsComplete = true;
+	return true;
+}
+
+#endif
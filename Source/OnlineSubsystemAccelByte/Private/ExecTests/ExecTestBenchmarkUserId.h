@@ -0,0 +1,39 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Microbenchmark comparing the compact binary encoding of FUniqueNetIdAccelByteUser against the legacy Base64 encoded
+ * JSON encoding. Measures encoding, decoding, and creating plus validating IDs through both paths.
+ * 
+ * Console command for running is as follows:
+ * ONLINE TEST BENCHMARK USERID <Iterations>
+ */
+class FExecTestBenchmarkUserId : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the user ID encoding benchmark.
+	 * 
+	 * @param InIterations Number of IDs to encode and decode for each path that we measure
+	 */
+	FExecTestBenchmarkUserId(UWorld* InWorld, const FName& InSubsystemName, int32 InIterations);
+
+	virtual bool Run() override;
+
+private:
+
+	/** Number of IDs to run through each path that we measure */
+	int32 Iterations;
+
+};
+
+#endif
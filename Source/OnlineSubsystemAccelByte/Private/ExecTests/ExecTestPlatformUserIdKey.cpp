@@ -0,0 +1,96 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestPlatformUserIdKey.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
+
+namespace
+{
+	/** Type given to the plain string ID, which no real subsystem uses */
+	const FName TestStringIdType(TEXT("ABTESTSTRING"));
+
+	/**
+	 * Check that the lookup string of an ID matches its ToString, both when borrowed from the ID and when copied
+	 */
+	bool CheckPlatformIdView(const TCHAR* Label, const FUniqueNetId& UserId)
+	{
+		const FString Expected = UserId.ToString();
+
+		TSet<FName> StringIdTypes;
+		FString CopiedStorage;
+		const FStringView CopiedView = FOnlineUserCacheAccelByte::GetPlatformIdView(UserId, StringIdTypes, CopiedStorage);
+
+		StringIdTypes.Add(UserId.GetType());
+		FString BorrowedStorage;
+		const FStringView BorrowedView = FOnlineUserCacheAccelByte::GetPlatformIdView(UserId, StringIdTypes, BorrowedStorage);
+
+		const FString Copied(CopiedView.Len(), CopiedView.GetData());
+		const FString Borrowed(BorrowedView.Len(), BorrowedView.GetData());
+		if (!Copied.Equals(Expected, ESearchCase::CaseSensitive) || !Borrowed.Equals(Expected, ESearchCase::CaseSensitive))
+		{
+			UE_LOG_AB(Error, TEXT("Platform user ID key test failed for %s ID! ToString: '%s'; Copied: '%s'; Borrowed: '%s'"), Label, *Expected, *Copied, *Borrowed);
+			return false;
+		}
+
+		UE_LOG_AB(Log, TEXT("  %-24s lookup string matches ToString"), Label);
+		return true;
+	}
+}
+
+FExecTestPlatformUserIdKey::FExecTestPlatformUserIdKey(UWorld* InWorld, const FName& InSubsystemName)
+	: FExecTestBase(InWorld, InSubsystemName)
+{
+}
+
+bool FExecTestPlatformUserIdKey::Run()
+{
+	bIsComplete = true;
+
+	const FString PlatformId = TEXT("PlatformPlayer-7656119");
+#if ENGINE_MAJOR_VERSION >= 5
+	const FUniqueNetIdRef StringId = FUniqueNetIdString::Create(PlatformId, TestStringIdType);
+#else
+	const TSharedRef<const FUniqueNetId> StringId = MakeShared<const FUniqueNetIdString>(PlatformId, TestStringIdType);
+#endif
+
+	const FAccelByteUniqueIdComposite Composite(FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower(), TEXT("STEAM"), TEXT("76561190000000001"));
+	FString JsonEncodedComposite;
+	FString BinaryEncodedComposite;
+	if (!FUniqueNetIdAccelByteUser::EncodeCompositeId(Composite, JsonEncodedComposite, false) || !FUniqueNetIdAccelByteUser::EncodeCompositeId(Composite, BinaryEncodedComposite, true))
+	{
+		UE_LOG_AB(Error, TEXT("Platform user ID key test failed to encode a composite ID!"));
+		return false;
+	}
+
+	UE_LOG_AB(Log, TEXT("Platform user ID key test:"));
+	bool bPassed = CheckPlatformIdView(TEXT("String"), *StringId);
+	bPassed &= CheckPlatformIdView(TEXT("JSON composite"), *FUniqueNetIdAccelByteUser::Create(JsonEncodedComposite));
+	bPassed &= CheckPlatformIdView(TEXT("Binary composite"), *FUniqueNetIdAccelByteUser::Create(BinaryEncodedComposite));
+
+	// A user cached with platform information must be found by the matching platform unique ID, using a standalone
+	// cache so that the subsystem's own cache is left alone
+	FOnlineUserCacheAccelByte UserCache(nullptr);
+	TSharedRef<FAccelByteUserInfo> User = MakeShared<FAccelByteUserInfo>();
+	User->Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(Composite.Id, TestStringIdType.ToString(), PlatformId));
+	UserCache.AddUsersToCache({User});
+
+	const TSharedPtr<const FAccelByteUserInfo> FoundUser = UserCache.GetUser(*StringId);
+	if (!FoundUser.IsValid() || FoundUser.Get() != &User.Get())
+	{
+		UE_LOG_AB(Error, TEXT("Platform user ID key test failed to find a cached user by their platform unique ID '%s'!"), *StringId->ToDebugString());
+		bPassed = false;
+	}
+
+	if (bPassed)
+	{
+		UE_LOG_AB(Log, TEXT("Platform user ID key test passed"));
+	}
+
+	return bPassed;
+}
+
+#endif
@@ -0,0 +1,30 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test case for the string that the user cache looks platform unique IDs up by. Checks that it matches ToString for a
+ * plain string ID and for AccelByte composite IDs in both the JSON and the binary encoding, whether the string is
+ * borrowed from the ID or copied, and that a cached user is found by a platform unique ID.
+ * 
+ * Console command for running is as follows:
+ * ONLINE TEST USER PLATFORMID
+ */
+class FExecTestPlatformUserIdKey : public FExecTestBase
+{
+public:
+
+	FExecTestPlatformUserIdKey(UWorld* InWorld, const FName& InSubsystemName);
+
+	virtual bool Run() override;
+
+};
+
+#endif
@@ -0,0 +1,88 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ExecTestUserCachePersistence.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
+#include "OnlineSubsystemAccelByteInternalHelpers.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** Users are written to expire a day from now, and loaded with a week of staleness allowed */
+	constexpr double TestUserTTLSeconds = 86400.0;
+	constexpr double TestUserMaxStaleSeconds = 604800.0;
+
+	/** Load the scratch file, logging an error and returning false if it does not behave as expected */
+	bool CheckLoad(const TCHAR* Step, const FString& FilePath, int32 ExpectedUsers, bool bExpectRewrite)
+	{
+		const int64 SizeBefore = IFileManager::Get().FileSize(*FilePath);
+		TArray<TSharedRef<FAccelByteUserInfo>> LoadedUsers;
+		const bool bWasRewritten = FOnlineUserCacheAccelByte::LoadPersistentCacheFile(FilePath, TestUserMaxStaleSeconds, LoadedUsers);
+		const int64 SizeAfter = IFileManager::Get().FileSize(*FilePath);
+
+		if (LoadedUsers.Num() != ExpectedUsers || bWasRewritten != bExpectRewrite || (!bExpectRewrite && SizeAfter != SizeBefore))
+		{
+			UE_LOG_AB(Error, TEXT("Persistent user cache test failed at '%s'! Users loaded: %d (expected %d); Rewritten: %s (expected %s); Size before: %lld; Size after: %lld"),
+				Step, LoadedUsers.Num(), ExpectedUsers, LOG_BOOL_FORMAT(bWasRewritten), LOG_BOOL_FORMAT(bExpectRewrite), SizeBefore, SizeAfter);
+			return false;
+		}
+
+		UE_LOG_AB(Log, TEXT("  %-40s %d users loaded; rewritten: %s"), Step, LoadedUsers.Num(), LOG_BOOL_FORMAT(bWasRewritten));
+		return true;
+	}
+}
+
+FExecTestUserCachePersistence::FExecTestUserCachePersistence(UWorld* InWorld, const FName& InSubsystemName, int32 InNumUsers)
+	: FExecTestBase(InWorld, InSubsystemName)
+	, NumUsers(FMath::Max(InNumUsers, 1))
+{
+}
+
+bool FExecTestUserCachePersistence::Run()
+{
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), FString::Printf(TEXT("ExecTestUserCache_%s.bin"), *FGuid::NewGuid().ToString(EGuidFormats::Digits)));
+
+	TArray<TSharedRef<FAccelByteUserInfo>> Users;
+	Users.Reserve(NumUsers);
+	for (int32 Index = 0; Index < NumUsers; Index++)
+	{
+		TSharedRef<FAccelByteUserInfo> User = MakeShared<FAccelByteUserInfo>();
+		const FString AccelByteId = FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+		User->Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, TEXT("STEAM"), FString::Printf(TEXT("7656119%010d"), Index)));
+		User->DisplayName = FString::Printf(TEXT("User%d"), Index);
+		Users.Add(User);
+	}
+
+	UE_LOG_AB(Log, TEXT("Persistent user cache test, %d users:"), NumUsers);
+
+	// Every record is live, so loading must never rewrite the file, however many times it is loaded
+	FOnlineUserCacheAccelByte::AppendToPersistentCacheFile(FilePath, Users, TestUserTTLSeconds);
+	bool bPassed = CheckLoad(TEXT("Live records only"), FilePath, NumUsers, false)
+		&& CheckLoad(TEXT("Live records only, loaded again"), FilePath, NumUsers, false);
+
+	// Writing every user twice more leaves two dead records for each live one, which is past the rewrite threshold
+	if (bPassed)
+	{
+		FOnlineUserCacheAccelByte::AppendToPersistentCacheFile(FilePath, Users, TestUserTTLSeconds);
+		FOnlineUserCacheAccelByte::AppendToPersistentCacheFile(FilePath, Users, TestUserTTLSeconds);
+		bPassed = CheckLoad(TEXT("Two dead records per user"), FilePath, NumUsers, true)
+			&& CheckLoad(TEXT("After rewrite"), FilePath, NumUsers, false);
+	}
+
+	IFileManager::Get().Delete(*FilePath, false, false, true);
+
+	if (bPassed)
+	{
+		UE_LOG_AB(Log, TEXT("Persistent user cache test passed"));
+	}
+
+	bIsComplete = true;
+	return bPassed;
+}
+
+#endif
@@ -0,0 +1,40 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Test case for the persistent user cache file. Checks that a file holding only live records is loaded as is, and that
+ * a file where most records have been superseded is rewritten once and then left alone. Uses its own scratch file, so
+ * the subsystem's persistent cache is never touched.
+ * 
+ * Console command for running is as follows:
+ * ONLINE TEST USER CACHEFILE <Users>
+ */
+class FExecTestUserCachePersistence : public FExecTestBase
+{
+public:
+
+	/**
+	 * Constructs an instance of the persistent user cache file test.
+	 * 
+	 * @param InNumUsers Number of users written to the scratch file
+	 */
+	FExecTestUserCachePersistence(UWorld* InWorld, const FName& InSubsystemName, int32 InNumUsers);
+
+	virtual bool Run() override;
+
+private:
+
+	/** Number of users written to the scratch file */
+	int32 NumUsers;
+
+};
+
+#endif
@@ -0,0 +1,210 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "ExecTestUserQueryPartialFailure.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_OSS_FAKE_BACKEND_ENABLED
+
+#include "OnlineSubsystemUtils.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSubsystemAccelByteInternalHelpers.h"
+#include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUsersByIds.h"
+
+namespace
+{
+	/** Latency of every fake backend response, long enough for the waiting queries to attach before the owner completes */
+	constexpr double ResponseLatencySeconds = 0.5;
+
+	/** Time after which the run gives up on queries that have yet to complete */
+	constexpr double RunTimeoutSeconds = 30.0;
+
+	FString MakeFakeAccelByteId()
+	{
+		return FGuid::NewGuid().ToString(EGuidFormats::Digits).ToLower();
+	}
+}
+
+FExecTestUserQueryPartialFailure::FExecTestUserQueryPartialFailure(UWorld* InWorld, const FName& InSubsystemName)
+	: FExecTestBase(InWorld, InSubsystemName)
+{
+}
+
+bool FExecTestUserQueryPartialFailure::Run()
+{
+	Subsystem = static_cast<FOnlineSubsystemAccelByte*>(Online::GetSubsystem(World, SubsystemName));
+	if (Subsystem == nullptr || !Subsystem->GetUserCache().IsValid())
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to run user query partial failure test as the subsystem is not available!"));
+		bIsComplete = true;
+		return false;
+	}
+
+	// Fill every chunk but the last, which holds only the failing ID
+	int32 ChunkSize = 100;
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("UserQueryChunkSize"), ChunkSize, GEngineIni);
+	ChunkSize = FMath::Max(ChunkSize, 1);
+	NumOwnerChunks = 2;
+
+	AccelByteIds.Reserve(ChunkSize + 1);
+	for (int32 IdIndex = 0; IdIndex < ChunkSize + 1; IdIndex++)
+	{
+		AccelByteIds.Add(MakeFakeAccelByteId());
+	}
+	const FString& FailingId = AccelByteIds.Last();
+	const FString& SucceedingId = AccelByteIds[0];
+
+	FakeBackend = MakeShared<FOnlineFakeBackendAccelByte, ESPMode::ThreadSafe>(Subsystem);
+	FakeBackend->SetAllSettings(ResponseLatencySeconds, ResponseLatencySeconds, 0.0f);
+	FAccelByteFakeBackendOperationSettings BulkGetUserInfoSettings = FakeBackend->GetSettings(EAccelByteFakeBackendOperation::BulkGetUserInfo);
+	BulkGetUserInfoSettings.FailingIds.Add(FailingId);
+	FakeBackend->SetSettings(EAccelByteFakeBackendOperation::BulkGetUserInfo, BulkGetUserInfoSettings);
+
+	PreviousBackend = Subsystem->GetBackend();
+	Subsystem->SetBackend(FakeBackend);
+
+	FQueryResult& Owner = Results[static_cast<int32>(EQuery::Owner)];
+	Owner.AccelByteIds = AccelByteIds;
+	Owner.ExpectedFailedIds = { FailingId };
+
+	FQueryResult& FailingWaiter = Results[static_cast<int32>(EQuery::FailingWaiter)];
+	FailingWaiter.AccelByteIds = { SucceedingId, FailingId };
+	FailingWaiter.ExpectedFailedIds = { FailingId };
+
+	FQueryResult& SucceedingWaiter = Results[static_cast<int32>(EQuery::SucceedingWaiter)];
+	SucceedingWaiter.AccelByteIds = { SucceedingId };
+	if (ChunkSize > 1)
+	{
+		SucceedingWaiter.AccelByteIds.Add(AccelByteIds[ChunkSize - 1]);
+	}
+	SucceedingWaiter.bExpectSuccess = true;
+
+	InitialNumCoalescedQueries = Subsystem->GetUserCache()->GetNumCoalescedQueries();
+	RunStartTime = FPlatformTime::Seconds();
+
+	// Waiters are only sent once the owner has claimed its IDs, which it has done by the time it sends its first chunk
+	DispatchQuery(EQuery::Owner);
+	return true;
+}
+
+void FExecTestUserQueryPartialFailure::Tick(float DeltaTime)
+{
+	if (!bHasDispatchedWaiters)
+	{
+		int32 NumRequests = 0;
+		int32 NumErrors = 0;
+		FakeBackend->GetOperationCounts(EAccelByteFakeBackendOperation::BulkGetUserInfo, NumRequests, NumErrors);
+		if (NumRequests > 0)
+		{
+			DispatchQuery(EQuery::FailingWaiter);
+			DispatchQuery(EQuery::SucceedingWaiter);
+			bHasDispatchedWaiters = true;
+		}
+	}
+
+	bool bAreAllQueriesDone = true;
+	for (const FQueryResult& Result : Results)
+	{
+		bAreAllQueriesDone &= Result.bIsDone;
+	}
+
+	if (bAreAllQueriesDone)
+	{
+		FinishRun(false);
+	}
+	else if (FPlatformTime::Seconds() - RunStartTime > RunTimeoutSeconds)
+	{
+		FinishRun(true);
+	}
+}
+
+void FExecTestUserQueryPartialFailure::DispatchQuery(EQuery Query)
+{
+	// Sent straight to the task rather than through the user cache, so that batching cannot merge the queries into one
+	const FOnQueryUsersComplete OnQueryCompleteDelegate = FOnQueryUsersComplete::CreateSP(AsShared(), &FExecTestUserQueryPartialFailure::OnQueryComplete, Query);
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, TEST_USER_INDEX, Results[static_cast<int32>(Query)].AccelByteIds, false, OnQueryCompleteDelegate);
+}
+
+void FExecTestUserQueryPartialFailure::OnQueryComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds, EQuery Query)
+{
+	FQueryResult& Result = Results[static_cast<int32>(Query)];
+	Result.bIsDone = true;
+	Result.bWasSuccessful = bIsSuccessful;
+	Result.NumUsers = UsersQueried.Num();
+	Result.FailedIds = MoveTemp(FailedIds);
+}
+
+void FExecTestUserQueryPartialFailure::FinishRun(bool bTimedOut)
+{
+	static const TCHAR* QueryNames[] = { TEXT("Owner"), TEXT("Failing waiter"), TEXT("Succeeding waiter") };
+
+	bool bPassed = !bTimedOut;
+	UE_LOG_AB(Log, TEXT("User query partial failure test%s:"), bTimedOut ? TEXT(", TIMED OUT") : TEXT(""));
+	for (int32 QueryIndex = 0; QueryIndex < static_cast<int32>(EQuery::Num); QueryIndex++)
+	{
+		FQueryResult& Result = Results[QueryIndex];
+		Result.FailedIds.Sort();
+		Result.ExpectedFailedIds.Sort();
+
+		const int32 ExpectedNumUsers = Result.bExpectSuccess ? Result.AccelByteIds.Num() : 0;
+		const bool bQueryPassed = Result.bIsDone
+			&& Result.bWasSuccessful == Result.bExpectSuccess
+			&& Result.NumUsers == ExpectedNumUsers
+			&& Result.FailedIds == Result.ExpectedFailedIds;
+		bPassed &= bQueryPassed;
+
+		UE_LOG_AB(Log, TEXT("  %-18s %s; done: %s; successful: %s; %d user(s); failed IDs: [%s]"),
+			QueryNames[QueryIndex],
+			bQueryPassed ? TEXT("ok") : TEXT("FAILED"),
+			LOG_BOOL_FORMAT(Result.bIsDone),
+			LOG_BOOL_FORMAT(Result.bWasSuccessful),
+			Result.NumUsers,
+			*FString::Join(Result.FailedIds, TEXT(", ")));
+	}
+
+	// Waiters must have attached to the owner's IDs rather than fetching them again
+	int32 NumRequests = 0;
+	int32 NumErrors = 0;
+	FakeBackend->GetOperationCounts(EAccelByteFakeBackendOperation::BulkGetUserInfo, NumRequests, NumErrors);
+	const int32 NumCoalescedQueries = Subsystem->GetUserCache()->GetNumCoalescedQueries() - InitialNumCoalescedQueries;
+	if (NumRequests != NumOwnerChunks || NumCoalescedQueries < 2)
+	{
+		UE_LOG_AB(Log, TEXT("  Waiting queries FAILED to coalesce; %d bulk request(s) sent for %d chunk(s); %d query(s) coalesced"), NumRequests, NumOwnerChunks, NumCoalescedQueries);
+		bPassed = false;
+	}
+
+	// Queries are all or nothing towards their callers, but nothing that was fetched should be thrown away
+	const FOnlineUserCacheAccelBytePtr UserCache = Subsystem->GetUserCache();
+	const FString& FailingId = AccelByteIds.Last();
+	int32 NumUsersCached = 0;
+	for (const FString& AccelByteId : AccelByteIds)
+	{
+		if (AccelByteId != FailingId && UserCache->IsUserCached(FAccelByteUniqueIdComposite(AccelByteId)))
+		{
+			NumUsersCached++;
+		}
+	}
+	const bool bIsFailingUserCached = UserCache->IsUserCached(FAccelByteUniqueIdComposite(FailingId));
+	if (NumUsersCached != AccelByteIds.Num() - 1 || bIsFailingUserCached)
+	{
+		UE_LOG_AB(Log, TEXT("  Cache FAILED to keep fetched users; %d of %d fetched user(s) cached; failing user cached: %s"), NumUsersCached, AccelByteIds.Num() - 1, LOG_BOOL_FORMAT(bIsFailingUserCached));
+		bPassed = false;
+	}
+
+	if (bPassed)
+	{
+		UE_LOG_AB(Log, TEXT("User query partial failure test passed"));
+	}
+	else
+	{
+		UE_LOG_AB(Error, TEXT("User query partial failure test failed!"));
+	}
+
+	Subsystem->SetBackend(PreviousBackend);
+	PreviousBackend.Reset();
+	UserCache->RemoveUsers(AccelByteIds);
+
+	bIsComplete = true;
+}
+
+#endif
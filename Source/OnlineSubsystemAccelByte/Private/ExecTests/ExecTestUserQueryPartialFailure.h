@@ -0,0 +1,101 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExecTestBase.h"
+#include "OnlineFakeBackendAccelByte.h"
+#include "OnlineUserCacheAccelByte.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && AB_OSS_FAKE_BACKEND_ENABLED
+
+class FOnlineSubsystemAccelByte;
+
+/**
+ * Test case for user queries where only some chunks fail. Swaps a fake backend into the subsystem that fails any bulk
+ * request asking for one scripted ID, then runs a query whose last chunk holds only that ID. Once that query is in
+ * flight, two more queries attach to its IDs rather than fetching them again. Checks that:
+ *
+ * - The query owning the IDs fails as a whole, and reports the failing ID to its delegate
+ * - A query waiting on the failing ID fails the same way, and reports only that ID
+ * - A query waiting only on IDs from chunks that succeeded gets its users
+ * - Users from chunks that succeeded are cached even though the owning query failed, so only the failed IDs need to be
+ *   queried again
+ *
+ * Console command for running is as follows:
+ * ONLINE TEST USER PARTIALFAILURE
+ */
+class FExecTestUserQueryPartialFailure : public FExecTestBase, public TSharedFromThis<FExecTestUserQueryPartialFailure>
+{
+public:
+
+	FExecTestUserQueryPartialFailure(UWorld* InWorld, const FName& InSubsystemName);
+
+	virtual bool Run() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+private:
+
+	/** Queries that the test runs, in the order they are dispatched */
+	enum class EQuery : uint8
+	{
+		Owner,
+		FailingWaiter,
+		SucceedingWaiter,
+		Num
+	};
+
+	/** What a query was expected to report, and what it did */
+	struct FQueryResult
+	{
+		TArray<FString> AccelByteIds;
+		bool bExpectSuccess = false;
+		TArray<FString> ExpectedFailedIds;
+
+		bool bIsDone = false;
+		bool bWasSuccessful = false;
+		int32 NumUsers = 0;
+		TArray<FString> FailedIds;
+	};
+
+	/** Subsystem that the test is running against */
+	FOnlineSubsystemAccelByte* Subsystem = nullptr;
+
+	/** Fake backend swapped in for the run */
+	TSharedPtr<FOnlineFakeBackendAccelByte, ESPMode::ThreadSafe> FakeBackend;
+
+	/** Backend that the subsystem was using before the run, restored once it is done */
+	IOnlineBackendAccelBytePtr PreviousBackend;
+
+	/** Every made up AccelByte ID queried, removed from the cache once the run is done */
+	TArray<FString> AccelByteIds;
+
+	/** Number of chunks that the owning query is split into */
+	int32 NumOwnerChunks = 0;
+
+	/** Number of queries coalesced by the user cache when the run started */
+	int32 InitialNumCoalescedQueries = 0;
+
+	/** Whether the waiting queries have been dispatched */
+	bool bHasDispatchedWaiters = false;
+
+	/** Time the run started, in FPlatformTime::Seconds */
+	double RunStartTime = 0.0;
+
+	FQueryResult Results[static_cast<int32>(EQuery::Num)];
+
+	/** Send a query for the IDs of the result passed in */
+	void DispatchQuery(EQuery Query);
+
+	/** Delegate handler for when one of the test's queries completes */
+	void OnQueryComplete(bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds, EQuery Query);
+
+	/** Check every result, restore the previous backend, remove made up users from the cache, and mark the test complete */
+	void FinishRun(bool bTimedOut);
+
+};
+
+#endif
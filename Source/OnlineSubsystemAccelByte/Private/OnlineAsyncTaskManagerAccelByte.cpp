@@ -4,15 +4,820 @@
 
 #include "OnlineAsyncTaskManagerAccelByte.h"
 #include "OnlineSubsystemAccelByte.h"
+#include "OnlineAsyncTaskMetricsAccelByte.h"
+#include "AsyncTasks/OnlineAsyncTaskAccelByte.h"
+#include "OnlineSubsystemAccelByteTrace.h"
+#include "HAL/RunnableThread.h"
+#include <atomic>
+
+namespace
+{
+	/** Upper bound on worker threads, to keep a bad config value from spawning an absurd number of threads */
+	constexpr int32 MaxWorkerThreads = 64;
+
+	/** Time in milliseconds that an idle worker sleeps before checking for work again, in case it missed a wake up */
+	constexpr uint32 WorkerIdleWaitMs = 10;
+}
+
+const TCHAR* LexToString(EAccelByteAsyncTaskPriority Priority)
+{
+	switch (Priority)
+	{
+	case EAccelByteAsyncTaskPriority::High:
+		return TEXT("High");
+	case EAccelByteAsyncTaskPriority::Normal:
+		return TEXT("Normal");
+	case EAccelByteAsyncTaskPriority::Low:
+		return TEXT("Low");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+/**
+ * Runnable for a single worker in the async task manager's pool. Runs work items from its own queue, stealing from the
+ * other queues when its own is empty, and sleeps until woken once there is no work anywhere.
+ */
+class FOnlineAsyncTaskWorkerAccelByte : public FRunnable
+{
+public:
+
+	FOnlineAsyncTaskWorkerAccelByte(FOnlineAsyncTaskManagerAccelByte& InManager, int32 InQueueIndex)
+		: Manager(InManager)
+		, QueueIndex(InQueueIndex)
+		, WakeEvent(FPlatformProcess::GetSynchEventFromPool(false))
+	{
+	}
+
+	virtual ~FOnlineAsyncTaskWorkerAccelByte()
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bIsStopping)
+		{
+			if (!Manager.TryRunWorkItem(QueueIndex))
+			{
+				WakeEvent->Wait(WorkerIdleWaitMs);
+			}
+		}
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bIsStopping = true;
+		WakeEvent->Trigger();
+	}
+
+	void Wake()
+	{
+		WakeEvent->Trigger();
+	}
+
+private:
+
+	FOnlineAsyncTaskManagerAccelByte& Manager;
+
+	/** Index of the queue that this worker owns in the manager */
+	int32 QueueIndex;
+
+	/** Event used to wake this worker when new work is queued */
+	FEvent* WakeEvent;
+
+	/** Set once the worker has been asked to stop */
+	std::atomic<bool> bIsStopping{false};
+
+};
 
 FOnlineAsyncTaskManagerAccelByte::FOnlineAsyncTaskManagerAccelByte(FOnlineSubsystemAccelByte* ParentSubsystem)
 	:
 	AccelByteSubsystem(ParentSubsystem)
 {
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("AsyncTaskWorkerThreadCount"), NumWorkerThreads, GEngineIni);
+	NumWorkerThreads = FMath::Clamp(NumWorkerThreads, 0, MaxWorkerThreads);
+
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("AsyncTaskIdleTickIntervalSeconds"), IdleTickIntervalSeconds, GEngineIni);
+	IdleTickIntervalSeconds = FMath::Max(IdleTickIntervalSeconds, 0.001);
+
+	// High priority tasks are never held back, so only the other classes can be limited
+	int32& MaxInFlightNormalTasks = MaxInFlightTasks[static_cast<int32>(EAccelByteAsyncTaskPriority::Normal)];
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("AsyncTaskMaxInFlightNormalPriority"), MaxInFlightNormalTasks, GEngineIni);
+	MaxInFlightNormalTasks = FMath::Max(MaxInFlightNormalTasks, 0);
+
+	int32& MaxInFlightLowTasks = MaxInFlightTasks[static_cast<int32>(EAccelByteAsyncTaskPriority::Low)];
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("AsyncTaskMaxInFlightLowPriority"), MaxInFlightLowTasks, GEngineIni);
+	MaxInFlightLowTasks = FMath::Max(MaxInFlightLowTasks, 0);
+
+	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableAsyncTaskDeduplication"), bIsDeduplicationEnabled, GEngineIni);
+
+	double GameThreadBudgetMs = 0.0;
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("AsyncTaskGameThreadBudgetMs"), GameThreadBudgetMs, GEngineIni);
+	GameThreadBudgetSeconds = FMath::Max(GameThreadBudgetMs, 0.0) / 1000.0;
+
+	if (AccelByteSubsystem != nullptr)
+	{
+		Metrics = AccelByteSubsystem->GetAsyncTaskMetrics();
+	}
+}
+
+FOnlineAsyncTaskManagerAccelByte::~FOnlineAsyncTaskManagerAccelByte()
+{
+	StopWorkers();
+
+	// Finished items carried over to a frame that never came have to be cleaned up here
+	while (FOnlineAsyncItem* Item = PopGameThreadItem())
+	{
+		delete Item;
+	}
+
+	// Tasks still waiting on an in flight slot were never started, so nothing else will clean them up
+	FScopeLock ScopeLock(&PriorityLock);
+	for (TArray<FOnlineAsyncTaskAccelByte*>& Tasks : WaitingTasks)
+	{
+		for (FOnlineAsyncTaskAccelByte* Task : Tasks)
+		{
+			delete Task;
+		}
+		Tasks.Empty();
+	}
+
+	// Same goes for tasks merged into one that never finished
+	FScopeLock DeduplicationScopeLock(&DeduplicationLock);
+	for (TPair<const FOnlineAsyncTask*, FDeduplicatedTask>& Pair : DeduplicatedTasks)
+	{
+		for (FOnlineAsyncTaskAccelByte* Task : Pair.Value.Duplicates)
+		{
+			delete Task;
+		}
+	}
+	DeduplicatedTasks.Empty();
+	DeduplicationKeyToTask.Empty();
 }
 
 void FOnlineAsyncTaskManagerAccelByte::OnlineTick()
 {
 	check(AccelByteSubsystem);
 	check(FPlatformTLS::GetCurrentThreadId() == OnlineThreadId);
-}
\ No newline at end of file
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::Init()
+{
+	const bool bResult = FOnlineAsyncTaskManager::Init();
+	DefaultPollingInterval = PollingInterval;
+	StartWorkers();
+	return bResult;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::Stop()
+{
+	FOnlineAsyncTaskManager::Stop();
+	for (const TUniquePtr<FOnlineAsyncTaskWorkerAccelByte>& Worker : Workers)
+	{
+		Worker->Stop();
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::Exit()
+{
+	StopWorkers();
+	FOnlineAsyncTaskManager::Exit();
+}
+
+void FOnlineAsyncTaskManagerAccelByte::AddToParallelTasks(FOnlineAsyncTaskAccelByte* NewTask)
+{
+	if (TryMergeDuplicateTask(NewTask))
+	{
+		return;
+	}
+
+	const int32 PriorityIndex = static_cast<int32>(NewTask->GetPriority());
+
+	// Track the task before handing it over, as the online thread may pick it up as soon as it is in the parallel tasks
+	{
+		FScopeLock ScopeLock(&AccelByteTasksLock);
+		AccelByteTasks.Add(NewTask, PriorityIndex);
+	}
+
+	// Wait behind anything already waiting in the same class, so that tasks of a class start in dispatch order
+	{
+		FScopeLock ScopeLock(&PriorityLock);
+		const int32 MaxInFlight = MaxInFlightTasks[PriorityIndex];
+		if (MaxInFlight > 0 && (NumInFlightTasks[PriorityIndex] >= MaxInFlight || WaitingTasks[PriorityIndex].Num() > 0))
+		{
+			WaitingTasks[PriorityIndex].Add(NewTask);
+			UE_LOG_AB(VeryVerbose, TEXT("Async task '%s' is waiting on one of %d %s priority tasks in flight"), *NewTask->GetTaskName(), NumInFlightTasks[PriorityIndex], LexToString(NewTask->GetPriority()));
+			return;
+		}
+		NumInFlightTasks[PriorityIndex]++;
+	}
+
+	StartParallelTask(NewTask);
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::TryMergeDuplicateTask(FOnlineAsyncTaskAccelByte* NewTask)
+{
+	if (!bIsDeduplicationEnabled)
+	{
+		return false;
+	}
+
+	FString Key = NewTask->GetDeduplicationKey();
+	if (Key.IsEmpty())
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&DeduplicationLock);
+	FOnlineAsyncTaskAccelByte** FoundTask = DeduplicationKeyToTask.Find(Key);
+	if (FoundTask != nullptr)
+	{
+		DeduplicatedTasks.FindChecked(*FoundTask).Duplicates.Add(NewTask);
+		UE_LOG_AB(Verbose, TEXT("Merged async task into an identical task already in flight, key: %s"), *Key);
+		return true;
+	}
+
+	DeduplicationKeyToTask.Add(Key, NewTask);
+	FDeduplicatedTask& DeduplicatedTask = DeduplicatedTasks.Add(NewTask);
+	DeduplicatedTask.Key = MoveTemp(Key);
+	return false;
+}
+
+TArray<FOnlineAsyncTaskAccelByte*> FOnlineAsyncTaskManagerAccelByte::TakeDuplicateTasks(const FOnlineAsyncTask* Task)
+{
+	check(IsInGameThread());
+
+	FScopeLock ScopeLock(&DeduplicationLock);
+	FDeduplicatedTask DeduplicatedTask;
+	if (!DeduplicatedTasks.RemoveAndCopyValue(Task, DeduplicatedTask))
+	{
+		return TArray<FOnlineAsyncTaskAccelByte*>();
+	}
+
+	DeduplicationKeyToTask.Remove(DeduplicatedTask.Key);
+	return MoveTemp(DeduplicatedTask.Duplicates);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::StartParallelTask(FOnlineAsyncTaskAccelByte* Task)
+{
+	// Same as the base manager, but noting when Initialize returns, as that is where tasks send their first request
+	{
+		AB_OSS_TRACE_DYNAMIC_SCOPE(Task->GetTraceEventName(TEXT("Initialize")));
+		Task->Initialize();
+	}
+	Task->MarkRequestSent();
+	{
+		FScopeLock ScopeLock(&ParallelTasksLock);
+		ParallelTasks.Add(Task);
+	}
+	WakeOnlineThread();
+}
+
+void FOnlineAsyncTaskManagerAccelByte::ReleasePrioritySlot(int32 PriorityIndex)
+{
+	check(IsInGameThread());
+
+	TArray<FOnlineAsyncTaskAccelByte*, TInlineAllocator<4>> TasksToStart;
+	{
+		FScopeLock ScopeLock(&PriorityLock);
+		NumInFlightTasks[PriorityIndex]--;
+
+		TArray<FOnlineAsyncTaskAccelByte*>& Waiting = WaitingTasks[PriorityIndex];
+		const int32 MaxInFlight = MaxInFlightTasks[PriorityIndex];
+		while (Waiting.Num() > 0 && (MaxInFlight <= 0 || NumInFlightTasks[PriorityIndex] < MaxInFlight))
+		{
+			TasksToStart.Add(Waiting[0]);
+			Waiting.RemoveAt(0, 1, false);
+			NumInFlightTasks[PriorityIndex]++;
+		}
+	}
+
+	for (FOnlineAsyncTaskAccelByte* Task : TasksToStart)
+	{
+		StartParallelTask(Task);
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::AddToInQueue(FOnlineAsyncTaskAccelByte* NewTask)
+{
+	{
+		FScopeLock ScopeLock(&AccelByteTasksLock);
+		AccelByteTasks.Add(NewTask, INDEX_NONE);
+	}
+
+	FOnlineAsyncTaskManager::AddToInQueue(NewTask);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::GameTick()
+{
+	check(IsInGameThread());
+
+	const double GameTickStartedInSeconds = FPlatformTime::Seconds();
+
+	TakeOutQueueItems();
+
+	// Time overspent in earlier frames comes out of this frame's budget, but we still always finalize at least one item
+	const double FrameBudgetSeconds = FMath::Max(GameThreadBudgetSeconds - GameThreadBudgetDebtSeconds, 0.0);
+	while (FOnlineAsyncItem* Item = PopGameThreadItem())
+	{
+		FinalizeItem(Item);
+
+		if (GameThreadBudgetSeconds > 0.0 && FPlatformTime::Seconds() - GameTickStartedInSeconds >= FrameBudgetSeconds)
+		{
+			break;
+		}
+	}
+	const double ElapsedSeconds = FPlatformTime::Seconds() - GameTickStartedInSeconds;
+
+	bool bWasOverBudget = false;
+	if (GameThreadBudgetSeconds > 0.0)
+	{
+		// Only ever carry over up to a single frame's budget of debt, so one very slow task cannot stall later frames
+		bWasOverBudget = ElapsedSeconds > GameThreadBudgetSeconds;
+		GameThreadBudgetDebtSeconds = FMath::Clamp(GameThreadBudgetDebtSeconds + ElapsedSeconds - GameThreadBudgetSeconds, 0.0, GameThreadBudgetSeconds);
+	}
+
+	if (Metrics.IsValid())
+	{
+		Metrics->RecordGameTick(ElapsedSeconds, GetNumGameThreadItems(), bWasOverBudget);
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::TakeOutQueueItems()
+{
+	TArray<FOnlineAsyncItem*> NewItems;
+	{
+		FScopeLock ScopeLock(&OutQueueLock);
+		NewItems = MoveTemp(OutQueue);
+		OutQueue.Reset();
+	}
+
+	if (Metrics.IsValid())
+	{
+		Metrics->RecordOutQueueDepth(NewItems.Num() + GetNumGameThreadItems());
+	}
+
+	if (NewItems.Num() == 0)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&AccelByteTasksLock);
+	for (FOnlineAsyncItem* Item : NewItems)
+	{
+		EAccelByteAsyncTaskPriority Priority = EAccelByteAsyncTaskPriority::Normal;
+		if (AccelByteTasks.Contains(static_cast<const FOnlineAsyncTask*>(Item)))
+		{
+			Priority = static_cast<const FOnlineAsyncTaskAccelByte*>(Item)->GetPriority();
+		}
+		GameThreadQueues[static_cast<int32>(Priority)].Items.Add(Item);
+	}
+}
+
+FOnlineAsyncItem* FOnlineAsyncTaskManagerAccelByte::PopGameThreadItem()
+{
+	for (FGameThreadQueue& Queue : GameThreadQueues)
+	{
+		if (Queue.Num() <= 0)
+		{
+			continue;
+		}
+
+		FOnlineAsyncItem* Item = Queue.Items[Queue.Head++];
+		if (Queue.Num() == 0)
+		{
+			Queue.Items.Reset();
+			Queue.Head = 0;
+		}
+		else if (Queue.Head >= Queue.Items.Num() / 2)
+		{
+			// Drop taken items from the front once they make up half the queue, rather than shifting on every pop
+			Queue.Items.RemoveAt(0, Queue.Head);
+			Queue.Head = 0;
+		}
+		return Item;
+	}
+	return nullptr;
+}
+
+int32 FOnlineAsyncTaskManagerAccelByte::GetNumGameThreadItems() const
+{
+	int32 NumItems = 0;
+	for (const FGameThreadQueue& Queue : GameThreadQueues)
+	{
+		NumItems += Queue.Num();
+	}
+	return NumItems;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::FinalizeItem(FOnlineAsyncItem* Item)
+{
+	bool bIsAccelByteTask = false;
+	int32 PriorityIndex = INDEX_NONE;
+	{
+		FScopeLock ScopeLock(&AccelByteTasksLock);
+		bIsAccelByteTask = AccelByteTasks.RemoveAndCopyValue(static_cast<const FOnlineAsyncTask*>(Item), PriorityIndex);
+	}
+
+	// Stop merging into the task before running any of its delegates, so that anything they dispatch starts afresh
+	TArray<FOnlineAsyncTaskAccelByte*> DuplicateTasks;
+	if (bIsAccelByteTask)
+	{
+		DuplicateTasks = TakeDuplicateTasks(static_cast<const FOnlineAsyncTask*>(Item));
+	}
+
+	const double FinalizeStartedInSeconds = FPlatformTime::Seconds();
+	{
+		AB_OSS_TRACE_DYNAMIC_SCOPE(bIsAccelByteTask ? static_cast<const FOnlineAsyncTaskAccelByte*>(Item)->GetTraceEventName(TEXT("Finalize")) : FString(TEXT("FOnlineAsyncItem::Finalize")));
+		Item->Finalize();
+	}
+	const double DelegatesStartedInSeconds = FPlatformTime::Seconds();
+	{
+		AB_OSS_TRACE_DYNAMIC_SCOPE(bIsAccelByteTask ? static_cast<const FOnlineAsyncTaskAccelByte*>(Item)->GetTraceEventName(TEXT("TriggerDelegates")) : FString(TEXT("FOnlineAsyncItem::TriggerDelegates")));
+		Item->TriggerDelegates();
+	}
+
+	if (bIsAccelByteTask)
+	{
+		FOnlineAsyncTaskAccelByte* AccelByteTask = static_cast<FOnlineAsyncTaskAccelByte*>(Item);
+		if (Metrics.IsValid())
+		{
+			AccelByteTask->RecordMetrics(*Metrics, FinalizeStartedInSeconds, DelegatesStartedInSeconds, FPlatformTime::Seconds());
+		}
+
+		// Make sure no SDK callback is running against the task, or can run against it, once we delete it
+		AccelByteTask->CancelPendingRequests();
+
+		// Tasks merged into this one were never started, so all that is left is reporting the results to their callers
+		for (FOnlineAsyncTaskAccelByte* DuplicateTask : DuplicateTasks)
+		{
+			DuplicateTask->AdoptResultsFrom(*AccelByteTask);
+			{
+				AB_OSS_TRACE_DYNAMIC_SCOPE(DuplicateTask->GetTraceEventName(TEXT("TriggerDelegates")));
+				DuplicateTask->TriggerDelegates();
+			}
+			delete DuplicateTask;
+		}
+	}
+
+	delete Item;
+
+	if (PriorityIndex != INDEX_NONE)
+	{
+		ReleasePrioritySlot(PriorityIndex);
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::WakeOnlineThread()
+{
+	if (WorkEvent != nullptr)
+	{
+		WorkEvent->Trigger();
+	}
+}
+
+FString FOnlineAsyncTaskManagerAccelByte::GetTraceEventName(const FOnlineAsyncTask* Task, const TCHAR* Phase)
+{
+	{
+		FScopeLock ScopeLock(&AccelByteTasksLock);
+		if (AccelByteTasks.Contains(Task))
+		{
+			return static_cast<const FOnlineAsyncTaskAccelByte*>(Task)->GetTraceEventName(Phase);
+		}
+	}
+	return FString::Printf(TEXT("FOnlineAsyncTask::%s"), Phase);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::TickTask(FOnlineAsyncTask* Task)
+{
+	AB_OSS_TRACE_DYNAMIC_SCOPE(GetTraceEventName(Task, TEXT("Tick")));
+	Task->Tick();
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::HasSerialWork()
+{
+	// The active serial task is only ever changed from the online thread, which is where we are called from
+	if (ActiveTask != nullptr)
+	{
+		return true;
+	}
+
+	FScopeLock ScopeLock(&InQueueLock);
+	return InQueue.Num() > 0;
+}
+
+void FOnlineAsyncTaskManagerAccelByte::Tick()
+{
+	// Take every parallel task for this tick. The base tick then finds none, so it only runs the online tick and the
+	// serial task, while we tick just the parallel tasks that need it.
+	TArray<FOnlineAsyncTask*> TasksToTick;
+	{
+		FScopeLock ScopeLock(&ParallelTasksLock);
+		TasksToTick = MoveTemp(ParallelTasks);
+		ParallelTasks.Reset();
+	}
+
+	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+	TArray<FOnlineAsyncTask*> DueTasks;
+	bool bHasUntrackedTasks = false;
+	{
+		FScopeLock ScopeLock(&AccelByteTasksLock);
+		for (FOnlineAsyncTask* Task : TasksToTick)
+		{
+			// Tasks that are not ours have no way to ask for a tick, so they are ticked every time like the base manager does
+			if (!AccelByteTasks.Contains(Task))
+			{
+				bHasUntrackedTasks = true;
+				DueTasks.Add(Task);
+			}
+			else if (static_cast<FOnlineAsyncTaskAccelByte*>(Task)->ShouldTick(CurrentTimeInSeconds, IdleTickIntervalSeconds))
+			{
+				DueTasks.Add(Task);
+			}
+		}
+	}
+
+	BuildWorkItems(DueTasks);
+	if (Workers.Num() > 0)
+	{
+		QueueWorkItems();
+		{
+			AB_OSS_TRACE_SCOPE("FOnlineAsyncTaskManagerAccelByte::TickSerialTasks");
+			FOnlineAsyncTaskManager::Tick();
+		}
+
+		// Help out with whatever is left, then block until the worker finishing the last item wakes us. The event may still
+		// be set from an earlier tick where we saw the count reach zero before waiting, so check the count again on waking.
+		while (TryRunWorkItem(Workers.Num()))
+		{
+		}
+		while (NumPendingWorkItems.GetValue() > 0)
+		{
+			WorkItemsCompleteEvent->Wait();
+		}
+	}
+	else
+	{
+		{
+			AB_OSS_TRACE_SCOPE("FOnlineAsyncTaskManagerAccelByte::TickSerialTasks");
+			FOnlineAsyncTaskManager::Tick();
+		}
+		for (const TArray<FOnlineAsyncTask*, TInlineAllocator<4>>& WorkItem : WorkItems)
+		{
+			for (FOnlineAsyncTask* Task : WorkItem)
+			{
+				TickTask(Task);
+			}
+		}
+	}
+
+	// Put unfinished tasks back ahead of anything dispatched during this tick, so that dispatch order is kept
+	TArray<FOnlineAsyncTask*> CompletedTasks;
+	TArray<FOnlineAsyncTask*> UnfinishedTasks;
+	{
+		FScopeLock ScopeLock(&ParallelTasksLock);
+		TArray<FOnlineAsyncTask*> TasksAddedDuringTick = MoveTemp(ParallelTasks);
+		ParallelTasks.Reset(TasksToTick.Num() + TasksAddedDuringTick.Num());
+		for (FOnlineAsyncTask* Task : TasksToTick)
+		{
+			if (Task->IsDone())
+			{
+				CompletedTasks.Add(Task);
+			}
+			else
+			{
+				ParallelTasks.Add(Task);
+				UnfinishedTasks.Add(Task);
+			}
+		}
+		ParallelTasks.Append(TasksAddedDuringTick);
+	}
+
+	// Work out how long we can sleep before one of our tasks is due a tick. Tasks asking for a tick sooner will wake us.
+	uint32 NextPollingInterval = DefaultPollingInterval;
+	{
+		FScopeLock ScopeLock(&AccelByteTasksLock);
+		if (!bHasUntrackedTasks && !HasSerialWork())
+		{
+			double NextTickTimeInSeconds = CurrentTimeInSeconds + IdleTickIntervalSeconds;
+			for (const FOnlineAsyncTask* Task : UnfinishedTasks)
+			{
+				NextTickTimeInSeconds = FMath::Min(NextTickTimeInSeconds, static_cast<const FOnlineAsyncTaskAccelByte*>(Task)->GetNextTickTimeInSeconds(IdleTickIntervalSeconds));
+			}
+
+			const double SecondsUntilNextTick = NextTickTimeInSeconds - FPlatformTime::Seconds();
+			NextPollingInterval = static_cast<uint32>(FMath::Clamp(FMath::CeilToInt(SecondsUntilNextTick * 1000.0), 1, FMath::CeilToInt(IdleTickIntervalSeconds * 1000.0)));
+		}
+	}
+	PollingInterval = NextPollingInterval;
+
+	if (Metrics.IsValid() && Metrics->IsEnabled())
+	{
+		int32 NumSerialTasks = 0;
+		{
+			FScopeLock ScopeLock(&InQueueLock);
+			NumSerialTasks = InQueue.Num() + ((ActiveTask != nullptr) ? 1 : 0);
+		}
+		Metrics->RecordTaskQueueDepth(UnfinishedTasks.Num(), NumSerialTasks);
+	}
+
+	for (FOnlineAsyncTask* Task : CompletedTasks)
+	{
+		UE_LOG_AB(Verbose, TEXT("Async task '%s' completed in %f seconds with %d"), *Task->ToString(), Task->GetElapsedTime(), Task->WasSuccessful());
+		AddToOutQueue(Task);
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::StartWorkers()
+{
+	if (NumWorkerThreads <= 0 || Workers.Num() > 0)
+	{
+		return;
+	}
+
+	WorkItemsCompleteEvent = FPlatformProcess::GetSynchEventFromPool(false);
+
+	// One queue per worker, plus one for the online thread
+	for (int32 QueueIndex = 0; QueueIndex <= NumWorkerThreads; QueueIndex++)
+	{
+		WorkQueues.Add(MakeUnique<FWorkQueue>());
+	}
+
+	for (int32 WorkerIndex = 0; WorkerIndex < NumWorkerThreads; WorkerIndex++)
+	{
+		TUniquePtr<FOnlineAsyncTaskWorkerAccelByte> Worker = MakeUnique<FOnlineAsyncTaskWorkerAccelByte>(*this, WorkerIndex);
+		FRunnableThread* WorkerThread = FRunnableThread::Create(Worker.Get(), *FString::Printf(TEXT("OnlineAsyncTaskWorker %d"), WorkerIndex));
+		if (WorkerThread == nullptr)
+		{
+			UE_LOG_AB(Warning, TEXT("Failed to create async task worker thread %d, running with %d worker(s) instead"), WorkerIndex, Workers.Num());
+			break;
+		}
+
+		Workers.Add(MoveTemp(Worker));
+		WorkerThreads.Emplace(WorkerThread);
+	}
+
+	// The online thread's queue always sits right after the last worker that actually started
+	WorkQueues.SetNum(Workers.Num() + 1);
+	NumWorkerThreads = Workers.Num();
+	UE_LOG_AB(Log, TEXT("Ticking parallel async tasks from %d worker thread(s) and the online thread"), Workers.Num());
+}
+
+void FOnlineAsyncTaskManagerAccelByte::StopWorkers()
+{
+	for (const TUniquePtr<FOnlineAsyncTaskWorkerAccelByte>& Worker : Workers)
+	{
+		Worker->Stop();
+	}
+
+	for (TUniquePtr<FRunnableThread>& WorkerThread : WorkerThreads)
+	{
+		WorkerThread->WaitForCompletion();
+	}
+
+	WorkerThreads.Empty();
+	Workers.Empty();
+	WorkQueues.Empty();
+
+	if (WorkItemsCompleteEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkItemsCompleteEvent);
+		WorkItemsCompleteEvent = nullptr;
+	}
+}
+
+void FOnlineAsyncTaskManagerAccelByte::BuildWorkItems(const TArray<FOnlineAsyncTask*>& TasksToTick)
+{
+	WorkItems.Reset();
+
+	// Tasks with an ordering key share one work item per key, keeping their relative order. Everything else gets its own.
+	// Each work item takes the highest priority of the tasks in it.
+	TMap<int32, int32> OrderingKeyToWorkItemIndex;
+	TArray<int32> WorkItemPriorities;
+	bool bHasMixedPriorities = false;
+	{
+		FScopeLock ScopeLock(&AccelByteTasksLock);
+		for (FOnlineAsyncTask* Task : TasksToTick)
+		{
+			int32 OrderingKey = INVALID_CONTROLLERID;
+			int32 PriorityIndex = static_cast<int32>(EAccelByteAsyncTaskPriority::Normal);
+			if (AccelByteTasks.Contains(Task))
+			{
+				const FOnlineAsyncTaskAccelByte* AccelByteTask = static_cast<const FOnlineAsyncTaskAccelByte*>(Task);
+				OrderingKey = AccelByteTask->GetOrderingKey();
+				PriorityIndex = static_cast<int32>(AccelByteTask->GetPriority());
+			}
+			bHasMixedPriorities |= (WorkItemPriorities.Num() > 0 && WorkItemPriorities[0] != PriorityIndex);
+
+			int32 WorkItemIndex = INDEX_NONE;
+			if (OrderingKey != INVALID_CONTROLLERID)
+			{
+				WorkItemIndex = OrderingKeyToWorkItemIndex.FindOrAdd(OrderingKey, INDEX_NONE);
+			}
+
+			if (WorkItemIndex == INDEX_NONE)
+			{
+				WorkItemIndex = WorkItems.AddDefaulted();
+				WorkItemPriorities.Add(PriorityIndex);
+				if (OrderingKey != INVALID_CONTROLLERID)
+				{
+					OrderingKeyToWorkItemIndex.Add(OrderingKey, WorkItemIndex);
+				}
+			}
+			WorkItems[WorkItemIndex].Add(Task);
+			WorkItemPriorities[WorkItemIndex] = FMath::Min(WorkItemPriorities[WorkItemIndex], PriorityIndex);
+		}
+	}
+
+	if (!bHasMixedPriorities)
+	{
+		return;
+	}
+
+	// Stable sort so that work items within a class stay in dispatch order
+	TArray<int32> SortedWorkItemIndices;
+	SortedWorkItemIndices.Reserve(WorkItems.Num());
+	for (int32 WorkItemIndex = 0; WorkItemIndex < WorkItems.Num(); WorkItemIndex++)
+	{
+		SortedWorkItemIndices.Add(WorkItemIndex);
+	}
+	SortedWorkItemIndices.StableSort([&WorkItemPriorities](int32 A, int32 B)
+	{
+		return WorkItemPriorities[A] < WorkItemPriorities[B];
+	});
+
+	TArray<TArray<FOnlineAsyncTask*, TInlineAllocator<4>>> SortedWorkItems;
+	SortedWorkItems.Reserve(WorkItems.Num());
+	for (int32 WorkItemIndex : SortedWorkItemIndices)
+	{
+		SortedWorkItems.Add(MoveTemp(WorkItems[WorkItemIndex]));
+	}
+	WorkItems = MoveTemp(SortedWorkItems);
+}
+
+void FOnlineAsyncTaskManagerAccelByte::QueueWorkItems()
+{
+	if (WorkItems.Num() <= 0)
+	{
+		return;
+	}
+
+	NumPendingWorkItems.Set(WorkItems.Num());
+	for (int32 WorkItemIndex = 0; WorkItemIndex < WorkItems.Num(); WorkItemIndex++)
+	{
+		FWorkQueue& Queue = *WorkQueues[WorkItemIndex % WorkQueues.Num()];
+		FScopeLock ScopeLock(&Queue.Lock);
+		Queue.WorkItemIndices.Add(WorkItemIndex);
+	}
+
+	for (const TUniquePtr<FOnlineAsyncTaskWorkerAccelByte>& Worker : Workers)
+	{
+		Worker->Wake();
+	}
+}
+
+bool FOnlineAsyncTaskManagerAccelByte::TryRunWorkItem(int32 QueueIndex)
+{
+	int32 WorkItemIndex = INDEX_NONE;
+
+	// Take the oldest, so highest priority, item from our own queue, otherwise steal the newest item from someone else's,
+	// leaving the owner its higher priority work
+	{
+		FWorkQueue& OwnQueue = *WorkQueues[QueueIndex];
+		FScopeLock ScopeLock(&OwnQueue.Lock);
+		if (OwnQueue.WorkItemIndices.Num() > 0)
+		{
+			WorkItemIndex = OwnQueue.WorkItemIndices[0];
+			OwnQueue.WorkItemIndices.RemoveAt(0, 1, false);
+		}
+	}
+
+	for (int32 Offset = 1; WorkItemIndex == INDEX_NONE && Offset < WorkQueues.Num(); Offset++)
+	{
+		FWorkQueue& VictimQueue = *WorkQueues[(QueueIndex + Offset) % WorkQueues.Num()];
+		FScopeLock ScopeLock(&VictimQueue.Lock);
+		if (VictimQueue.WorkItemIndices.Num() > 0)
+		{
+			WorkItemIndex = VictimQueue.WorkItemIndices.Pop(false);
+		}
+	}
+
+	if (WorkItemIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	for (FOnlineAsyncTask* Task : WorkItems[WorkItemIndex])
+	{
+		TickTask(Task);
+	}
+
+	if (NumPendingWorkItems.Decrement() == 0)
+	{
+		WorkItemsCompleteEvent->Trigger();
+	}
+	return true;
+}
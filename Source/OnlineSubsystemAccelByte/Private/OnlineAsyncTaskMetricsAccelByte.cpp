@@ -0,0 +1,284 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineAsyncTaskMetricsAccelByte.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Misc/OutputDevice.h"
+
+namespace
+{
+	/** Upper bound of the first histogram bucket, in seconds */
+	constexpr double MinBucketSeconds = 0.00001;
+
+	/** Ratio between the upper bounds of neighbouring histogram buckets */
+	constexpr double BucketGrowth = 1.25;
+
+	/** Get the time between two timestamps, or a negative value if either was never recorded */
+	double GetStageSeconds(double StartTime, double EndTime)
+	{
+		if (StartTime <= 0.0 || EndTime <= 0.0)
+		{
+			return -1.0;
+		}
+		return FMath::Max(EndTime - StartTime, 0.0);
+	}
+}
+
+const TCHAR* LexToString(EAccelByteAsyncTaskStage Stage)
+{
+	switch (Stage)
+	{
+	case EAccelByteAsyncTaskStage::Queue:
+		return TEXT("Queue");
+	case EAccelByteAsyncTaskStage::Request:
+		return TEXT("Request");
+	case EAccelByteAsyncTaskStage::Work:
+		return TEXT("Work");
+	case EAccelByteAsyncTaskStage::Handoff:
+		return TEXT("Handoff");
+	case EAccelByteAsyncTaskStage::Finalize:
+		return TEXT("Finalize");
+	case EAccelByteAsyncTaskStage::Delegates:
+		return TEXT("Delegates");
+	case EAccelByteAsyncTaskStage::Total:
+		return TEXT("Total");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::FLatencyHistogram::Add(double Seconds)
+{
+	int32 BucketIndex = 0;
+	if (Seconds > MinBucketSeconds)
+	{
+		BucketIndex = FMath::Clamp(FMath::CeilToInt(FMath::Loge(Seconds / MinBucketSeconds) / FMath::Loge(BucketGrowth)), 0, NumBuckets - 1);
+	}
+
+	Buckets[BucketIndex]++;
+	Count++;
+	SumSeconds += Seconds;
+	MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+}
+
+double FOnlineAsyncTaskMetricsAccelByte::FLatencyHistogram::GetPercentile(double Percentile) const
+{
+	const uint32 TargetCount = static_cast<uint32>(FMath::CeilToInt(Count * Percentile));
+	uint32 RunningCount = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; BucketIndex++)
+	{
+		RunningCount += Buckets[BucketIndex];
+		if (RunningCount >= TargetCount && RunningCount > 0)
+		{
+			// Never report more than the slowest sample, which also keeps the last open-ended bucket honest
+			return FMath::Min(MinBucketSeconds * FMath::Pow(BucketGrowth, static_cast<double>(BucketIndex)), MaxSeconds);
+		}
+	}
+	return MaxSeconds;
+}
+
+FAccelByteLatencySummary FOnlineAsyncTaskMetricsAccelByte::FLatencyHistogram::Summarize() const
+{
+	FAccelByteLatencySummary Summary;
+	if (Count <= 0)
+	{
+		return Summary;
+	}
+
+	Summary.Count = Count;
+	Summary.MeanSeconds = SumSeconds / Count;
+	Summary.P50Seconds = GetPercentile(0.50);
+	Summary.P95Seconds = GetPercentile(0.95);
+	Summary.P99Seconds = GetPercentile(0.99);
+	Summary.MaxSeconds = MaxSeconds;
+	return Summary;
+}
+
+FOnlineAsyncTaskMetricsAccelByte::FOnlineAsyncTaskMetricsAccelByte()
+{
+	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableAsyncTaskMetrics"), bIsEnabled, GEngineIni);
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::RecordTask(const FString& TaskName, const FAccelByteAsyncTaskTimestamps& Timestamps, bool bWasSuccessful, bool bTimedOut)
+{
+	if (!bIsEnabled)
+	{
+		return;
+	}
+
+	double StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Num)];
+	StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Queue)] = GetStageSeconds(Timestamps.Queued, Timestamps.Initialized);
+	StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Request)] = GetStageSeconds(Timestamps.RequestSent, Timestamps.ResponseReceived);
+	StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Work)] = GetStageSeconds(Timestamps.Initialized, Timestamps.Completed);
+	StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Handoff)] = GetStageSeconds(Timestamps.Completed, Timestamps.FinalizeStarted);
+	StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Finalize)] = GetStageSeconds(Timestamps.FinalizeStarted, Timestamps.DelegatesStarted);
+	StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Delegates)] = GetStageSeconds(Timestamps.DelegatesStarted, Timestamps.Done);
+	StageSeconds[static_cast<int32>(EAccelByteAsyncTaskStage::Total)] = GetStageSeconds(Timestamps.Queued, Timestamps.Done);
+
+	FScopeLock ScopeLock(&MetricsLock);
+	FTaskMetrics& Metrics = TaskMetrics.FindOrAdd(TaskName);
+	Metrics.NumCompleted++;
+	Metrics.NumSucceeded += bWasSuccessful ? 1 : 0;
+	Metrics.NumTimedOut += bTimedOut ? 1 : 0;
+	for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EAccelByteAsyncTaskStage::Num); StageIndex++)
+	{
+		if (StageSeconds[StageIndex] >= 0.0)
+		{
+			Metrics.Stages[StageIndex].Add(StageSeconds[StageIndex]);
+		}
+	}
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::RecordTaskQueueDepth(int32 NumParallelTasks, int32 NumSerialTasks)
+{
+	if (!bIsEnabled)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&MetricsLock);
+	QueueStats.NumParallelTasks = NumParallelTasks;
+	QueueStats.MaxParallelTasks = FMath::Max(QueueStats.MaxParallelTasks, NumParallelTasks);
+	QueueStats.NumSerialTasks = NumSerialTasks;
+	QueueStats.MaxSerialTasks = FMath::Max(QueueStats.MaxSerialTasks, NumSerialTasks);
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::RecordOutQueueDepth(int32 NumOutQueueItems)
+{
+	if (!bIsEnabled)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&MetricsLock);
+	QueueStats.NumOutQueueItems = NumOutQueueItems;
+	QueueStats.MaxOutQueueItems = FMath::Max(QueueStats.MaxOutQueueItems, NumOutQueueItems);
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::RecordGameTick(double TaskSeconds, int32 NumCarriedOverTasks, bool bWasOverBudget)
+{
+	if (!bIsEnabled)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&MetricsLock);
+	GameThreadTaskTime.Add(TaskSeconds);
+	GameThreadStats.NumFramesOverBudget += bWasOverBudget ? 1 : 0;
+	GameThreadStats.NumFramesWithCarryOver += (NumCarriedOverTasks > 0) ? 1 : 0;
+	GameThreadStats.NumCarriedOverTasks = NumCarriedOverTasks;
+	GameThreadStats.MaxCarriedOverTasks = FMath::Max(GameThreadStats.MaxCarriedOverTasks, NumCarriedOverTasks);
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::RecordGameThreadFrame(double FrameSeconds)
+{
+	if (!bIsEnabled)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&MetricsLock);
+	GameThreadFrameTime.Add(FrameSeconds);
+}
+
+TArray<FAccelByteAsyncTaskStats> FOnlineAsyncTaskMetricsAccelByte::GetTaskStats() const
+{
+	TArray<FAccelByteAsyncTaskStats> Result;
+	{
+		FScopeLock ScopeLock(&MetricsLock);
+		Result.Reserve(TaskMetrics.Num());
+		for (const TPair<FString, FTaskMetrics>& Pair : TaskMetrics)
+		{
+			FAccelByteAsyncTaskStats& Stats = Result.AddDefaulted_GetRef();
+			Stats.TaskName = Pair.Key;
+			Stats.NumCompleted = Pair.Value.NumCompleted;
+			Stats.NumSucceeded = Pair.Value.NumSucceeded;
+			Stats.NumTimedOut = Pair.Value.NumTimedOut;
+			for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EAccelByteAsyncTaskStage::Num); StageIndex++)
+			{
+				Stats.Stages[StageIndex] = Pair.Value.Stages[StageIndex].Summarize();
+			}
+		}
+	}
+
+	// Sort by time spent in total, so that whatever dominates shows up first
+	constexpr int32 TotalStageIndex = static_cast<int32>(EAccelByteAsyncTaskStage::Total);
+	Result.Sort([](const FAccelByteAsyncTaskStats& A, const FAccelByteAsyncTaskStats& B)
+	{
+		return A.Stages[TotalStageIndex].MeanSeconds * A.Stages[TotalStageIndex].Count > B.Stages[TotalStageIndex].MeanSeconds * B.Stages[TotalStageIndex].Count;
+	});
+	return Result;
+}
+
+FAccelByteAsyncTaskQueueStats FOnlineAsyncTaskMetricsAccelByte::GetQueueStats() const
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	return QueueStats;
+}
+
+FAccelByteGameThreadStats FOnlineAsyncTaskMetricsAccelByte::GetGameThreadStats() const
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	FAccelByteGameThreadStats Result = GameThreadStats;
+	Result.FrameTime = GameThreadFrameTime.Summarize();
+	Result.TaskTime = GameThreadTaskTime.Summarize();
+	return Result;
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::Reset()
+{
+	FScopeLock ScopeLock(&MetricsLock);
+	TaskMetrics.Empty();
+	QueueStats = FAccelByteAsyncTaskQueueStats();
+	GameThreadFrameTime = FLatencyHistogram();
+	GameThreadTaskTime = FLatencyHistogram();
+	GameThreadStats = FAccelByteGameThreadStats();
+}
+
+void FOnlineAsyncTaskMetricsAccelByte::Dump(FOutputDevice& Ar) const
+{
+	if (!bIsEnabled)
+	{
+		Ar.Logf(TEXT("Async task metrics are disabled, set bEnableAsyncTaskMetrics in the OnlineSubsystemAccelByte settings to enable them"));
+		return;
+	}
+
+	const FAccelByteAsyncTaskQueueStats Queues = GetQueueStats();
+	Ar.Logf(TEXT("Async task queues: parallel %d (max %d); serial %d (max %d); out queue %d (max %d)"),
+		Queues.NumParallelTasks, Queues.MaxParallelTasks, Queues.NumSerialTasks, Queues.MaxSerialTasks, Queues.NumOutQueueItems, Queues.MaxOutQueueItems);
+
+	const FAccelByteGameThreadStats GameThread = GetGameThreadStats();
+	Ar.Logf(TEXT("Game thread: %d frame(s) over budget; %d frame(s) carried tasks over; %d task(s) carried over (max %d)"),
+		GameThread.NumFramesOverBudget, GameThread.NumFramesWithCarryOver, GameThread.NumCarriedOverTasks, GameThread.MaxCarriedOverTasks);
+	const TPair<const TCHAR*, const FAccelByteLatencySummary*> GameThreadSummaries[] = {
+		{ TEXT("Frame"), &GameThread.FrameTime },
+		{ TEXT("Tasks"), &GameThread.TaskTime }
+	};
+	for (const TPair<const TCHAR*, const FAccelByteLatencySummary*>& Summary : GameThreadSummaries)
+	{
+		if (Summary.Value->Count > 0)
+		{
+			Ar.Logf(TEXT("    %-10s n=%-6d mean=%8.2fms p50=%8.2fms p95=%8.2fms p99=%8.2fms max=%8.2fms"),
+				Summary.Key, Summary.Value->Count,
+				Summary.Value->MeanSeconds * 1000.0, Summary.Value->P50Seconds * 1000.0, Summary.Value->P95Seconds * 1000.0, Summary.Value->P99Seconds * 1000.0, Summary.Value->MaxSeconds * 1000.0);
+		}
+	}
+
+	for (const FAccelByteAsyncTaskStats& Stats : GetTaskStats())
+	{
+		Ar.Logf(TEXT("%s: %d completed, %d succeeded, %d timed out"), *Stats.TaskName, Stats.NumCompleted, Stats.NumSucceeded, Stats.NumTimedOut);
+		for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EAccelByteAsyncTaskStage::Num); StageIndex++)
+		{
+			const FAccelByteLatencySummary& Stage = Stats.Stages[StageIndex];
+			if (Stage.Count <= 0)
+			{
+				continue;
+			}
+
+			Ar.Logf(TEXT("    %-10s n=%-6d mean=%8.2fms p50=%8.2fms p95=%8.2fms p99=%8.2fms max=%8.2fms"),
+				LexToString(static_cast<EAccelByteAsyncTaskStage>(StageIndex)), Stage.Count,
+				Stage.MeanSeconds * 1000.0, Stage.P50Seconds * 1000.0, Stage.P95Seconds * 1000.0, Stage.P99Seconds * 1000.0, Stage.MaxSeconds * 1000.0);
+		}
+	}
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineAsyncTaskPoolAccelByte.h"
+#include "Misc/OutputDevice.h"
+
+FOnlineAsyncTaskPoolAccelByte& FOnlineAsyncTaskPoolAccelByte::Get()
+{
+	// Deliberately never destroyed, as tasks may still be freed during static destruction
+	static FOnlineAsyncTaskPoolAccelByte* Instance = new FOnlineAsyncTaskPoolAccelByte();
+	return *Instance;
+}
+
+void* FOnlineAsyncTaskPoolAccelByte::Allocate(SIZE_T Size)
+{
+	const int32 SizeClassIndex = GetSizeClassIndex(Size);
+	if (SizeClassIndex == INDEX_NONE)
+	{
+		NumOversizedAllocations.fetch_add(1, std::memory_order_relaxed);
+		return FMemory::Malloc(Size);
+	}
+
+	FSizeClass& SizeClass = SizeClasses[SizeClassIndex];
+	{
+		FScopeLock ScopeLock(&SizeClass.Lock);
+		SizeClass.NumAllocations++;
+		if (SizeClass.FreeList != nullptr)
+		{
+			FFreeBlock* Block = SizeClass.FreeList;
+			SizeClass.FreeList = Block->Next;
+			SizeClass.NumFreeBlocks--;
+			SizeClass.NumReusedBlocks++;
+			return Block;
+		}
+	}
+
+	// Always allocate the full size of the class, so that the block can be reused by any task of the same class
+	return FMemory::Malloc((SizeClassIndex + 1) * SizeClassGranularity);
+}
+
+void FOnlineAsyncTaskPoolAccelByte::Free(void* Ptr, SIZE_T Size)
+{
+	if (Ptr == nullptr)
+	{
+		return;
+	}
+
+	const int32 SizeClassIndex = GetSizeClassIndex(Size);
+	if (SizeClassIndex != INDEX_NONE)
+	{
+		FSizeClass& SizeClass = SizeClasses[SizeClassIndex];
+		FScopeLock ScopeLock(&SizeClass.Lock);
+		if (SizeClass.NumFreeBlocks < MaxFreeBlocksPerSizeClass)
+		{
+			FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+			Block->Next = SizeClass.FreeList;
+			SizeClass.FreeList = Block;
+			SizeClass.NumFreeBlocks++;
+			return;
+		}
+	}
+
+	FMemory::Free(Ptr);
+}
+
+void FOnlineAsyncTaskPoolAccelByte::Dump(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Async task pool: %llu oversized allocation(s)"), NumOversizedAllocations.load(std::memory_order_relaxed));
+	for (int32 SizeClassIndex = 0; SizeClassIndex < NumSizeClasses; SizeClassIndex++)
+	{
+		const FSizeClass& SizeClass = SizeClasses[SizeClassIndex];
+		FScopeLock ScopeLock(&SizeClass.Lock);
+		if (SizeClass.NumAllocations == 0)
+		{
+			continue;
+		}
+
+		Ar.Logf(TEXT("    %4llu bytes: %llu allocation(s), %llu reused (%.1f%%), %d free block(s)"),
+			static_cast<uint64>((SizeClassIndex + 1) * SizeClassGranularity),
+			SizeClass.NumAllocations,
+			SizeClass.NumReusedBlocks,
+			100.0 * static_cast<double>(SizeClass.NumReusedBlocks) / static_cast<double>(SizeClass.NumAllocations),
+			SizeClass.NumFreeBlocks);
+	}
+}
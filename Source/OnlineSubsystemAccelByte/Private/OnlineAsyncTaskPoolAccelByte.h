@@ -0,0 +1,90 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+#ifndef AB_OSS_ASYNC_TASK_POOL_ENABLED
+#define AB_OSS_ASYNC_TASK_POOL_ENABLED 1
+#endif
+
+/**
+ * Pool of memory blocks that our async task objects are allocated from, through the class operators on
+ * FOnlineAsyncTaskAccelByte, so that bursts of short lived tasks reuse the blocks of tasks that already finished rather
+ * than going back to the global allocator for every one.
+ *
+ * Blocks are grouped into size classes 64 bytes apart. A freed block goes on the free list for its size class, up to a
+ * fixed number of blocks per class, past which it is handed back to the global allocator. Tasks too large for every size
+ * class skip the pool entirely. As every task type of a similar size shares a class, this behaves like a pool per task
+ * type without needing to know each type up front.
+ *
+ * Compiled out by setting AB_OSS_ASYNC_TASK_POOL_ENABLED to 0. Pool usage is included in the `ONLINE TASKSTATS` console
+ * command. All methods are thread safe.
+ */
+class FOnlineAsyncTaskPoolAccelByte
+{
+public:
+	/**
+	 * Get the pool shared by every subsystem instance in the process
+	 */
+	static FOnlineAsyncTaskPoolAccelByte& Get();
+
+	/**
+	 * Allocate a block of at least the given size, reusing a freed block of the same size class if there is one
+	 */
+	void* Allocate(SIZE_T Size);
+
+	/**
+	 * Free a block from Allocate. Size must be the same as was passed to Allocate.
+	 */
+	void Free(void* Ptr, SIZE_T Size);
+
+	/**
+	 * Write how much each size class has been used to the output device passed in
+	 */
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	/** Difference in size between neighbouring size classes, which is also the size of the smallest class */
+	static constexpr SIZE_T SizeClassGranularity = 64;
+
+	/** Number of size classes, covering tasks up to 2KB */
+	static constexpr int32 NumSizeClasses = 32;
+
+	/** Most free blocks kept for each size class, which bounds the memory held on to after a burst of tasks */
+	static constexpr int32 MaxFreeBlocksPerSizeClass = 256;
+
+	/** Header written into a block while it sits on a free list */
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	/** Free list and usage counts for one size class */
+	struct FSizeClass
+	{
+		mutable FCriticalSection Lock;
+		FFreeBlock* FreeList = nullptr;
+		int32 NumFreeBlocks = 0;
+		uint64 NumAllocations = 0;
+		uint64 NumReusedBlocks = 0;
+	};
+
+	FSizeClass SizeClasses[NumSizeClasses];
+
+	/** Number of allocations too large for any size class */
+	std::atomic<uint64> NumOversizedAllocations{0};
+
+	/** Get the index of the size class for a block of the given size, or INDEX_NONE if it is too large to pool */
+	static int32 GetSizeClassIndex(SIZE_T Size)
+	{
+		const SIZE_T Index = (Size + SizeClassGranularity - 1) / SizeClassGranularity;
+		return (Index > 0 && Index <= NumSizeClasses) ? static_cast<int32>(Index - 1) : INDEX_NONE;
+	}
+
+	FOnlineAsyncTaskPoolAccelByte() = default;
+	~FOnlineAsyncTaskPoolAccelByte() = default;
+};
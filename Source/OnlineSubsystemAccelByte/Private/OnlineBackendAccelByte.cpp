@@ -0,0 +1,65 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineBackendAccelByte.h"
+#include "OnlineSubsystemAccelByte.h"
+#include "Api/AccelByteUserApi.h"
+#include "Api/AccelByteSessionApi.h"
+#include "Api/AccelByteLobbyApi.h"
+
+namespace
+{
+	/**
+	 * Check that the API client passed in can be used to send a request, failing the request through its error handler
+	 * otherwise, so that a task waiting on a response still hears back.
+	 */
+	bool CheckApiClient(const AccelByte::FApiClientPtr& ApiClient, const FErrorHandler& OnError)
+	{
+		if (ApiClient.IsValid())
+		{
+			return true;
+		}
+
+		UE_LOG_AB(Warning, TEXT("Failed to send backend request as the API client passed in is invalid!"));
+		OnError.ExecuteIfBound(static_cast<int32>(AccelByte::ErrorCodes::InvalidRequest), TEXT("Invalid API client"));
+		return false;
+	}
+}
+
+bool FOnlineBackendAccelByte::IsLiveBackend() const
+{
+	return true;
+}
+
+void FOnlineBackendAccelByte::BulkGetUserInfo(const AccelByte::FApiClientPtr& ApiClient, const TArray<FString>& UserIds, const THandler<FListBulkUserInfo>& OnSuccess, const FErrorHandler& OnError)
+{
+	if (CheckApiClient(ApiClient, OnError))
+	{
+		ApiClient->User.BulkGetUserInfo(UserIds, OnSuccess, OnError);
+	}
+}
+
+void FOnlineBackendAccelByte::BulkGetUserByOtherPlatformUserIds(const AccelByte::FApiClientPtr& ApiClient, EAccelBytePlatformType PlatformType, const TArray<FString>& PlatformUserIds, const THandler<FBulkPlatformUserIdResponse>& OnSuccess, const FErrorHandler& OnError)
+{
+	if (CheckApiClient(ApiClient, OnError))
+	{
+		ApiClient->User.BulkGetUserByOtherPlatformUserIds(PlatformType, PlatformUserIds, OnSuccess, OnError);
+	}
+}
+
+void FOnlineBackendAccelByte::QueryGameSessions(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteModelsV2GameSessionQuery& Query, const THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult>& OnSuccess, const FErrorHandler& OnError, int32 Offset, int32 Limit)
+{
+	if (CheckApiClient(ApiClient, OnError))
+	{
+		ApiClient->Session.QueryGameSessions(Query, OnSuccess, OnError, Offset, Limit);
+	}
+}
+
+void FOnlineBackendAccelByte::WritePartyStorage(const AccelByte::FApiClientPtr& ApiClient, const FString& PartyId, TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PartyStorageWriter, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler& OnError)
+{
+	if (CheckApiClient(ApiClient, OnError))
+	{
+		ApiClient->Lobby.WritePartyStorage(PartyId, MoveTemp(PartyStorageWriter), OnSuccess, OnError);
+	}
+}
@@ -0,0 +1,388 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineFakeBackendAccelByte.h"
+
+#if AB_OSS_FAKE_BACKEND_ENABLED
+
+#include "OnlineSubsystemAccelByte.h"
+#include "OnlineSessionInterfaceV2AccelByte.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+	/** Maximum players of each made up game session */
+	constexpr int32 ScriptedGameSessionMaxPlayers = 8;
+
+	bool PendingResponsePredicate(double LeftDueTime, uint64 LeftSequence, double RightDueTime, uint64 RightSequence)
+	{
+		return (LeftDueTime != RightDueTime) ? LeftDueTime < RightDueTime : LeftSequence < RightSequence;
+	}
+}
+
+const TCHAR* LexToString(EAccelByteFakeBackendOperation Operation)
+{
+	switch (Operation)
+	{
+	case EAccelByteFakeBackendOperation::BulkGetUserInfo: return TEXT("BulkGetUserInfo");
+	case EAccelByteFakeBackendOperation::QueryGameSessions: return TEXT("QueryGameSessions");
+	case EAccelByteFakeBackendOperation::WritePartyStorage: return TEXT("WritePartyStorage");
+	case EAccelByteFakeBackendOperation::BulkGetUserByOtherPlatformUserIds: return TEXT("BulkGetUserByOtherPlatformUserIds");
+	case EAccelByteFakeBackendOperation::LobbyNotification: return TEXT("LobbyNotification");
+	default: return TEXT("Unknown");
+	}
+}
+
+FOnlineFakeBackendAccelByte::FOnlineFakeBackendAccelByte(FOnlineSubsystemAccelByte* InSubsystem, int32 InRandomSeed)
+	: Subsystem(InSubsystem)
+	, Random(InRandomSeed)
+{
+}
+
+FAccelByteFakeBackendOperationSettings FOnlineFakeBackendAccelByte::GetSettings(EAccelByteFakeBackendOperation Operation) const
+{
+	check(Operation < EAccelByteFakeBackendOperation::Num);
+
+	FScopeLock ScopeLock(&Lock);
+	return Settings[static_cast<int32>(Operation)];
+}
+
+void FOnlineFakeBackendAccelByte::SetSettings(EAccelByteFakeBackendOperation Operation, const FAccelByteFakeBackendOperationSettings& InSettings)
+{
+	check(Operation < EAccelByteFakeBackendOperation::Num);
+
+	FScopeLock ScopeLock(&Lock);
+	Settings[static_cast<int32>(Operation)] = InSettings;
+}
+
+void FOnlineFakeBackendAccelByte::SetAllSettings(double MinLatencySeconds, double MaxLatencySeconds, float ErrorRate)
+{
+	FScopeLock ScopeLock(&Lock);
+	for (FAccelByteFakeBackendOperationSettings& OperationSettings : Settings)
+	{
+		OperationSettings.MinLatencySeconds = FMath::Max(MinLatencySeconds, 0.0);
+		OperationSettings.MaxLatencySeconds = FMath::Max(MaxLatencySeconds, OperationSettings.MinLatencySeconds);
+		OperationSettings.ErrorRate = FMath::Clamp(ErrorRate, 0.0f, 1.0f);
+	}
+}
+
+void FOnlineFakeBackendAccelByte::SetNumScriptedGameSessions(int32 InNumScriptedGameSessions)
+{
+	FScopeLock ScopeLock(&Lock);
+	NumScriptedGameSessions = FMath::Max(InNumScriptedGameSessions, 0);
+}
+
+bool FOnlineFakeBackendAccelByte::LoadRecording(const FString& FilePath)
+{
+	FString FileContents;
+	if (!FFileHelper::LoadFileToString(FileContents, *FilePath))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to load fake backend recording as file '%s' could not be read!"), *FilePath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> RecordingObject;
+	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(FileContents);
+	if (!FJsonSerializer::Deserialize(JsonReader, RecordingObject) || !RecordingObject.IsValid())
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to load fake backend recording as file '%s' is not a valid JSON object!"), *FilePath);
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	for (int32 OperationIndex = 0; OperationIndex < static_cast<int32>(EAccelByteFakeBackendOperation::Num); OperationIndex++)
+	{
+		const TSharedPtr<FJsonObject>* OperationObject = nullptr;
+		if (!RecordingObject->TryGetObjectField(LexToString(static_cast<EAccelByteFakeBackendOperation>(OperationIndex)), OperationObject))
+		{
+			continue;
+		}
+
+		FAccelByteFakeBackendOperationSettings& OperationSettings = Settings[OperationIndex];
+		double LatencyMs = 0.0;
+		if ((*OperationObject)->TryGetNumberField(TEXT("MinLatencyMs"), LatencyMs))
+		{
+			OperationSettings.MinLatencySeconds = FMath::Max(LatencyMs / 1000.0, 0.0);
+		}
+		if ((*OperationObject)->TryGetNumberField(TEXT("MaxLatencyMs"), LatencyMs))
+		{
+			OperationSettings.MaxLatencySeconds = FMath::Max(LatencyMs / 1000.0, 0.0);
+		}
+		OperationSettings.MaxLatencySeconds = FMath::Max(OperationSettings.MaxLatencySeconds, OperationSettings.MinLatencySeconds);
+
+		double ErrorRate = 0.0;
+		if ((*OperationObject)->TryGetNumberField(TEXT("ErrorRate"), ErrorRate))
+		{
+			OperationSettings.ErrorRate = FMath::Clamp(static_cast<float>(ErrorRate), 0.0f, 1.0f);
+		}
+
+		int32 ErrorCode = 0;
+		if ((*OperationObject)->TryGetNumberField(TEXT("ErrorCode"), ErrorCode))
+		{
+			OperationSettings.ErrorCode = ErrorCode;
+		}
+
+		const TSharedPtr<FJsonObject>* ResponseObject = nullptr;
+		if ((*OperationObject)->TryGetObjectField(TEXT("Response"), ResponseObject))
+		{
+			OperationSettings.RecordedResponse.Reset();
+			const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OperationSettings.RecordedResponse);
+			FJsonSerializer::Serialize(ResponseObject->ToSharedRef(), JsonWriter);
+		}
+	}
+
+	UE_LOG_AB(Log, TEXT("Loaded fake backend recording from '%s'"), *FilePath);
+	return true;
+}
+
+int32 FOnlineFakeBackendAccelByte::GetNumPendingResponses() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PendingResponses.Num();
+}
+
+bool FOnlineFakeBackendAccelByte::HasPendingResponses() const
+{
+	return GetNumPendingResponses() > 0;
+}
+
+void FOnlineFakeBackendAccelByte::GetOperationCounts(EAccelByteFakeBackendOperation Operation, int32& OutNumRequests, int32& OutNumErrors) const
+{
+	check(Operation < EAccelByteFakeBackendOperation::Num);
+
+	FScopeLock ScopeLock(&Lock);
+	OutNumRequests = NumRequests[static_cast<int32>(Operation)];
+	OutNumErrors = NumErrors[static_cast<int32>(Operation)];
+}
+
+void FOnlineFakeBackendAccelByte::QueueGameSessionMembersChangedNotification(int32 LocalUserNum, const FAccelByteModelsV2GameSessionMembersChangedEvent& Notification)
+{
+	QueueResponse(EAccelByteFakeBackendOperation::LobbyNotification, [Subsystem = Subsystem, LocalUserNum, Notification]() {
+#if AB_USE_V2_SESSIONS
+		const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+		if (SessionInterface.IsValid())
+		{
+			SessionInterface->OnGameSessionMembersChangedNotification(Notification, LocalUserNum);
+		}
+#endif
+	}, FErrorHandler());
+}
+
+void FOnlineFakeBackendAccelByte::QueueGameSessionUpdatedNotification(int32 LocalUserNum, const FAccelByteModelsV2GameSession& Notification)
+{
+	QueueResponse(EAccelByteFakeBackendOperation::LobbyNotification, [Subsystem = Subsystem, LocalUserNum, Notification]() {
+#if AB_USE_V2_SESSIONS
+		const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+		if (SessionInterface.IsValid())
+		{
+			SessionInterface->OnGameSessionUpdatedNotification(Notification, LocalUserNum);
+		}
+#endif
+	}, FErrorHandler());
+}
+
+void FOnlineFakeBackendAccelByte::QueuePartySessionMembersChangedNotification(int32 LocalUserNum, const FAccelByteModelsV2PartyMembersChangedEvent& Notification)
+{
+	QueueResponse(EAccelByteFakeBackendOperation::LobbyNotification, [Subsystem = Subsystem, LocalUserNum, Notification]() {
+#if AB_USE_V2_SESSIONS
+		const FOnlineSessionV2AccelBytePtr SessionInterface = StaticCastSharedPtr<FOnlineSessionV2AccelByte>(Subsystem->GetSessionInterface());
+		if (SessionInterface.IsValid())
+		{
+			SessionInterface->OnPartySessionMembersChangedNotification(Notification, LocalUserNum);
+		}
+#endif
+	}, FErrorHandler());
+}
+
+bool FOnlineFakeBackendAccelByte::IsLiveBackend() const
+{
+	return false;
+}
+
+void FOnlineFakeBackendAccelByte::Tick(float DeltaTime)
+{
+	// Pull every response that is due out of the heap first, as delivering a response may well queue another request
+	TArray<FPendingResponse> DueResponses;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const double CurrentTime = FPlatformTime::Seconds();
+		while (PendingResponses.Num() > 0 && PendingResponses.HeapTop().DueTime <= CurrentTime)
+		{
+			FPendingResponse& Response = DueResponses.AddDefaulted_GetRef();
+			PendingResponses.HeapPop(Response, [](const FPendingResponse& Left, const FPendingResponse& Right) {
+				return PendingResponsePredicate(Left.DueTime, Left.Sequence, Right.DueTime, Right.Sequence);
+			});
+		}
+	}
+
+	for (FPendingResponse& Response : DueResponses)
+	{
+		Response.Deliver();
+	}
+}
+
+void FOnlineFakeBackendAccelByte::BulkGetUserInfo(const AccelByte::FApiClientPtr& ApiClient, const TArray<FString>& UserIds, const THandler<FListBulkUserInfo>& OnSuccess, const FErrorHandler& OnError)
+{
+	FListBulkUserInfo Result;
+	if (!GetRecordedResponse(EAccelByteFakeBackendOperation::BulkGetUserInfo, Result))
+	{
+		Result.Data.Reserve(UserIds.Num());
+		for (const FString& UserId : UserIds)
+		{
+			FBaseUserInfo& UserInfo = Result.Data.AddDefaulted_GetRef();
+			UserInfo.UserId = UserId;
+			UserInfo.DisplayName = FString::Printf(TEXT("FakeUser_%s"), *UserId.Left(8));
+		}
+	}
+
+	QueueResponse(EAccelByteFakeBackendOperation::BulkGetUserInfo, [OnSuccess, Result = MoveTemp(Result)]() {
+		OnSuccess.ExecuteIfBound(Result);
+	}, OnError, UserIds);
+}
+
+void FOnlineFakeBackendAccelByte::BulkGetUserByOtherPlatformUserIds(const AccelByte::FApiClientPtr& ApiClient, EAccelBytePlatformType PlatformType, const TArray<FString>& PlatformUserIds, const THandler<FBulkPlatformUserIdResponse>& OnSuccess, const FErrorHandler& OnError)
+{
+	FBulkPlatformUserIdResponse Result;
+	if (!GetRecordedResponse(EAccelByteFakeBackendOperation::BulkGetUserByOtherPlatformUserIds, Result))
+	{
+		// Made up AccelByte IDs are derived from the platform ID, so that the same platform user always maps to the same user
+		Result.UserIdPlatforms.Reserve(PlatformUserIds.Num());
+		for (const FString& PlatformUserId : PlatformUserIds)
+		{
+			FPlatformUserIdMap& Mapping = Result.UserIdPlatforms.AddDefaulted_GetRef();
+			Mapping.PlatformUserId = PlatformUserId;
+			Mapping.UserId = FString::Printf(TEXT("fakeplatformuser%08x"), GetTypeHash(PlatformUserId));
+		}
+	}
+
+	QueueResponse(EAccelByteFakeBackendOperation::BulkGetUserByOtherPlatformUserIds, [OnSuccess, Result = MoveTemp(Result)]() {
+		OnSuccess.ExecuteIfBound(Result);
+	}, OnError, PlatformUserIds);
+}
+
+void FOnlineFakeBackendAccelByte::QueryGameSessions(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteModelsV2GameSessionQuery& Query, const THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult>& OnSuccess, const FErrorHandler& OnError, int32 Offset, int32 Limit)
+{
+	FAccelByteModelsV2PaginatedGameSessionQueryResult Result;
+	if (!GetRecordedResponse(EAccelByteFakeBackendOperation::QueryGameSessions, Result))
+	{
+		int32 NumSessions = 0;
+		{
+			FScopeLock ScopeLock(&Lock);
+			NumSessions = NumScriptedGameSessions;
+		}
+
+		const int32 StartIndex = FMath::Clamp(Offset, 0, NumSessions);
+		const int32 EndIndex = FMath::Clamp(StartIndex + FMath::Max(Limit, 0), StartIndex, NumSessions);
+		Result.Data.Reserve(EndIndex - StartIndex);
+		for (int32 Index = StartIndex; Index < EndIndex; Index++)
+		{
+			FAccelByteModelsV2GameSession& Session = Result.Data.AddDefaulted_GetRef();
+			Session.ID = FString::Printf(TEXT("fakegamesession%017d"), Index);
+			Session.CreatedBy = FString::Printf(TEXT("fakesessionowner%016d"), Index);
+			Session.MatchPool = TEXT("fake");
+			Session.Configuration.Joinability = EAccelByteV2SessionJoinability::OPEN;
+			Session.Configuration.MaxPlayers = ScriptedGameSessionMaxPlayers;
+		}
+
+		if (EndIndex < NumSessions)
+		{
+			Result.Paging.Next = FString::Printf(TEXT("?offset=%d&limit=%d"), EndIndex, Limit);
+		}
+	}
+
+	QueueResponse(EAccelByteFakeBackendOperation::QueryGameSessions, [OnSuccess, Result = MoveTemp(Result)]() {
+		OnSuccess.ExecuteIfBound(Result);
+	}, OnError);
+}
+
+void FOnlineFakeBackendAccelByte::WritePartyStorage(const AccelByte::FApiClientPtr& ApiClient, const FString& PartyId, TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PartyStorageWriter, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler& OnError)
+{
+	// Storage is only written once the response is due, so that failed writes leave it untouched, same as the backend
+	QueueResponse(EAccelByteFakeBackendOperation::WritePartyStorage, [this, PartyId, PartyStorageWriter = MoveTemp(PartyStorageWriter), OnSuccess]() {
+		FAccelByteModelsPartyDataNotif Result;
+		if (!GetRecordedResponse(EAccelByteFakeBackendOperation::WritePartyStorage, Result))
+		{
+			// Hand the writer a copy of the current storage, as the SDK does with the storage it fetches
+			FJsonObjectWrapper CurrentStorage;
+			{
+				FScopeLock ScopeLock(&Lock);
+				const FJsonObjectWrapper* ExistingStorage = PartyStorage.Find(PartyId);
+				CurrentStorage.JsonObject = (ExistingStorage != nullptr && ExistingStorage->JsonObject.IsValid()) ? MakeShared<FJsonObject>(*ExistingStorage->JsonObject) : MakeShared<FJsonObject>();
+			}
+
+			Result.Custom_attribute = PartyStorageWriter(CurrentStorage);
+
+			FScopeLock ScopeLock(&Lock);
+			PartyStorage.Add(PartyId, Result.Custom_attribute);
+		}
+
+		OnSuccess.ExecuteIfBound(Result);
+	}, OnError);
+}
+
+void FOnlineFakeBackendAccelByte::QueueResponse(EAccelByteFakeBackendOperation Operation, TFunction<void()>&& OnSuccess, const FErrorHandler& OnError, const TArray<FString>& RequestedIds)
+{
+	FScopeLock ScopeLock(&Lock);
+	const FAccelByteFakeBackendOperationSettings& OperationSettings = Settings[static_cast<int32>(Operation)];
+	NumRequests[static_cast<int32>(Operation)]++;
+
+	// Roll before checking failing IDs, so that scripting them does not shift the rolls of the requests that follow
+	bool bShouldFail = OperationSettings.ErrorRate > 0.0f && Random.GetFraction() < OperationSettings.ErrorRate;
+	if (!bShouldFail && OperationSettings.FailingIds.Num() > 0)
+	{
+		bShouldFail = RequestedIds.ContainsByPredicate([&OperationSettings](const FString& RequestedId) {
+			return OperationSettings.FailingIds.Contains(RequestedId);
+		});
+	}
+	const double Latency = Random.FRandRange(OperationSettings.MinLatencySeconds, OperationSettings.MaxLatencySeconds);
+
+	FPendingResponse Response;
+	Response.DueTime = FPlatformTime::Seconds() + Latency;
+	Response.Sequence = NextSequence++;
+	if (bShouldFail)
+	{
+		NumErrors[static_cast<int32>(Operation)]++;
+		Response.Deliver = [OnError, ErrorCode = OperationSettings.ErrorCode, Operation]() {
+			OnError.ExecuteIfBound(ErrorCode, FString::Printf(TEXT("Fake backend failed %s request"), LexToString(Operation)));
+		};
+	}
+	else
+	{
+		Response.Deliver = MoveTemp(OnSuccess);
+	}
+
+	PendingResponses.HeapPush(MoveTemp(Response), [](const FPendingResponse& Left, const FPendingResponse& Right) {
+		return PendingResponsePredicate(Left.DueTime, Left.Sequence, Right.DueTime, Right.Sequence);
+	});
+}
+
+template <typename TModel>
+bool FOnlineFakeBackendAccelByte::GetRecordedResponse(EAccelByteFakeBackendOperation Operation, TModel& OutModel) const
+{
+	// Copy the response out so that it is parsed outside of the lock, as responses can be large
+	FString RecordedResponse;
+	{
+		FScopeLock ScopeLock(&Lock);
+		RecordedResponse = Settings[static_cast<int32>(Operation)].RecordedResponse;
+	}
+
+	if (RecordedResponse.IsEmpty())
+	{
+		return false;
+	}
+
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(RecordedResponse, &OutModel, 0, 0))
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to parse recorded %s response for the fake backend, scripting a response instead!"), LexToString(Operation));
+		return false;
+	}
+
+	return true;
+}
+
+#endif
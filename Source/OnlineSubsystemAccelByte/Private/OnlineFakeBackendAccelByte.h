@@ -0,0 +1,213 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineBackendAccelByte.h"
+#include "Math/RandomStream.h"
+
+#ifndef AB_OSS_FAKE_BACKEND_ENABLED
+#define AB_OSS_FAKE_BACKEND_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+#if AB_OSS_FAKE_BACKEND_ENABLED
+
+class FOnlineSubsystemAccelByte;
+
+/**
+ * Operations that the fake backend can answer, each with its own response settings
+ */
+enum class EAccelByteFakeBackendOperation : uint8
+{
+	BulkGetUserInfo = 0,
+	QueryGameSessions,
+	WritePartyStorage,
+	BulkGetUserByOtherPlatformUserIds,
+	LobbyNotification, // Lobby notifications pushed through one of the Queue*Notification methods
+	Num
+};
+
+const TCHAR* LexToString(EAccelByteFakeBackendOperation Operation);
+
+/**
+ * How the fake backend answers requests for a single operation
+ */
+struct FAccelByteFakeBackendOperationSettings
+{
+	/** Shortest time between a request and its response, in seconds */
+	double MinLatencySeconds = 0.05;
+
+	/** Longest time between a request and its response, in seconds, latency is picked uniformly between the two */
+	double MaxLatencySeconds = 0.15;
+
+	/** Chance from zero to one that a request fails with ErrorCode rather than succeeding. Failed notifications are dropped. */
+	float ErrorRate = 0.0f;
+
+	/** Error code sent to the error handler of failed requests */
+	int32 ErrorCode = 500;
+
+	/** User or platform user IDs that fail any bulk user request asking for them, on top of ErrorRate, to script partial failures */
+	TSet<FString> FailingIds;
+
+	/**
+	 * Recorded response, as the JSON the backend sent, that every successful request is answered with. When empty, a
+	 * response is scripted from the request instead.
+	 */
+	FString RecordedResponse;
+};
+
+/**
+ * Backend answering requests with scripted or recorded responses after a configurable latency, and failing a share of
+ * them, so that async task flows can be run without any AccelByte services. Lobby notifications can be pushed into the
+ * session interface through the same latency and error settings.
+ *
+ * Responses are delivered from Tick on the game thread, same as SDK responses. Scripted responses are built from the
+ * request: users are made up for each user ID or platform user ID asked for, game session queries page through a fixed number of made up
+ * sessions, and party storage is kept in memory so that writes build on each other.
+ *
+ * Used by the subsystem in place of the live backend when `bUseFakeBackend` is set in the `OnlineSubsystemAccelByte`
+ * settings, with recorded responses loaded from the file set in `FakeBackendRecordingPath`, or swapped in directly by the
+ * fake backend benchmark. Compiled out of shipping builds, or by setting AB_OSS_FAKE_BACKEND_ENABLED to 0.
+ */
+class FOnlineFakeBackendAccelByte : public IOnlineBackendAccelByte
+{
+public:
+	/**
+	 * Create a fake backend with default settings for every operation
+	 *
+	 * @param InSubsystem Subsystem that lobby notifications are pushed into
+	 * @param InRandomSeed Seed for latency and error rolls, so that runs can be repeated
+	 */
+	explicit FOnlineFakeBackendAccelByte(FOnlineSubsystemAccelByte* InSubsystem, int32 InRandomSeed = 0);
+
+	/**
+	 * Get a copy of the settings used to answer an operation
+	 */
+	FAccelByteFakeBackendOperationSettings GetSettings(EAccelByteFakeBackendOperation Operation) const;
+
+	/**
+	 * Set the settings used to answer an operation, applying to requests made from now on
+	 */
+	void SetSettings(EAccelByteFakeBackendOperation Operation, const FAccelByteFakeBackendOperationSettings& InSettings);
+
+	/**
+	 * Set the latency range and error rate for every operation at once
+	 */
+	void SetAllSettings(double MinLatencySeconds, double MaxLatencySeconds, float ErrorRate);
+
+	/**
+	 * Set the number of made up game sessions that scripted game session queries page through
+	 */
+	void SetNumScriptedGameSessions(int32 InNumScriptedGameSessions);
+
+	/**
+	 * Load settings and recorded responses from a JSON file, keyed by operation name, such as:
+	 *
+	 * { "QueryGameSessions": { "MinLatencyMs": 40, "MaxLatencyMs": 120, "ErrorRate": 0.01, "ErrorCode": 500, "Response": { ... } } }
+	 *
+	 * Every field is optional, operations left out of the file keep their current settings.
+	 *
+	 * @return whether the file could be read and parsed
+	 */
+	bool LoadRecording(const FString& FilePath);
+
+	/**
+	 * Number of requests and notifications that have yet to be answered or delivered
+	 */
+	int32 GetNumPendingResponses() const;
+
+	/**
+	 * Number of requests made for an operation, and how many of them were failed, since creation
+	 */
+	void GetOperationCounts(EAccelByteFakeBackendOperation Operation, int32& OutNumRequests, int32& OutNumErrors) const;
+
+	/**
+	 * Push a game session members changed notification for a local user into the session interface
+	 */
+	void QueueGameSessionMembersChangedNotification(int32 LocalUserNum, const FAccelByteModelsV2GameSessionMembersChangedEvent& Notification);
+
+	/**
+	 * Push a game session updated notification for a local user into the session interface
+	 */
+	void QueueGameSessionUpdatedNotification(int32 LocalUserNum, const FAccelByteModelsV2GameSession& Notification);
+
+	/**
+	 * Push a party session members changed notification for a local user into the session interface
+	 */
+	void QueuePartySessionMembersChangedNotification(int32 LocalUserNum, const FAccelByteModelsV2PartyMembersChangedEvent& Notification);
+
+	//~ Begin IOnlineBackendAccelByte Interface
+	virtual bool IsLiveBackend() const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool HasPendingResponses() const override;
+	virtual void BulkGetUserInfo(const AccelByte::FApiClientPtr& ApiClient, const TArray<FString>& UserIds, const THandler<FListBulkUserInfo>& OnSuccess, const FErrorHandler& OnError) override;
+	virtual void BulkGetUserByOtherPlatformUserIds(const AccelByte::FApiClientPtr& ApiClient, EAccelBytePlatformType PlatformType, const TArray<FString>& PlatformUserIds, const THandler<FBulkPlatformUserIdResponse>& OnSuccess, const FErrorHandler& OnError) override;
+	virtual void QueryGameSessions(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteModelsV2GameSessionQuery& Query, const THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult>& OnSuccess, const FErrorHandler& OnError, int32 Offset, int32 Limit) override;
+	virtual void WritePartyStorage(const AccelByte::FApiClientPtr& ApiClient, const FString& PartyId, TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PartyStorageWriter, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler& OnError) override;
+	//~ End IOnlineBackendAccelByte Interface
+
+private:
+	/** Response waiting for its latency to pass */
+	struct FPendingResponse
+	{
+		/** Time to deliver the response at, in FPlatformTime::Seconds */
+		double DueTime = 0.0;
+
+		/** Order the response was queued in, so that responses due at the same time go out in order */
+		uint64 Sequence = 0;
+
+		/** Delivers the response, already bound to either the success or error handler */
+		TFunction<void()> Deliver;
+	};
+
+	/** Subsystem that lobby notifications are pushed into */
+	FOnlineSubsystemAccelByte* Subsystem;
+
+	/** Lock guarding everything below, as requests come in from the online thread */
+	mutable FCriticalSection Lock;
+
+	/** Settings for each operation */
+	FAccelByteFakeBackendOperationSettings Settings[static_cast<int32>(EAccelByteFakeBackendOperation::Num)];
+
+	/** Number of requests made for each operation */
+	int32 NumRequests[static_cast<int32>(EAccelByteFakeBackendOperation::Num)] = {};
+
+	/** Number of requests failed for each operation */
+	int32 NumErrors[static_cast<int32>(EAccelByteFakeBackendOperation::Num)] = {};
+
+	/** Number of made up game sessions that scripted game session queries page through */
+	int32 NumScriptedGameSessions = 100;
+
+	/** Stream for latency and error rolls */
+	FRandomStream Random;
+
+	/** Responses waiting to be delivered, as a heap ordered by due time */
+	TArray<FPendingResponse> PendingResponses;
+
+	/** Sequence given to the next response queued */
+	uint64 NextSequence = 0;
+
+	/** Storage of each party written to, keyed by party ID */
+	TMap<FString, FJsonObjectWrapper> PartyStorage;
+
+	/**
+	 * Roll whether a request for an operation fails, count it, and queue the response to be delivered after a rolled latency
+	 *
+	 * @param Operation Operation that the request is for
+	 * @param OnSuccess Delivers a successful response, called on the game thread
+	 * @param OnError Error handler of the request, or unbound for notifications, which are dropped on failure
+	 * @param RequestedIds IDs that the request asks for, which fail it if any of them are in the operation's FailingIds
+	 */
+	void QueueResponse(EAccelByteFakeBackendOperation Operation, TFunction<void()>&& OnSuccess, const FErrorHandler& OnError, const TArray<FString>& RequestedIds = TArray<FString>());
+
+	/**
+	 * Parse the recorded response for an operation into the model given, returning false if there is none or it is invalid
+	 */
+	template <typename TModel>
+	bool GetRecordedResponse(EAccelByteFakeBackendOperation Operation, TModel& OutModel) const;
+
+};
+
+#endif
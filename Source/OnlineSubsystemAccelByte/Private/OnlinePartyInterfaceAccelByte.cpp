@@ -4,6 +4,8 @@
 
 #include "OnlinePartyInterfaceAccelByte.h"
 #include "OnlineSubsystemAccelByte.h"
+#include "OnlineUserIdRegistryAccelByte.h"
+#include "OnlineSubsystemAccelByteTrace.h"
 #include "OnlineError.h"
 #include "Api/AccelByteLobbyApi.h"
 #include "OnlineIdentityInterfaceAccelByte.h"
@@ -705,6 +707,8 @@ TSharedPtr<const FOnlinePartyId> FOnlinePartySystemAccelByte::GetFirstPartyIdFor
 
 void FOnlinePartySystemAccelByte::OnReceivedPartyInviteNotification(const FAccelByteModelsPartyGetInvitedNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; PartyId: %s; Inviter: %s"), *UserId->ToDebugString(), *Notification.PartyId, *Notification.From);
 
 	AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteGetV1PartyInviteInfo>(AccelByteSubsystem, UserId, Notification);
@@ -716,6 +720,8 @@ void FOnlinePartySystemAccelByte::OnReceivedPartyInviteNotification(const FAccel
 
 void FOnlinePartySystemAccelByte::OnPartyInviteSentNotification(const FAccelByteModelsInvitationNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; InviterId: %s; InviteeId: %s"), *UserId->ToDebugString(), *Notification.InviterID, *Notification.InviteeID);
 
 	UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("Invite to party sent by user '%s' to user '%s'!"), *Notification.InviterID, *Notification.InviteeID);
@@ -733,8 +739,8 @@ void FOnlinePartySystemAccelByte::OnPartyInviteSentNotification(const FAccelByte
 		FAccelByteUniqueIdComposite InviteeCompositeId;
 		InviteeCompositeId.Id = Notification.InviteeID;
 
-		Party->AddUserToInvitedPlayers(UserId, FUniqueNetIdAccelByteUser::Create(InviterCompositeId)
-			, FUniqueNetIdAccelByteUser::Create(InviteeCompositeId));
+		Party->AddUserToInvitedPlayers(UserId, AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(InviterCompositeId)
+			, AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(InviteeCompositeId));
 	}
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT("Added invited user to invited players."));
@@ -742,6 +748,8 @@ void FOnlinePartySystemAccelByte::OnPartyInviteSentNotification(const FAccelByte
 
 void FOnlinePartySystemAccelByte::OnPartyJoinNotification(const FAccelByteModelsPartyJoinNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; JoinedUser: %s"), *UserId->ToDebugString(), *Notification.UserId);
 
 	UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("User '%s' has joined the party!"), *Notification.UserId);
@@ -787,6 +795,8 @@ void FOnlinePartySystemAccelByte::OnPartyJoinNotification(const FAccelByteModels
 
 void FOnlinePartySystemAccelByte::OnPartyMemberLeaveNotification(const FAccelByteModelsLeavePartyNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; LeavingUser: %s"), *UserId->ToDebugString(), *Notification.UserID);
 
 	UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("User '%s' has left the party!"), *Notification.UserID);
@@ -804,7 +814,7 @@ void FOnlinePartySystemAccelByte::OnPartyMemberLeaveNotification(const FAccelByt
 			FAccelByteUniqueIdComposite LeftUserCompositeId;
 			LeftUserCompositeId.Id = Notification.UserID;
 
-			TSharedRef<const FUniqueNetIdAccelByteUser> LeftUserId = FUniqueNetIdAccelByteUser::Create(LeftUserCompositeId);
+			TSharedRef<const FUniqueNetIdAccelByteUser> LeftUserId = AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(LeftUserCompositeId);
 			Party->RemoveMember(UserId, LeftUserId, EMemberExitedReason::Left);
 			RemovePartyFromInterface(LeftUserId, Party.ToSharedRef());
 		}
@@ -822,6 +832,8 @@ void FOnlinePartySystemAccelByte::OnPartyMemberLeaveNotification(const FAccelByt
 
 void FOnlinePartySystemAccelByte::OnPartyKickNotification(const FAccelByteModelsGotKickedFromPartyNotice& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; PartyId: %s; KickedUser: %s"), *UserId->ToDebugString(), *Notification.PartyId, *Notification.UserId);
 
 	UE_LOG(LogAccelByteOSSParty, Verbose, TEXT("User '%s' has been kicked from party '%s'!"), *Notification.UserId, *Notification.PartyId);
@@ -845,7 +857,7 @@ void FOnlinePartySystemAccelByte::OnPartyKickNotification(const FAccelByteModels
 		{
 			FAccelByteUniqueIdComposite KickedUserCompositeId;
 			KickedUserCompositeId.Id = Notification.UserId;
-			Party->RemoveMember(UserId, FUniqueNetIdAccelByteUser::Create(KickedUserCompositeId), EMemberExitedReason::Kicked);
+			Party->RemoveMember(UserId, AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(KickedUserCompositeId), EMemberExitedReason::Kicked);
 		}
 
 		AB_OSS_INTERFACE_TRACE_END(TEXT("Removing remote user from party as they have been kicked."));
@@ -854,6 +866,8 @@ void FOnlinePartySystemAccelByte::OnPartyKickNotification(const FAccelByteModels
 
 void FOnlinePartySystemAccelByte::OnPartyDataChangeNotification(const FAccelByteModelsPartyDataNotif& Notification, TSharedRef<const FUniqueNetIdAccelByteUser> UserId)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("UserId: %s; PartyId: %s"), *UserId->ToDebugString(), *Notification.PartyId);
 
 	FString NotificationString;
@@ -878,7 +892,7 @@ void FOnlinePartySystemAccelByte::OnPartyDataChangeNotification(const FAccelByte
 		FAccelByteUniqueIdComposite LeaderCompositeId;
 		LeaderCompositeId.Id = Notification.Leader;
 
-		TSharedPtr<const FUniqueNetIdAccelByteUser> ABUserId = FUniqueNetIdAccelByteUser::Create(LeaderCompositeId);
+		TSharedPtr<const FUniqueNetIdAccelByteUser> ABUserId = AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(LeaderCompositeId);
 		TSharedPtr<const FOnlinePartyMemberAccelByte> LeaderMember = Party->GetMember(ABUserId.ToSharedRef());
 		if (LeaderMember.IsValid())
 		{
@@ -987,7 +1001,7 @@ void FOnlinePartySystemAccelByte::OnPartyJoinedCompleteMemberLeaveParty(const FU
 			FAccelByteUniqueIdComposite LeftUserCompositeId;
 			LeftUserCompositeId.Id = Notification.UserID;
 
-			TSharedRef<const FUniqueNetIdAccelByteUser> LeftUserId = FUniqueNetIdAccelByteUser::Create(LeftUserCompositeId);
+			TSharedRef<const FUniqueNetIdAccelByteUser> LeftUserId = AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(LeftUserCompositeId);
 			Party->RemoveMember(UserId, LeftUserId, EMemberExitedReason::Left);
 			RemovePartyFromInterface(LeftUserId, Party.ToSharedRef());
 		}
@@ -3,8 +3,10 @@
 // and restrictions contact your company contract manager.
 
 #include "OnlineSessionInterfaceV2AccelByte.h"
+#include "OnlineSessionSearchCacheAccelByte.h"
 #include "OnlineSubsystemAccelByteSessionSettings.h"
 #include "OnlineSubsystemAccelByteInternalHelpers.h"
+#include "OnlineSubsystemAccelByteTrace.h"
 #include "Interfaces/OnlineIdentityInterface.h"
 #include "AsyncTasks/SessionV2/OnlineAsyncTaskAccelByteCreateGameSessionV2.h"
 #include "AsyncTasks/SessionV2/OnlineAsyncTaskAccelByteUpdateGameSessionV2.h"
@@ -44,12 +46,51 @@
 #include "AccelByteNetworkUtilities.h"
 #include "OnlineSessionSettingsAccelByte.h"
 #include "OnlineSubsystemUtils.h"
+#include "OnlineUserIdRegistryAccelByte.h"
 
 #define ONLINE_ERROR_NAMESPACE "FOnlineSessionV2AccelByte"
 #define ACCELBYTE_P2P_TRAVEL_URL_FORMAT TEXT("accelbyte.%s:11223")
 
-FOnlineSessionInfoAccelByteV2::FOnlineSessionInfoAccelByteV2(const FString& SessionIdStr)
+namespace
+{
+	bool IsJoinedMemberStatus(EAccelByteV2SessionMemberStatus Status)
+	{
+		return Status == EAccelByteV2SessionMemberStatus::JOINED || Status == EAccelByteV2SessionMemberStatus::CONNECTED;
+	}
+
+	/**
+	 * Sort a member whose status changed into the matching array of a change set
+	 */
+	void AddMemberChange(const FAccelByteModelsV2SessionUser& Member, const FAccelByteModelsV2SessionUser* PreviousMember, FAccelByteSessionMembersChangeSet& OutChangeSet)
+	{
+		FAccelByteSessionMemberChange Change;
+		Change.Member = Member;
+		Change.bIsNewMember = PreviousMember == nullptr;
+		if (PreviousMember != nullptr)
+		{
+			Change.PreviousStatus = PreviousMember->Status;
+		}
+
+		const bool bWasJoined = PreviousMember != nullptr && IsJoinedMemberStatus(PreviousMember->Status);
+		const bool bIsJoined = IsJoinedMemberStatus(Member.Status);
+		if (!bWasJoined && bIsJoined)
+		{
+			OutChangeSet.Joined.Emplace(MoveTemp(Change));
+		}
+		else if (bWasJoined && !bIsJoined)
+		{
+			OutChangeSet.Left.Emplace(MoveTemp(Change));
+		}
+		else
+		{
+			OutChangeSet.StatusChanged.Emplace(MoveTemp(Change));
+		}
+	}
+}
+
+FOnlineSessionInfoAccelByteV2::FOnlineSessionInfoAccelByteV2(const FString& SessionIdStr, const FOnlineUserIdRegistryAccelBytePtr& InUserIdRegistry)
 	: SessionId(FUniqueNetIdAccelByteResource::Create(SessionIdStr))
+	, UserIdRegistry(InUserIdRegistry)
 {
 }
 
@@ -206,9 +247,10 @@ void FOnlineSessionInfoAccelByteV2::UpdatePlayerLists()
 		return;
 	}
 
-	// Clear both the invited player and joined player arrays, will be refilled as we iterate through the new backend member array
-	InvitedPlayers.Empty();
-	JoinedMembers.Empty();
+	// Clear both the invited player and joined player arrays, will be refilled as we iterate through the new backend member
+	// array. Keep the allocations around, as the member count rarely changes much between updates.
+	InvitedPlayers.Reset();
+	JoinedMembers.Reset();
 
 	for (const FAccelByteModelsV2SessionUser& Member : BackendSessionData->Members)
 	{
@@ -227,14 +269,9 @@ void FOnlineSessionInfoAccelByteV2::UpdatePlayerLists()
 			continue;
 		}
 
-		FAccelByteUniqueIdComposite CompositeId;
-		CompositeId.Id = Member.ID;
-		CompositeId.PlatformType = Member.PlatformID;
-		CompositeId.PlatformId = Member.PlatformUserID;
-
-		// #TODO Since we clear the previous array and are allocating new IDs here, debating on whether it makes sense to make a
-		// user ID cache to cut down on the amount of times that we create new ID instances and instead reuse existing IDs.
-		TSharedPtr<const FUniqueNetIdAccelByteUser> MemberId = FUniqueNetIdAccelByteUser::Create(CompositeId);
+		// Member IDs are interned through the user ID registry, so on most updates this just hands back the IDs that were
+		// already in these arrays rather than creating new instances
+		TSharedPtr<const FUniqueNetIdAccelByteUser> MemberId = GetMemberId(Member);
 		if (ensure(MemberId.IsValid()) && bIsInviteStatus)
 		{
 			InvitedPlayers.Emplace(MemberId.ToSharedRef());
@@ -259,16 +296,121 @@ void FOnlineSessionInfoAccelByteV2::UpdateLeaderId()
 
 	if (FoundLeaderMember != nullptr)
 	{
-		FAccelByteUniqueIdComposite CompositeId;
-		CompositeId.Id = FoundLeaderMember->ID;
-		CompositeId.PlatformType = FoundLeaderMember->PlatformID;
-		CompositeId.PlatformId = FoundLeaderMember->PlatformUserID;
-
-		LeaderId = FUniqueNetIdAccelByteUser::Create(CompositeId);
+		LeaderId = GetMemberId(*FoundLeaderMember);
 		ensure(LeaderId.IsValid());
 	}
 }
 
+void FOnlineSessionInfoAccelByteV2::UpdateMembers(const TArray<FAccelByteModelsV2SessionUser>& NewMembers, FAccelByteSessionMembersChangeSet& OutChangeSet)
+{
+	OutChangeSet = FAccelByteSessionMembersChangeSet();
+	if (!BackendSessionData.IsValid())
+	{
+		return;
+	}
+
+	const TArray<FAccelByteModelsV2SessionUser>& PreviousMembers = BackendSessionData->Members;
+
+	// Index the previous members by ID, so that each new member is matched in constant time rather than by searching the
+	// whole previous list, which adds up quickly for large game sessions with a lot of status churn
+	TMap<FString, int32> PreviousMemberIndices;
+	PreviousMemberIndices.Reserve(PreviousMembers.Num());
+	for (int32 Index = 0; Index < PreviousMembers.Num(); Index++)
+	{
+		PreviousMemberIndices.Add(PreviousMembers[Index].ID, Index);
+	}
+
+	TBitArray<> MatchedPreviousMembers(false, PreviousMembers.Num());
+	for (const FAccelByteModelsV2SessionUser& NewMember : NewMembers)
+	{
+		const int32* PreviousMemberIndex = PreviousMemberIndices.Find(NewMember.ID);
+		if (PreviousMemberIndex == nullptr)
+		{
+			AddMemberChange(NewMember, nullptr, OutChangeSet);
+			continue;
+		}
+
+		MatchedPreviousMembers[*PreviousMemberIndex] = true;
+		const FAccelByteModelsV2SessionUser& PreviousMember = PreviousMembers[*PreviousMemberIndex];
+		if (PreviousMember.Status != NewMember.Status)
+		{
+			AddMemberChange(NewMember, &PreviousMember, OutChangeSet);
+		}
+	}
+
+	// Members missing from the new list have been dropped from the session by the backend, treat them as having left
+	for (int32 Index = 0; Index < PreviousMembers.Num(); Index++)
+	{
+		const FAccelByteModelsV2SessionUser& PreviousMember = PreviousMembers[Index];
+		if (MatchedPreviousMembers[Index] || PreviousMember.Status == EAccelByteV2SessionMemberStatus::LEFT)
+		{
+			continue;
+		}
+
+		FAccelByteModelsV2SessionUser RemovedMember = PreviousMember;
+		RemovedMember.Status = EAccelByteV2SessionMemberStatus::LEFT;
+		AddMemberChange(RemovedMember, &PreviousMember, OutChangeSet);
+	}
+
+	BackendSessionData->Members = NewMembers;
+
+	// Patch the joined and invited player lists with only the members that changed
+	bool bLeaderChanged = !LeaderId.IsValid();
+	const auto PatchPlayerLists = [this, &bLeaderChanged](const TArray<FAccelByteSessionMemberChange>& Changes) {
+		for (const FAccelByteSessionMemberChange& Change : Changes)
+		{
+			const FAccelByteModelsV2SessionUser& Member = Change.Member;
+			if (!ensure(!Member.ID.IsEmpty()))
+			{
+				continue;
+			}
+
+			const auto IsMemberId = [&Member](const FUniqueNetIdRef& Id) {
+				return StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(Id)->GetAccelByteId() == Member.ID;
+			};
+
+			if (!Change.bIsNewMember && Change.PreviousStatus == EAccelByteV2SessionMemberStatus::INVITED)
+			{
+				InvitedPlayers.RemoveAll(IsMemberId);
+			}
+			else if (!Change.bIsNewMember && IsJoinedMemberStatus(Change.PreviousStatus))
+			{
+				JoinedMembers.RemoveAll(IsMemberId);
+			}
+
+			if (Member.Status == EAccelByteV2SessionMemberStatus::INVITED)
+			{
+				InvitedPlayers.Emplace(GetMemberId(Member));
+			}
+			else if (IsJoinedMemberStatus(Member.Status))
+			{
+				JoinedMembers.Emplace(GetMemberId(Member));
+			}
+
+			bLeaderChanged |= Member.ID.Equals(BackendSessionData->LeaderID);
+		}
+	};
+	PatchPlayerLists(OutChangeSet.Joined);
+	PatchPlayerLists(OutChangeSet.Left);
+	PatchPlayerLists(OutChangeSet.StatusChanged);
+
+	if (bLeaderChanged)
+	{
+		UpdateLeaderId();
+	}
+}
+
+FUniqueNetIdAccelByteUserRef FOnlineSessionInfoAccelByteV2::GetMemberId(const FAccelByteModelsV2SessionUser& Member) const
+{
+	const FOnlineUserIdRegistryAccelBytePtr PinnedUserIdRegistry = UserIdRegistry.Pin();
+	if (PinnedUserIdRegistry.IsValid())
+	{
+		return PinnedUserIdRegistry->FindOrCreate(Member.ID, Member.PlatformID, Member.PlatformUserID);
+	}
+
+	return FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(Member.ID, Member.PlatformID, Member.PlatformUserID));
+}
+
 void FOnlineSessionInfoAccelByteV2::UpdateConnectionInfo()
 {
 	if (!BackendSessionData.IsValid())
@@ -341,6 +483,20 @@ const FString FOnlineSessionV2AccelByte::ServerSessionIdEnvironmentVariable = TE
 FOnlineSessionV2AccelByte::FOnlineSessionV2AccelByte(FOnlineSubsystemAccelByte* InSubsystem)
 	: AccelByteSubsystem(InSubsystem)
 {
+	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bSendSessionAttributeDeltas"), bSendSessionAttributeDeltas, GEngineIni);
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("SessionUpdateCoalesceWindowSeconds"), SessionUpdateCoalesceWindowSeconds, GEngineIni);
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("SessionUpdateMaxConflictRetries"), MaxSessionUpdateConflictRetries, GEngineIni);
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("SessionVersionConflictErrorCode"), SessionVersionConflictErrorCode, GEngineIni);
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("FindSessionsMaxConcurrentPages"), FindSessionsMaxConcurrentPages, GEngineIni);
+	SessionUpdateCoalesceWindowSeconds = FMath::Max(SessionUpdateCoalesceWindowSeconds, 0.0);
+	MaxSessionUpdateConflictRetries = FMath::Max(MaxSessionUpdateConflictRetries, 0);
+	FindSessionsMaxConcurrentPages = FMath::Max(FindSessionsMaxConcurrentPages, 1);
+
+	int32 SessionSearchCacheMaxEntries = 256;
+	double SessionSearchCacheTimeToLiveSeconds = 0.0;
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("SessionSearchCacheMaxEntries"), SessionSearchCacheMaxEntries, GEngineIni);
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("SessionSearchCacheTimeToLiveSeconds"), SessionSearchCacheTimeToLiveSeconds, GEngineIni);
+	SessionSearchCache = MakeShared<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe>(SessionSearchCacheMaxEntries, SessionSearchCacheTimeToLiveSeconds);
 }
 
 bool FOnlineSessionV2AccelByte::GetFromSubsystem(const IOnlineSubsystem* Subsystem, FOnlineSessionV2AccelBytePtr& OutInterfaceInstance)
@@ -382,7 +538,28 @@ void FOnlineSessionV2AccelByte::Init()
 
 void FOnlineSessionV2AccelByte::Tick(float DeltaTime)
 {
-	// #NOTE (Voltaire) Method was added to satisfy session interface pairity in FOnlineSubsystemAccelByte::Tick
+	FlushFindSessionsResultsReceived();
+
+	// Send any session updates that were held back to be coalesced, once their window has passed
+	if (QueuedSessionUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (auto QueuedUpdateIt = QueuedSessionUpdates.CreateIterator(); QueuedUpdateIt; ++QueuedUpdateIt)
+	{
+		FQueuedSessionUpdate& QueuedUpdate = QueuedUpdateIt.Value();
+		if (!QueuedUpdate.bIsRequestInFlight && QueuedUpdate.PendingSettings.IsValid() && CurrentTime >= QueuedUpdate.DispatchTime)
+		{
+			DispatchSessionUpdate(QueuedUpdateIt.Key(), QueuedUpdate);
+		}
+
+		if (!QueuedUpdate.bIsRequestInFlight && !QueuedUpdate.PendingSettings.IsValid())
+		{
+			QueuedUpdateIt.RemoveCurrent();
+		}
+	}
 }
 
 void FOnlineSessionV2AccelByte::RegisterSessionNotificationDelegates(const FUniqueNetId& PlayerId)
@@ -760,7 +937,7 @@ void FOnlineSessionV2AccelByte::FinalizeCreateGameSession(const FName& SessionNa
 	}
 
 	// Create new session info based off of the created session, start by filling session ID
-	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSessionInfo.ID);
+	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSessionInfo.ID, AccelByteSubsystem->GetUserIdRegistry());
 	SessionInfo->SetBackendSessionData(MakeShared<FAccelByteModelsV2GameSession>(BackendSessionInfo));
 	SessionInfo->SetTeamAssignments(BackendSessionInfo.Teams);
 	NewSession->SessionInfo = SessionInfo;
@@ -816,7 +993,7 @@ void FOnlineSessionV2AccelByte::FinalizeCreatePartySession(const FName& SessionN
 	}
 
 	// Create new session info based off of the created session, set by filling session ID
-	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSessionInfo.ID);
+	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSessionInfo.ID, AccelByteSubsystem->GetUserIdRegistry());
 	SessionInfo->SetBackendSessionData(MakeShared<FAccelByteModelsV2PartySession>(BackendSessionInfo));
 	Session->SessionInfo = SessionInfo;
 
@@ -860,17 +1037,14 @@ bool FOnlineSessionV2AccelByte::ConstructGameSessionFromBackendSessionModel(cons
 
 	if (!BackendSession.CreatedBy.IsEmpty())
 	{
-		FAccelByteUniqueIdComposite CompositeId;
-		CompositeId.Id = BackendSession.CreatedBy;
-
-		TSharedPtr<const FUniqueNetIdAccelByteUser> OwnerId = FUniqueNetIdAccelByteUser::Create(CompositeId);
+		TSharedPtr<const FUniqueNetIdAccelByteUser> OwnerId = AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(BackendSession.CreatedBy);
 		if (ensure(OwnerId.IsValid()))
 		{
 			OutResult.OwningUserId = OwnerId;
 		}
 	}
 
-	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSession.ID);
+	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSession.ID, AccelByteSubsystem->GetUserIdRegistry());
 	SessionInfo->SetTeamAssignments(BackendSession.Teams);
 	SessionInfo->SetBackendSessionData(MakeShared<FAccelByteModelsV2GameSession>(BackendSession));
 
@@ -921,17 +1095,14 @@ bool FOnlineSessionV2AccelByte::ConstructPartySessionFromBackendSessionModel(con
 
 	if (!BackendSession.CreatedBy.IsEmpty())
 	{
-		FAccelByteUniqueIdComposite CompositeId;
-		CompositeId.Id = BackendSession.CreatedBy;
-
-		TSharedPtr<const FUniqueNetIdAccelByteUser> OwnerId = FUniqueNetIdAccelByteUser::Create(CompositeId);
+		TSharedPtr<const FUniqueNetIdAccelByteUser> OwnerId = AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(BackendSession.CreatedBy);
 		if (ensure(OwnerId.IsValid()))
 		{
 			OutResult.OwningUserId = OwnerId;
 		}
 	}
 
-	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSession.ID);
+	TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfo = MakeShared<FOnlineSessionInfoAccelByteV2>(BackendSession.ID, AccelByteSubsystem->GetUserIdRegistry());
 	SessionInfo->SetBackendSessionData(MakeShared<FAccelByteModelsV2PartySession>(BackendSession));
 	
 	// Party sessions are always invite only, thus just update the private connection num
@@ -1193,7 +1364,10 @@ TArray<TSharedPtr<FJsonValue>> FOnlineSessionV2AccelByte::ConvertSessionSettingA
 
 TSharedRef<FJsonObject> FOnlineSessionV2AccelByte::ConvertSessionSettingsToJsonObject(const FOnlineSessionSettings& Settings) const
 {
+	const FOnlineSessionAttributeSchemaAccelBytePtr Schema = GetSessionAttributeSchema();
+
 	TSharedRef<FJsonObject> OutObject = MakeShared<FJsonObject>();
+	OutObject->Values.Reserve(Settings.Settings.Num());
 	for (const TPair<FName, FOnlineSessionSetting>& Setting : Settings.Settings)
 	{
 		if (ShouldSkipAddingFieldToSessionAttributes(Setting.Key))
@@ -1201,21 +1375,37 @@ TSharedRef<FJsonObject> FOnlineSessionV2AccelByte::ConvertSessionSettingsToJsonO
 			continue;
 		}
 
+		// Settings that are in the schema are written under their precomputed field name, falling back to working out
+		// the field below only if the setting does not hold the type that was registered for it
+		if (Schema.IsValid())
+		{
+			const FOnlineSessionAttributeSchemaAccelByte::FCompiledField* Field = Schema->FindBySettingName(Setting.Key);
+			if (Field != nullptr)
+			{
+				if (FOnlineSessionAttributeSchemaAccelByte::WriteAttribute(*Field, Setting.Value.Data, OutObject))
+				{
+					continue;
+				}
+
+				UE_LOG_AB(Warning, TEXT("Session setting '%s' does not match the type registered for it in the session attribute schema, writing it as its own type!"), *Setting.Key.ToString());
+			}
+		}
+
 		// If the setting value is a blob, we assume that it represents a serialized array of strings or doubles
 		if(Setting.Value.Data.GetType() == EOnlineKeyValuePairDataType::Blob)
 		{
-			const auto ArrayType = FOnlineSessionSettingsAccelByte::GetArrayFieldType(Settings, Setting.Key);
+			const auto ArrayType = FOnlineSearchSettingsAccelByte::GetArrayFieldType(Setting.Value.Data);
 
 			if(ArrayType == ESessionSettingsAccelByteArrayFieldType::STRINGS)
 			{
 				TArray<FString> Array;
-				FOnlineSessionSettingsAccelByte::Get(Settings, Setting.Key, Array);
+				FOnlineSearchSettingsAccelByte::Get(Setting.Value.Data, Array);
 				OutObject->SetArrayField(Setting.Key.ToString().ToUpper(), ConvertSessionSettingArrayToJson(Array));
 			}
 			else if(ArrayType == ESessionSettingsAccelByteArrayFieldType::DOUBLES)
 			{
 				TArray<double> Array;
-				FOnlineSessionSettingsAccelByte::Get(Settings, Setting.Key, Array);
+				FOnlineSearchSettingsAccelByte::Get(Setting.Value.Data, Array);
 				OutObject->SetArrayField(Setting.Key.ToString().ToUpper(), ConvertSessionSettingArrayToJson(Array));
 			}
 
@@ -1232,21 +1422,42 @@ TSharedRef<FJsonObject> FOnlineSessionV2AccelByte::ConvertSessionSettingsToJsonO
 
 FOnlineSessionSettings FOnlineSessionV2AccelByte::ReadSessionSettingsFromJsonObject(const TSharedRef<FJsonObject>& Object) const
 {
+	const FOnlineSessionAttributeSchemaAccelBytePtr Schema = GetSessionAttributeSchema();
+
 	FOnlineSessionSettings OutSettings{};
+	OutSettings.Settings.Reserve(Object->Values.Num());
 	for (const TPair<FString, TSharedPtr<FJsonValue>>& Attribute : Object->Values)
 	{
-		if (!Attribute.Value.IsValid())
+		const TSharedPtr<FJsonValue>& Value = Attribute.Value;
+		if (!Value.IsValid())
 		{
 			continue;
 		}
 
-		// Check JSON field type to determine type on read
-		switch (Attribute.Value.ToSharedRef().Get().Type)
+		// Attributes that are in the schema are read as the type registered for them, under their interned setting name,
+		// falling back to reading them by JSON type below only if the value does not match that type
+		if (Schema.IsValid())
+		{
+			const FOnlineSessionAttributeSchemaAccelByte::FCompiledField* Field = Schema->FindByFieldName(Attribute.Key);
+			if (Field != nullptr)
+			{
+				if (FOnlineSessionAttributeSchemaAccelByte::ReadAttribute(*Field, Value, OutSettings))
+				{
+					continue;
+				}
+
+				UE_LOG_AB(Warning, TEXT("Session attribute '%s' does not match the type registered for it in the session attribute schema, reading it by its JSON type!"), *Attribute.Key);
+			}
+		}
+
+		// Check JSON field type to determine type on read. Values are read straight from the attribute we already hold,
+		// rather than looking the field up in the object again.
+		switch (Value->Type)
 		{
 			case EJson::String:
 			{
 				FString StringValue;
-				if (!Object->TryGetStringField(Attribute.Key, StringValue))
+				if (!Value->TryGetString(StringValue))
 				{
 					UE_LOG_AB(Warning, TEXT("Failed to read session attribute '%s' as a string, skipping!"), *Attribute.Key);
 					continue;
@@ -1259,7 +1470,7 @@ FOnlineSessionSettings FOnlineSessionV2AccelByte::ReadSessionSettingsFromJsonObj
 			case EJson::Boolean:
 			{
 				bool BoolValue;
-				if (!Object->TryGetBoolField(Attribute.Key, BoolValue))
+				if (!Value->TryGetBool(BoolValue))
 				{
 					UE_LOG_AB(Warning, TEXT("Failed to read session attribute '%s' as a bool, skipping!"), *Attribute.Key);
 					continue;
@@ -1272,7 +1483,7 @@ FOnlineSessionSettings FOnlineSessionV2AccelByte::ReadSessionSettingsFromJsonObj
 			case EJson::Number: 
 			{
 				double NumberValue;
-				if (!Object->TryGetNumberField(Attribute.Key, NumberValue))
+				if (!Value->TryGetNumber(NumberValue))
 				{
 					UE_LOG_AB(Warning, TEXT("Failed to read session attribute '%s' as a number, skipping!"), *Attribute.Key);
 					continue;
@@ -1285,7 +1496,7 @@ FOnlineSessionSettings FOnlineSessionV2AccelByte::ReadSessionSettingsFromJsonObj
 			case EJson::Array:
 			{
 				const TArray<TSharedPtr<FJsonValue>>* ArrayValue;
-				if(!Object->TryGetArrayField(Attribute.Key, ArrayValue))
+				if(!Value->TryGetArray(ArrayValue))
 				{
 					UE_LOG_AB(Warning, TEXT("Failed to read session attribute '%s' as an array, skipping!"), *Attribute.Key);
 					continue;
@@ -1455,6 +1666,9 @@ void FOnlineSessionV2AccelByte::UpdateInternalGameSession(const FName& SessionNa
 		return;
 	}
 
+	// Drop any cached search result for an older version of this session
+	SessionSearchCache->InvalidateSession(UpdatedGameSession.ID, UpdatedGameSession.Version);
+
 	// First update the session data associated with the session info structure
 	SessionInfo->SetBackendSessionData(MakeShared<FAccelByteModelsV2GameSession>(UpdatedGameSession));
 
@@ -1507,6 +1721,9 @@ void FOnlineSessionV2AccelByte::UpdateInternalPartySession(const FName& SessionN
 		return;
 	}
 
+	// Drop any cached search result for an older version of this party
+	SessionSearchCache->InvalidateSession(UpdatedPartySession.ID, UpdatedPartySession.Version);
+
 	// First update the session data associated with the session info structure
 	SessionInfo->SetBackendSessionData(MakeShared<FAccelByteModelsV2PartySession>(UpdatedPartySession));
 
@@ -1595,26 +1812,213 @@ bool FOnlineSessionV2AccelByte::UpdateSession(FName SessionName, FOnlineSessionS
 	}
 
 	EOnlineSessionTypeAccelByte SessionType = GetSessionTypeFromSettings(Session->SessionSettings);
+	if (SessionType == EOnlineSessionTypeAccelByte::PartySession && IsRunningDedicatedServer())
+	{
+		AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared(), SessionName]() {
+			SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
+		});
+		AB_OSS_INTERFACE_TRACE_END(TEXT("Game servers are not able to update party sessions!"));
+		return false;
+	}
+
+	if (SessionType == EOnlineSessionTypeAccelByte::GameSession || SessionType == EOnlineSessionTypeAccelByte::PartySession)
+	{
+		QueueSessionUpdate(SessionName, UpdatedSessionSettings);
+	}
+	
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Queued update of session data on backend!"));
+	return true;
+}
+
+void FOnlineSessionV2AccelByte::QueueSessionUpdate(const FName& SessionName, const FOnlineSessionSettings& UpdatedSessionSettings)
+{
+	FQueuedSessionUpdate& QueuedUpdate = QueuedSessionUpdates.FindOrAdd(SessionName);
+	if (!QueuedUpdate.PendingSettings.IsValid())
+	{
+		QueuedUpdate.DispatchTime = FPlatformTime::Seconds() + SessionUpdateCoalesceWindowSeconds;
+	}
+
+	// Later calls replace the pending settings outright, as each call passes the full settings for the session
+	QueuedUpdate.PendingSettings = MakeShared<FOnlineSessionSettings>(UpdatedSessionSettings);
+	QueuedUpdate.NumPendingCalls++;
+
+	if (!QueuedUpdate.bIsRequestInFlight && SessionUpdateCoalesceWindowSeconds <= 0.0)
+	{
+		DispatchSessionUpdate(SessionName, QueuedUpdate);
+	}
+}
+
+void FOnlineSessionV2AccelByte::DispatchSessionUpdate(const FName& SessionName, FQueuedSessionUpdate& QueuedUpdate)
+{
+	if (!QueuedUpdate.PendingSettings.IsValid())
+	{
+		return;
+	}
+
+	const TSharedPtr<FOnlineSessionSettings> Settings = QueuedUpdate.PendingSettings;
+	const int32 NumCalls = QueuedUpdate.NumPendingCalls;
+	QueuedUpdate.PendingSettings.Reset();
+	QueuedUpdate.NumPendingCalls = 0;
+
+	// Session may have been left while its update was waiting to be sent
+	if (GetNamedSession(SessionName) == nullptr)
+	{
+		UE_LOG_AB(Warning, TEXT("Dropping queued update of session '%s' as the session no longer exists"), *SessionName.ToString());
+		AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared(), SessionName, NumCalls]() {
+			for (int32 CallIndex = 0; CallIndex < NumCalls; CallIndex++)
+			{
+				SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
+			}
+		});
+		return;
+	}
+
+	QueuedUpdate.bIsRequestInFlight = true;
+
+	if (NumCalls > 1)
+	{
+		UE_LOG_AB(Verbose, TEXT("Coalesced %d updates of session '%s' into a single request"), NumCalls, *SessionName.ToString());
+	}
+
+	const EOnlineSessionTypeAccelByte SessionType = GetSessionTypeFromSettings(*Settings);
 	if (SessionType == EOnlineSessionTypeAccelByte::GameSession)
 	{
-		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdateGameSessionV2>(AccelByteSubsystem, SessionName, UpdatedSessionSettings);
+		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdateGameSessionV2>(AccelByteSubsystem, SessionName, *Settings, NumCalls);
 	}
-	else if (SessionType == EOnlineSessionTypeAccelByte::PartySession)
+	else
 	{
-		if (IsRunningDedicatedServer())
+		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdatePartyV2>(AccelByteSubsystem, SessionName, *Settings, NumCalls);
+	}
+}
+
+void FOnlineSessionV2AccelByte::OnSessionUpdateRequestComplete(const FName& SessionName)
+{
+	FQueuedSessionUpdate* QueuedUpdate = QueuedSessionUpdates.Find(SessionName);
+	if (QueuedUpdate == nullptr)
+	{
+		return;
+	}
+
+	QueuedUpdate->bIsRequestInFlight = false;
+	if (!QueuedUpdate->PendingSettings.IsValid())
+	{
+		QueuedSessionUpdates.Remove(SessionName);
+		return;
+	}
+
+	// The request that just finished has overwritten local settings with the backend's copy, which predates the calls
+	// still pending, so put the latest settings back until those calls are sent
+	FNamedOnlineSession* Session = GetNamedSession(SessionName);
+	if (Session != nullptr)
+	{
+		Session->SessionSettings = *QueuedUpdate->PendingSettings;
+	}
+
+	if (FPlatformTime::Seconds() >= QueuedUpdate->DispatchTime)
+	{
+		DispatchSessionUpdate(SessionName, *QueuedUpdate);
+	}
+}
+
+void FOnlineSessionV2AccelByte::DiffSessionAttributes(const TSharedPtr<FJsonObject>& BaseAttributes, const TSharedRef<FJsonObject>& NewAttributes, const TSharedRef<FJsonObject>& OutChangedAttributes, TArray<FString>& OutRemovedFields)
+{
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Attribute : NewAttributes->Values)
+	{
+		const TSharedPtr<FJsonValue>* BaseValue = BaseAttributes.IsValid() ? BaseAttributes->Values.Find(Attribute.Key) : nullptr;
+		const bool bIsUnchanged = BaseValue != nullptr && BaseValue->IsValid() && Attribute.Value.IsValid() && FJsonValue::CompareEqual(**BaseValue, *Attribute.Value);
+		if (!bIsUnchanged)
 		{
-			AccelByteSubsystem->ExecuteNextTick([SessionInterface = AsShared(), SessionName]() {
-				SessionInterface->TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
-			});
-			AB_OSS_INTERFACE_TRACE_END(TEXT("Game servers are not able to update party sessions!"));
-			return false;
+			OutChangedAttributes->Values.Add(Attribute.Key, Attribute.Value);
 		}
+	}
 
-		AccelByteSubsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteUpdatePartyV2>(AccelByteSubsystem, SessionName, UpdatedSessionSettings);
+	if (!BaseAttributes.IsValid())
+	{
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Attribute : BaseAttributes->Values)
+	{
+		if (!NewAttributes->Values.Contains(Attribute.Key))
+		{
+			OutRemovedFields.Add(Attribute.Key);
+		}
+	}
+}
+
+TSharedRef<FJsonObject> FOnlineSessionV2AccelByte::MergeSessionAttributes(const TSharedPtr<FJsonObject>& BaseAttributes, const TSharedRef<FJsonObject>& ChangedAttributes, const TArray<FString>& RemovedFields)
+{
+	TSharedRef<FJsonObject> OutAttributes = MakeShared<FJsonObject>();
+	if (BaseAttributes.IsValid())
+	{
+		OutAttributes->Values = BaseAttributes->Values;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Attribute : ChangedAttributes->Values)
+	{
+		OutAttributes->Values.Add(Attribute.Key, Attribute.Value);
+	}
+
+	for (const FString& RemovedField : RemovedFields)
+	{
+		OutAttributes->Values.Remove(RemovedField);
+	}
+
+	return OutAttributes;
+}
+
+bool FOnlineSessionV2AccelByte::ShouldSendSessionAttributeDeltas() const
+{
+	return bSendSessionAttributeDeltas;
+}
+
+bool FOnlineSessionV2AccelByte::IsSessionVersionConflict(int32 ErrorCode) const
+{
+	return ErrorCode == SessionVersionConflictErrorCode;
+}
+
+int32 FOnlineSessionV2AccelByte::GetMaxSessionUpdateConflictRetries() const
+{
+	return MaxSessionUpdateConflictRetries;
+}
+
+int32 FOnlineSessionV2AccelByte::GetFindSessionsMaxConcurrentPages() const
+{
+	return FindSessionsMaxConcurrentPages;
+}
+
+TSharedPtr<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe> FOnlineSessionV2AccelByte::GetSessionSearchCache() const
+{
+	return SessionSearchCache;
+}
+
+void FOnlineSessionV2AccelByte::QueueFindSessionsResultsReceived(const TSharedRef<FOnlineSessionSearch>& SearchSettings, TArray<FOnlineSessionSearchResult>&& NewResults)
+{
+	FScopeLock ScopeLock(&FindSessionsResultsLock);
+	PendingFindSessionsResults.Emplace(SearchSettings, MoveTemp(NewResults));
+}
+
+void FOnlineSessionV2AccelByte::FlushFindSessionsResultsReceived()
+{
+	TArray<TPair<TSharedRef<FOnlineSessionSearch>, TArray<FOnlineSessionSearchResult>>> ResultsToDeliver;
+	{
+		FScopeLock ScopeLock(&FindSessionsResultsLock);
+		if (PendingFindSessionsResults.Num() == 0)
+		{
+			return;
+		}
+
+		ResultsToDeliver = MoveTemp(PendingFindSessionsResults);
+		PendingFindSessionsResults.Reset();
+	}
+
+	// Results are only appended to the search here on the game thread, so that game code reading SearchResults never
+	// races the thread that the backend responses came in on
+	for (const TPair<TSharedRef<FOnlineSessionSearch>, TArray<FOnlineSessionSearchResult>>& Results : ResultsToDeliver)
+	{
+		Results.Key->SearchResults.Append(Results.Value);
+		TriggerOnFindSessionsResultsReceivedDelegates(Results.Key, Results.Value);
 	}
-	
-	AB_OSS_INTERFACE_TRACE_END(TEXT("Created async task to update session data on backend!"));
-	return true;
 }
 
 bool FOnlineSessionV2AccelByte::EndSession(FName SessionName)
@@ -2790,6 +3194,34 @@ bool FOnlineSessionV2AccelByte::RefreshSession(const FName& SessionName, const F
 	return true;
 }
 
+void FOnlineSessionV2AccelByte::RegisterSessionAttributeSchema(const TArray<FSessionAttributeSchemaFieldAccelByte>& Fields)
+{
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("NumFields: %d"), Fields.Num());
+
+	// Compile the schema outside of the lock, conversions already in flight keep using the schema they copied
+	FOnlineSessionAttributeSchemaAccelBytePtr NewSchema = nullptr;
+	if (Fields.Num() > 0)
+	{
+		NewSchema = MakeShared<const FOnlineSessionAttributeSchemaAccelByte, ESPMode::ThreadSafe>(Fields);
+	}
+
+	SetSessionAttributeSchema(NewSchema);
+
+	AB_OSS_INTERFACE_TRACE_END(TEXT("Registered session attribute schema with %d attributes"), NewSchema.IsValid() ? NewSchema->Num() : 0);
+}
+
+FOnlineSessionAttributeSchemaAccelBytePtr FOnlineSessionV2AccelByte::GetSessionAttributeSchema() const
+{
+	FScopeLock ScopeLock(&SessionAttributeSchemaLock);
+	return SessionAttributeSchema;
+}
+
+void FOnlineSessionV2AccelByte::SetSessionAttributeSchema(const FOnlineSessionAttributeSchemaAccelBytePtr& InSchema)
+{
+	FScopeLock ScopeLock(&SessionAttributeSchemaLock);
+	SessionAttributeSchema = InSchema;
+}
+
 bool FOnlineSessionV2AccelByte::AcceptBackfillProposal(const FName& SessionName, const FAccelByteModelsV2MatchmakingBackfillProposalNotif& Proposal, bool bStopBackfilling, const FOnAcceptBackfillProposalComplete& Delegate)
 {
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionName: %s"), *SessionName.ToString());
@@ -2826,6 +3258,8 @@ bool FOnlineSessionV2AccelByte::RejectBackfillProposal(const FName& SessionName,
 
 void FOnlineSessionV2AccelByte::OnInvitedToGameSessionNotification(FAccelByteModelsV2GameSessionUserInvitedEvent InviteEvent, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *InviteEvent.SessionID);
 
 	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(AccelByteSubsystem->GetIdentityInterface());
@@ -2927,6 +3361,8 @@ void FOnlineSessionV2AccelByte::OnFindGameSessionForInviteComplete(int32 LocalUs
 
 void FOnlineSessionV2AccelByte::OnGameSessionMembersChangedNotification(FAccelByteModelsV2GameSessionMembersChangedEvent MembersChangedEvent, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s; JoinerId: %s"), *MembersChangedEvent.SessionID, *MembersChangedEvent.JoinerID);
 
 	HandleSessionMembersChangedNotification(MembersChangedEvent.SessionID, MembersChangedEvent.Members, MembersChangedEvent.JoinerID);
@@ -2936,8 +3372,12 @@ void FOnlineSessionV2AccelByte::OnGameSessionMembersChangedNotification(FAccelBy
 
 void FOnlineSessionV2AccelByte::OnGameSessionUpdatedNotification(FAccelByteModelsV2GameSession UpdatedGameSession, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *UpdatedGameSession.ID);
 
+	SessionSearchCache->InvalidateSession(UpdatedGameSession.ID, UpdatedGameSession.Version);
+
 	FNamedOnlineSession* Session = GetNamedSessionById(UpdatedGameSession.ID);
 	if (Session == nullptr)
 	{
@@ -2960,6 +3400,8 @@ void FOnlineSessionV2AccelByte::OnGameSessionUpdatedNotification(FAccelByteModel
 
 void FOnlineSessionV2AccelByte::OnDsStatusChangedNotification(FAccelByteModelsV2DSStatusChangedNotif DsStatusChangeEvent, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *DsStatusChangeEvent.SessionID);
 
 	if (!DsStatusChangeEvent.Error.IsEmpty())
@@ -3034,6 +3476,8 @@ FNamedOnlineSession* FOnlineSessionV2AccelByte::GetPartySession() const
 
 void FOnlineSessionV2AccelByte::OnInvitedToPartySessionNotification(FAccelByteModelsV2PartyInvitedEvent InviteEvent, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(AccelByteSubsystem->GetIdentityInterface());
 	if (!ensure(IdentityInterface.IsValid()))
 	{
@@ -3131,6 +3575,8 @@ void FOnlineSessionV2AccelByte::OnFindPartySessionForInviteComplete(int32 LocalU
 
 void FOnlineSessionV2AccelByte::OnPartySessionMembersChangedNotification(FAccelByteModelsV2PartyMembersChangedEvent MemberChangeEvent, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s; JoinerId: %s"), *MemberChangeEvent.PartyID, *MemberChangeEvent.JoinerID);
 
 	HandleSessionMembersChangedNotification(MemberChangeEvent.PartyID, MemberChangeEvent.Members, MemberChangeEvent.JoinerID);
@@ -3140,8 +3586,12 @@ void FOnlineSessionV2AccelByte::OnPartySessionMembersChangedNotification(FAccelB
 
 void FOnlineSessionV2AccelByte::OnPartySessionUpdatedNotification(FAccelByteModelsV2PartySession UpdatedPartySession, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *UpdatedPartySession.ID);
 
+	SessionSearchCache->InvalidateSession(UpdatedPartySession.ID, UpdatedPartySession.Version);
+
 	FNamedOnlineSession* Session = GetNamedSessionById(UpdatedPartySession.ID);
 	if (Session == nullptr)
 	{
@@ -3164,6 +3614,8 @@ void FOnlineSessionV2AccelByte::OnPartySessionUpdatedNotification(FAccelByteMode
 
 void FOnlineSessionV2AccelByte::OnPartySessionInviteRejectedNotification(FAccelByteModelsV2PartyUserRejectedEvent RejectEvent, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("LocalUserNum: %d; SessionId: %s"), LocalUserNum, *RejectEvent.PartyID);
 
 	FNamedOnlineSession* Session = GetNamedSessionById(RejectEvent.PartyID);
@@ -3188,11 +3640,14 @@ void FOnlineSessionV2AccelByte::OnPartySessionInviteRejectedNotification(FAccelB
 		return;
 	}
 
-	SessionData->Members = RejectEvent.Members;
-	SessionInfo->UpdatePlayerLists();
-	SessionInfo->UpdateLeaderId();
+	FAccelByteSessionMembersChangeSet ChangeSet;
+	SessionInfo->UpdateMembers(RejectEvent.Members, ChangeSet);
 
 	TriggerOnUpdateSessionCompleteDelegates(Session->SessionName, true);
+	if (!ChangeSet.IsEmpty())
+	{
+		TriggerOnSessionMembersChangedDelegates(Session->SessionName, ChangeSet);
+	}
 
 	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
 }
@@ -3201,6 +3656,9 @@ void FOnlineSessionV2AccelByte::HandleSessionMembersChangedNotification(const FS
 {
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s; JoinerId: %s"), *SessionId, *JoinerId);
 
+	// Member notifications carry no version, but any change to the members means a newer version on the backend
+	SessionSearchCache->InvalidateSession(SessionId);
+
 	FNamedOnlineSession* Session = GetNamedSessionById(SessionId);
 	if (Session == nullptr)
 	{
@@ -3223,14 +3681,14 @@ void FOnlineSessionV2AccelByte::HandleSessionMembersChangedNotification(const FS
 		return;
 	}
 
-	// Grab the old members array in case we need to diff it
-	const TArray<FAccelByteModelsV2SessionUser> PreviousMembers = SessionData->Members;
-
-	// Set new members array and update the invite list on session info
-	SessionData->Members = NewMembers;
+	// Set new members array, diffing it against the previous one so that session info only has to patch the members that
+	// changed into its player lists
+	FAccelByteSessionMembersChangeSet ChangeSet;
+	SessionInfo->UpdateMembers(NewMembers, ChangeSet);
 	SessionData->Version++;
-	SessionInfo->UpdatePlayerLists();
-	SessionInfo->UpdateLeaderId();
+
+	// Grab the session name up front, as unregistering ourselves from the session will destroy it
+	const FName SessionName = Session->SessionName;
 
 	// If the JoinerId for the event is not blank, then we just have to register this player and update session info
 	if (!JoinerId.IsEmpty())
@@ -3244,50 +3702,33 @@ void FOnlineSessionV2AccelByte::HandleSessionMembersChangedNotification(const FS
 		{
 			RegisterJoinedSessionMember(Session, *FoundUser);
 		}
-
-		return;
 	}
-
-	// If we do not have an ID for a user that has joined this session, then we need to diff the previous members array
-	// and the new members array to figure out what changed. If the status changes to Leave or Disconnect, we need to
-	// unregister that player. If it changes to join or connect we need to register them.
-	for (const FAccelByteModelsV2SessionUser& NewMember : NewMembers)
+	else
 	{
-		const FAccelByteModelsV2SessionUser* PreviousMember = PreviousMembers.FindByPredicate([&NewMember](const FAccelByteModelsV2SessionUser& Member) {
-			return Member.ID == NewMember.ID;
-		});
-
-		// If this user's status hasn't changed, then just move on to next member
-		if (PreviousMember != nullptr && PreviousMember->Status == NewMember.Status)
+		// Otherwise, register every member that moved to a joined or connected status, and unregister every member that
+		// moved away from one. Other status changes, such as joined to connected, do not change who is in the session.
+		for (const FAccelByteSessionMemberChange& Change : ChangeSet.Joined)
 		{
-			continue;
+			RegisterJoinedSessionMember(Session, Change.Member);
 		}
 
-		const bool bIsJoinStatus = NewMember.Status == EAccelByteV2SessionMemberStatus::JOINED || NewMember.Status == EAccelByteV2SessionMemberStatus::CONNECTED;
-		const bool bIsLeaveStatus = NewMember.Status == EAccelByteV2SessionMemberStatus::LEFT || NewMember.Status == EAccelByteV2SessionMemberStatus::KICKED || NewMember.Status == EAccelByteV2SessionMemberStatus::DROPPED;
-
-		// If this player is joining the session, then we want to register them and fire delegates
-		if (bIsJoinStatus)
+		for (const FAccelByteSessionMemberChange& Change : ChangeSet.Left)
 		{
-			RegisterJoinedSessionMember(Session, NewMember);
-		}
-		else
-		{
-			UnregisterLeftSessionMember(Session, NewMember);
+			UnregisterLeftSessionMember(Session, Change.Member);
 		}
 	}
+
+	if (!ChangeSet.IsEmpty())
+	{
+		TriggerOnSessionMembersChangedDelegates(SessionName, ChangeSet);
+	}
 	
 	AB_OSS_INTERFACE_TRACE_END(TEXT(""));
 }
 
 void FOnlineSessionV2AccelByte::RegisterJoinedSessionMember(FNamedOnlineSession* Session, const FAccelByteModelsV2SessionUser& JoinedMember)
 {
-	FAccelByteUniqueIdComposite IdComponents;
-	IdComponents.Id = JoinedMember.ID;
-	IdComponents.PlatformType = JoinedMember.PlatformID;
-	IdComponents.PlatformId = JoinedMember.PlatformUserID;
-
-	TSharedPtr<const FUniqueNetIdAccelByteUser> JoinedUserId = FUniqueNetIdAccelByteUser::Create(IdComponents);
+	TSharedPtr<const FUniqueNetIdAccelByteUser> JoinedUserId = AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(JoinedMember.ID, JoinedMember.PlatformID, JoinedMember.PlatformUserID);
 	if (ensure(JoinedUserId.IsValid()))
 	{
 		RegisterPlayer(Session->SessionName, JoinedUserId.ToSharedRef().Get(), false);
@@ -3297,12 +3738,7 @@ void FOnlineSessionV2AccelByte::RegisterJoinedSessionMember(FNamedOnlineSession*
 
 void FOnlineSessionV2AccelByte::UnregisterLeftSessionMember(FNamedOnlineSession* Session, const FAccelByteModelsV2SessionUser& LeftMember)
 {
-	FAccelByteUniqueIdComposite IdComponents;
-	IdComponents.Id = LeftMember.ID;
-	IdComponents.PlatformType = LeftMember.PlatformID;
-	IdComponents.PlatformId = LeftMember.PlatformUserID;
-
-	TSharedPtr<const FUniqueNetIdAccelByteUser> LeftUserId = FUniqueNetIdAccelByteUser::Create(IdComponents);
+	TSharedPtr<const FUniqueNetIdAccelByteUser> LeftUserId = AccelByteSubsystem->GetUserIdRegistry()->FindOrCreate(LeftMember.ID, LeftMember.PlatformID, LeftMember.PlatformUserID);
 	if (!ensure(LeftUserId.IsValid()))
 	{
 		return;
@@ -3326,6 +3762,8 @@ void FOnlineSessionV2AccelByte::UnregisterLeftSessionMember(FNamedOnlineSession*
 
 void FOnlineSessionV2AccelByte::OnMatchmakingStartedNotification(FAccelByteModelsV2StartMatchmakingNotif MatchmakingStartedNotif, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT(""));
 
 	if (CurrentMatchmakingSearchHandle.IsValid())
@@ -3365,6 +3803,8 @@ void FOnlineSessionV2AccelByte::OnMatchmakingStartedNotification(FAccelByteModel
 
 void FOnlineSessionV2AccelByte::OnMatchmakingMatchFoundNotification(FAccelByteModelsV2MatchFoundNotif MatchFoundEvent, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *MatchFoundEvent.Id);
 
 	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(AccelByteSubsystem->GetIdentityInterface());
@@ -3396,6 +3836,8 @@ void FOnlineSessionV2AccelByte::OnMatchmakingMatchFoundNotification(FAccelByteMo
 
 void FOnlineSessionV2AccelByte::OnMatchmakingExpiredNotification(FAccelByteModelsV2MatchmakingExpiredNotif MatchmakingExpiredNotif, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("Ticket id %s"), *MatchmakingExpiredNotif.TicketID);
 
 	if (!CurrentMatchmakingSearchHandle.IsValid())
@@ -3548,7 +3990,9 @@ void FOnlineSessionV2AccelByte::DisconnectFromDSHub()
 
 void FOnlineSessionV2AccelByte::OnServerClaimedNotification(const FAccelByteModelsServerClaimedNotification& Notification)
 {
-	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *Notification.Session_id)
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
+	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("SessionId: %s"), *Notification.Session_id);
 
 	// Bail if this is not a dedicated server
 	if (!IsRunningDedicatedServer())
@@ -3572,6 +4016,8 @@ void FOnlineSessionV2AccelByte::OnServerClaimedNotification(const FAccelByteMode
 
 void FOnlineSessionV2AccelByte::OnV2BackfillProposalNotification(const FAccelByteModelsV2MatchmakingBackfillProposalNotif& Notification)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	AB_OSS_INTERFACE_TRACE_BEGIN(TEXT("BackfillTicketId: %s; ProposalId: %s"), *Notification.BackfillTicketID, *Notification.ProposalID);
 
 	// Bail if this is not a dedicated server
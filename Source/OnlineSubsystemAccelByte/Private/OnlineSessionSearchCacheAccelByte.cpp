@@ -0,0 +1,158 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineSessionSearchCacheAccelByte.h"
+#include "OnlineSessionInterfaceV2AccelByte.h"
+
+FOnlineSessionSearchCacheAccelByte::FOnlineSessionSearchCacheAccelByte(int32 InMaxEntries, double InTimeToLiveSeconds)
+	: MaxEntries(InMaxEntries)
+	, TimeToLiveSeconds(InTimeToLiveSeconds)
+{
+}
+
+bool FOnlineSessionSearchCacheAccelByte::GetSession(const FString& SessionId, bool bIsPartySession, FOnlineSession& OutSession)
+{
+	if (TimeToLiveSeconds <= 0.0)
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	FCacheEntry* Entry = Entries.Find(SessionId);
+	if (Entry == nullptr || Entry->bIsPartySession != bIsPartySession)
+	{
+		return false;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - Entry->FetchedTime > TimeToLiveSeconds)
+	{
+		return false;
+	}
+
+	Entry->LastUsedTime = CurrentTime;
+	CopySession(*Entry, OutSession);
+	return true;
+}
+
+bool FOnlineSessionSearchCacheAccelByte::GetSessionForVersion(const FString& SessionId, int32 Version, bool bIsPartySession, FOnlineSession& OutSession)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FCacheEntry* Entry = Entries.Find(SessionId);
+	if (Entry == nullptr || Entry->Version != Version || Entry->bIsPartySession != bIsPartySession)
+	{
+		return false;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	Entry->FetchedTime = CurrentTime;
+	Entry->LastUsedTime = CurrentTime;
+	CopySession(*Entry, OutSession);
+	return true;
+}
+
+void FOnlineSessionSearchCacheAccelByte::AddSession(const FString& SessionId, int32 Version, bool bIsPartySession, const FOnlineSession& Session)
+{
+	if (MaxEntries <= 0 || SessionId.IsEmpty())
+	{
+		return;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	FScopeLock ScopeLock(&Lock);
+
+	FCacheEntry* Entry = Entries.Find(SessionId);
+	if (Entry != nullptr && Entry->Version > Version)
+	{
+		// Never go back to an older version than one we have already seen
+		return;
+	}
+
+	if (Entry == nullptr && Entries.Num() >= MaxEntries)
+	{
+		// Evict the least recently used entry. Caches are kept small, so a scan is cheaper than keeping entries ordered.
+		const FString* OldestSessionId = nullptr;
+		double OldestUsedTime = TNumericLimits<double>::Max();
+		for (const TPair<FString, FCacheEntry>& Pair : Entries)
+		{
+			if (Pair.Value.LastUsedTime < OldestUsedTime)
+			{
+				OldestUsedTime = Pair.Value.LastUsedTime;
+				OldestSessionId = &Pair.Key;
+			}
+		}
+
+		if (OldestSessionId != nullptr)
+		{
+			const FString SessionIdToEvict = *OldestSessionId;
+			Entries.Remove(SessionIdToEvict);
+		}
+	}
+
+	FCacheEntry& NewEntry = Entries.FindOrAdd(SessionId);
+	NewEntry.Version = Version;
+	NewEntry.bIsPartySession = bIsPartySession;
+	NewEntry.FetchedTime = CurrentTime;
+	NewEntry.LastUsedTime = CurrentTime;
+
+	// Store our own copy, so that the session passed in can be handed out and changed freely
+	FCacheEntry SourceEntry;
+	SourceEntry.bIsPartySession = bIsPartySession;
+	SourceEntry.Session = Session;
+	CopySession(SourceEntry, NewEntry.Session);
+}
+
+void FOnlineSessionSearchCacheAccelByte::InvalidateSession(const FString& SessionId, int32 NewVersion)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const FCacheEntry* Entry = Entries.Find(SessionId);
+	if (Entry != nullptr && (NewVersion == INDEX_NONE || Entry->Version < NewVersion))
+	{
+		Entries.Remove(SessionId);
+	}
+}
+
+void FOnlineSessionSearchCacheAccelByte::Empty()
+{
+	FScopeLock ScopeLock(&Lock);
+	Entries.Empty();
+}
+
+int32 FOnlineSessionSearchCacheAccelByte::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Entries.Num();
+}
+
+void FOnlineSessionSearchCacheAccelByte::CopySession(const FCacheEntry& Entry, FOnlineSession& OutSession)
+{
+	OutSession = Entry.Session;
+
+	const TSharedPtr<FOnlineSessionInfoAccelByteV2> SessionInfo = StaticCastSharedPtr<FOnlineSessionInfoAccelByteV2>(Entry.Session.SessionInfo);
+	if (!SessionInfo.IsValid())
+	{
+		return;
+	}
+
+	// Session info and backend data are mutated in place once a session is joined, so each copy needs its own
+	const TSharedRef<FOnlineSessionInfoAccelByteV2> SessionInfoCopy = MakeShared<FOnlineSessionInfoAccelByteV2>(*SessionInfo);
+	const TSharedPtr<FAccelByteModelsV2BaseSession> BackendSessionData = SessionInfo->GetBackendSessionData();
+	if (BackendSessionData.IsValid())
+	{
+		if (Entry.bIsPartySession)
+		{
+			SessionInfoCopy->SetBackendSessionData(MakeShared<FAccelByteModelsV2PartySession>(*StaticCastSharedPtr<FAccelByteModelsV2PartySession>(BackendSessionData)));
+		}
+		else
+		{
+			SessionInfoCopy->SetBackendSessionData(MakeShared<FAccelByteModelsV2GameSession>(*StaticCastSharedPtr<FAccelByteModelsV2GameSession>(BackendSessionData)));
+		}
+	}
+
+	OutSession.SessionInfo = SessionInfoCopy;
+}
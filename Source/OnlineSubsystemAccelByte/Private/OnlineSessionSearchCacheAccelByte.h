@@ -0,0 +1,112 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSessionSettings.h"
+
+/**
+ * Bounded cache of V2 game and party sessions recently seen from the backend, already converted to session search results,
+ * keyed by session ID along with the backend version that each was converted from.
+ *
+ * Used in two ways. A session that comes back from the backend with the same version as a cached entry reuses the cached
+ * conversion, rather than reading its attributes into settings again. And lookups of a single session by ID are served
+ * straight from the cache while the entry is younger than the time to live, without a request to the backend. Entries are
+ * dropped once a notification brings a newer version, and the least recently used entry is evicted once the cache is full.
+ *
+ * Sessions handed out from the cache get their own copy of the session info and backend data, so that they can be joined
+ * and updated without touching the cached entry. All methods are thread safe, as search results are built on whichever
+ * thread the backend response arrives on.
+ */
+class FOnlineSessionSearchCacheAccelByte
+{
+public:
+	/**
+	 * @param InMaxEntries Most sessions kept in the cache, zero or less disables the cache entirely
+	 * @param InTimeToLiveSeconds How long after being fetched a session may be served without asking the backend, zero or
+	 * less only reuses conversions of a version we got from the backend again
+	 */
+	FOnlineSessionSearchCacheAccelByte(int32 InMaxEntries, double InTimeToLiveSeconds);
+
+	/**
+	 * Get a copy of a cached session that was fetched within the time to live
+	 *
+	 * @param SessionId ID of the session on the backend
+	 * @param bIsPartySession Whether the session looked up is a party rather than a game session
+	 * @param OutSession Copy of the cached session, only set if found
+	 * @return whether a fresh enough entry was found
+	 */
+	bool GetSession(const FString& SessionId, bool bIsPartySession, FOnlineSession& OutSession);
+
+	/**
+	 * Get a copy of a cached session if it was converted from the given version, whatever its age. The entry counts as
+	 * fetched again, as the backend has just given us this version.
+	 *
+	 * @return whether an entry with the same version was found
+	 */
+	bool GetSessionForVersion(const FString& SessionId, int32 Version, bool bIsPartySession, FOnlineSession& OutSession);
+
+	/**
+	 * Add a session converted from a backend model, replacing any entry for an older or equal version
+	 */
+	void AddSession(const FString& SessionId, int32 Version, bool bIsPartySession, const FOnlineSession& Session);
+
+	/**
+	 * Drop the entry for a session if it is older than the given version
+	 *
+	 * @param NewVersion Version the session is now at, or INDEX_NONE to drop the entry whatever its version
+	 */
+	void InvalidateSession(const FString& SessionId, int32 NewVersion = INDEX_NONE);
+
+	/**
+	 * Drop every entry
+	 */
+	void Empty();
+
+	/**
+	 * Number of sessions in the cache
+	 */
+	int32 Num() const;
+
+private:
+	/** Session converted from a single version of a backend model */
+	struct FCacheEntry
+	{
+		/** Version of the backend model the session was converted from */
+		int32 Version = 0;
+
+		/** Whether the session is a party rather than a game session */
+		bool bIsPartySession = false;
+
+		/** Converted session, never handed out directly */
+		FOnlineSession Session;
+
+		/** Time the backend last gave us this version, in FPlatformTime::Seconds */
+		double FetchedTime = 0.0;
+
+		/** Time the entry was last added or read, in FPlatformTime::Seconds, for evicting the least recently used */
+		double LastUsedTime = 0.0;
+	};
+
+	/** Most sessions kept in the cache */
+	const int32 MaxEntries;
+
+	/** How long after being fetched a session may be served without asking the backend */
+	const double TimeToLiveSeconds;
+
+	/** Lock guarding the entries */
+	mutable FCriticalSection Lock;
+
+	/** Cached sessions by session ID */
+	TMap<FString, FCacheEntry> Entries;
+
+	/**
+	 * Copy a cached session, giving the copy its own session info and backend data
+	 */
+	static void CopySession(const FCacheEntry& Entry, FOnlineSession& OutSession);
+
+};
+
+typedef TSharedPtr<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe> FOnlineSessionSearchCacheAccelBytePtr;
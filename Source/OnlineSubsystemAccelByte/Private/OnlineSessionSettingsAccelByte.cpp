@@ -5,6 +5,8 @@
 #include "OnlineSessionSettingsAccelByte.h"
 
 #include "OnlineSubsystemAccelByte.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
 
 constexpr auto DATA_OFFSET = sizeof(uint8);
 
@@ -344,3 +346,259 @@ ESessionSettingsAccelByteArrayFieldType FOnlineSessionSettingsAccelByte::GetArra
 
 	return StaticCast<ESessionSettingsAccelByteArrayFieldType>(RawArray[0]);
 }
+
+FOnlineSessionAttributeSchemaAccelByte::FOnlineSessionAttributeSchemaAccelByte(const TArray<FSessionAttributeSchemaFieldAccelByte>& InFields)
+{
+	Fields.Reserve(InFields.Num());
+	FieldIndicesBySettingName.Reserve(InFields.Num());
+	FieldIndicesByFieldName.Reserve(InFields.Num());
+
+	for (const FSessionAttributeSchemaFieldAccelByte& InField : InFields)
+	{
+		bool bIsSupportedType = false;
+		switch (InField.Type)
+		{
+			case EOnlineKeyValuePairDataType::String:
+			case EOnlineKeyValuePairDataType::Double:
+				bIsSupportedType = true;
+				break;
+			case EOnlineKeyValuePairDataType::Bool:
+			case EOnlineKeyValuePairDataType::Int32:
+			case EOnlineKeyValuePairDataType::Int64:
+			case EOnlineKeyValuePairDataType::Float:
+				bIsSupportedType = !InField.bIsArray;
+				break;
+			default:
+				break;
+		}
+
+		if (!bIsSupportedType)
+		{
+			UE_LOG_AB(Warning, TEXT("Leaving session attribute '%s' out of schema as type '%s'%s is not supported!"), *InField.Name.ToString(), EOnlineKeyValuePairDataType::ToString(InField.Type), InField.bIsArray ? TEXT(" (array)") : TEXT(""));
+			continue;
+		}
+
+		// Field names are the setting name in upper case, same as when converting attributes without a schema. As FNames
+		// are not case sensitive, settings that only differ by case would clash in attributes, so check for those as well.
+		FString FieldName = InField.Name.ToString().ToUpper();
+		if (FieldIndicesBySettingName.Contains(InField.Name) || FieldIndicesByFieldName.Contains(FieldName))
+		{
+			UE_LOG_AB(Warning, TEXT("Leaving session attribute '%s' out of schema as an attribute with the same name is already in it!"), *InField.Name.ToString());
+			continue;
+		}
+
+		const int32 FieldIndex = Fields.Num();
+		FieldIndicesBySettingName.Add(InField.Name, FieldIndex);
+		FieldIndicesByFieldName.Add(FieldName, FieldIndex);
+		Fields.Add(FCompiledField{InField.Name, MoveTemp(FieldName), InField.Type, InField.bIsArray});
+	}
+}
+
+const FOnlineSessionAttributeSchemaAccelByte::FCompiledField* FOnlineSessionAttributeSchemaAccelByte::FindBySettingName(const FName& SettingName) const
+{
+	const int32* FieldIndex = FieldIndicesBySettingName.Find(SettingName);
+	return (FieldIndex != nullptr) ? &Fields[*FieldIndex] : nullptr;
+}
+
+const FOnlineSessionAttributeSchemaAccelByte::FCompiledField* FOnlineSessionAttributeSchemaAccelByte::FindByFieldName(const FString& FieldName) const
+{
+	const int32* FieldIndex = FieldIndicesByFieldName.Find(FieldName);
+	return (FieldIndex != nullptr) ? &Fields[*FieldIndex] : nullptr;
+}
+
+int32 FOnlineSessionAttributeSchemaAccelByte::Num() const
+{
+	return Fields.Num();
+}
+
+bool FOnlineSessionAttributeSchemaAccelByte::WriteAttribute(const FCompiledField& Field, const FVariantData& Data, const TSharedRef<FJsonObject>& OutObject)
+{
+	if (!Field.bIsArray)
+	{
+		if (Data.GetType() != Field.Type)
+		{
+			return false;
+		}
+
+		Data.AddToJsonObject(OutObject, Field.FieldName, false);
+		return true;
+	}
+
+	// Array attributes are stored as blobs in session settings, see FOnlineSessionSettingsAccelByte::Set
+	if (Data.GetType() != EOnlineKeyValuePairDataType::Blob)
+	{
+		return false;
+	}
+
+	TArray<uint8> RawArray;
+	Data.GetValue(RawArray);
+
+	TArray<TSharedPtr<FJsonValue>> JsonArray;
+	if (Field.Type == EOnlineKeyValuePairDataType::String)
+	{
+		TArray<FString> Array;
+		if (!ConvertBytesToArray(RawArray, Array))
+		{
+			return false;
+		}
+
+		JsonArray.Reserve(Array.Num());
+		for (FString& Item : Array)
+		{
+			JsonArray.Emplace(MakeShared<FJsonValueString>(MoveTemp(Item)));
+		}
+	}
+	else
+	{
+		TArray<double> Array;
+		if (!ConvertBytesToArray(RawArray, Array))
+		{
+			return false;
+		}
+
+		JsonArray.Reserve(Array.Num());
+		for (const double Item : Array)
+		{
+			JsonArray.Emplace(MakeShared<FJsonValueNumber>(Item));
+		}
+	}
+
+	OutObject->SetArrayField(Field.FieldName, JsonArray);
+	return true;
+}
+
+bool FOnlineSessionAttributeSchemaAccelByte::ReadAttribute(const FCompiledField& Field, const TSharedPtr<FJsonValue>& Value, FOnlineSessionSettings& OutSettings)
+{
+	if (!Value.IsValid())
+	{
+		return false;
+	}
+
+	if (Field.bIsArray)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray = nullptr;
+		if (!Value->TryGetArray(JsonArray))
+		{
+			return false;
+		}
+
+		// Unlike reading without a schema, we know what the items should be, so empty arrays can be read as well
+		if (Field.Type == EOnlineKeyValuePairDataType::String)
+		{
+			TArray<FString> Array;
+			Array.Reserve(JsonArray->Num());
+			for (const TSharedPtr<FJsonValue>& Item : *JsonArray)
+			{
+				if (!Item.IsValid() || !Item->TryGetString(Array.AddDefaulted_GetRef()))
+				{
+					return false;
+				}
+			}
+
+			FOnlineSessionSettingsAccelByte::Set(OutSettings, Field.Name, Array);
+		}
+		else
+		{
+			TArray<double> Array;
+			Array.Reserve(JsonArray->Num());
+			for (const TSharedPtr<FJsonValue>& Item : *JsonArray)
+			{
+				if (!Item.IsValid() || !Item->TryGetNumber(Array.AddDefaulted_GetRef()))
+				{
+					return false;
+				}
+			}
+
+			FOnlineSessionSettingsAccelByte::Set(OutSettings, Field.Name, Array);
+		}
+
+		return true;
+	}
+
+	switch (Field.Type)
+	{
+		case EOnlineKeyValuePairDataType::Bool:
+		{
+			bool BoolValue;
+			if (!Value->TryGetBool(BoolValue))
+			{
+				return false;
+			}
+
+			OutSettings.Set(Field.Name, BoolValue);
+			return true;
+		}
+
+		case EOnlineKeyValuePairDataType::Int32:
+		{
+			int32 IntValue;
+			if (!Value->TryGetNumber(IntValue))
+			{
+				return false;
+			}
+
+			OutSettings.Set(Field.Name, IntValue);
+			return true;
+		}
+
+		case EOnlineKeyValuePairDataType::Int64:
+		{
+			// 64 bit integers may be written as strings to keep their precision, so take either
+			int64 IntValue;
+			FString StringValue;
+			if (Value->Type == EJson::String)
+			{
+				if (!Value->TryGetString(StringValue) || !LexTryParseString(IntValue, *StringValue))
+				{
+					return false;
+				}
+			}
+			else if (!Value->TryGetNumber(IntValue))
+			{
+				return false;
+			}
+
+			OutSettings.Set(Field.Name, IntValue);
+			return true;
+		}
+
+		case EOnlineKeyValuePairDataType::Float:
+		{
+			double NumberValue;
+			if (!Value->TryGetNumber(NumberValue))
+			{
+				return false;
+			}
+
+			OutSettings.Set(Field.Name, static_cast<float>(NumberValue));
+			return true;
+		}
+
+		case EOnlineKeyValuePairDataType::Double:
+		{
+			double NumberValue;
+			if (!Value->TryGetNumber(NumberValue))
+			{
+				return false;
+			}
+
+			OutSettings.Set(Field.Name, NumberValue);
+			return true;
+		}
+
+		case EOnlineKeyValuePairDataType::String:
+		{
+			FString StringValue;
+			if (!Value->TryGetString(StringValue))
+			{
+				return false;
+			}
+
+			OutSettings.Set(Field.Name, StringValue);
+			return true;
+		}
+
+		default:
+			return false;
+	}
+}
@@ -13,6 +13,12 @@
 #include "OnlinePartyInterfaceAccelByte.h"
 #include "OnlinePresenceInterfaceAccelByte.h"
 #include "OnlineUserCacheAccelByte.h"
+#include "OnlineUserIdRegistryAccelByte.h"
+#include "OnlineAsyncTaskMetricsAccelByte.h"
+#include "OnlineSubsystemAccelByteTrace.h"
+#include "OnlineAsyncTaskPoolAccelByte.h"
+#include "OnlineBackendAccelByte.h"
+#include "OnlineFakeBackendAccelByte.h"
 #include "OnlineAgreementInterfaceAccelByte.h"
 #include "OnlineWalletInterfaceAccelByte.h"
 #include "OnlineSubsystemAccelByteModule.h"
@@ -27,6 +33,11 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "ExecTests/ExecTestBase.h"
+#include "ExecTests/ExecTestBenchmarkUserId.h"
+#include "ExecTests/ExecTestBenchmarkUserCache.h"
+#include "ExecTests/ExecTestBenchmarkPlatformUserKey.h"
+#include "ExecTests/ExecTestBenchmarkFakeBackend.h"
+#include "ExecTests/ExecTestBenchmarkSessionAttributes.h"
 #endif
 #include "OnlineAgreementInterfaceAccelByte.h"
 
@@ -51,13 +62,34 @@ bool FOnlineSubsystemAccelByte::Init()
 	PartyInterface = MakeShared<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe>(this);
 	PresenceInterface = MakeShared<FOnlinePresenceAccelByte, ESPMode::ThreadSafe>(this);
 	UserCache = MakeShared<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe>(this);
+	UserIdRegistry = MakeShared<FOnlineUserIdRegistryAccelByte, ESPMode::ThreadSafe>();
 	AgreementInterface = MakeShared<FOnlineAgreementAccelByte, ESPMode::ThreadSafe>(this);
 	WalletInterface = MakeShared<FOnlineWalletAccelByte, ESPMode::ThreadSafe>(this);
 	EntitlementsInterface = MakeShared<FOnlineEntitlementsAccelByte, ESPMode::ThreadSafe>(this);
 	StoreV2Interface = MakeShared<FOnlineStoreV2AccelByte, ESPMode::ThreadSafe>(this);
 	PurchaseInterface = MakeShared<FOnlinePurchaseAccelByte, ESPMode::ThreadSafe>(this);
 	
-	// Create an async task manager and a thread for the manager to process tasks on
+	// Create the backend that our async tasks send requests through, which is the live backend unless configured otherwise
+	Backend = MakeShared<FOnlineBackendAccelByte, ESPMode::ThreadSafe>();
+#if AB_OSS_FAKE_BACKEND_ENABLED
+	bool bUseFakeBackend = false;
+	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bUseFakeBackend"), bUseFakeBackend, GEngineIni);
+	if (bUseFakeBackend)
+	{
+		const TSharedRef<FOnlineFakeBackendAccelByte, ESPMode::ThreadSafe> FakeBackend = MakeShared<FOnlineFakeBackendAccelByte, ESPMode::ThreadSafe>(this);
+		FString RecordingPath;
+		if (GConfig->GetString(TEXT("OnlineSubsystemAccelByte"), TEXT("FakeBackendRecordingPath"), RecordingPath, GEngineIni) && !RecordingPath.IsEmpty())
+		{
+			FakeBackend->LoadRecording(RecordingPath);
+		}
+
+		UE_LOG_AB(Warning, TEXT("Using the fake backend, requests moved over to the backend layer will not reach AccelByte services!"));
+		Backend = FakeBackend;
+	}
+#endif
+
+	// Create an async task manager and a thread for the manager to process tasks on, along with the metrics it reports to
+	AsyncTaskMetrics = MakeShared<FOnlineAsyncTaskMetricsAccelByte, ESPMode::ThreadSafe>();
 	AsyncTaskManager = MakeShared<FOnlineAsyncTaskManagerAccelByte, ESPMode::ThreadSafe>(this);
 	AsyncTaskManagerThread.Reset(FRunnableThread::Create(AsyncTaskManager.Get(), *FString::Printf(TEXT("OnlineAsyncTaskThread %s"), *InstanceName.ToString())));
 	check(AsyncTaskManagerThread.IsValid());
@@ -88,6 +120,12 @@ bool FOnlineSubsystemAccelByte::Shutdown()
 	{
 		AsyncTaskManager.Reset();
 	}
+	AsyncTaskMetrics.Reset();
+	{
+		FScopeLock ScopeLock(&BackendLock);
+		Backend.Reset();
+		RetiredBackends.Empty();
+	}
 
 #if WITH_DEV_AUTOMATION_TESTS
 	// Clear out any exec tests that we have added
@@ -104,6 +142,7 @@ bool FOnlineSubsystemAccelByte::Shutdown()
 	IdentityInterface.Reset();
 	SessionInterface.Reset();
 	UserCache.Reset();
+	UserIdRegistry.Reset();
 	AgreementInterface.Reset();
 	WalletInterface.Reset();
 	EntitlementsInterface.Reset();
@@ -178,6 +217,44 @@ FOnlineUserCacheAccelBytePtr FOnlineSubsystemAccelByte::GetUserCache() const
 	return UserCache;
 }
 
+FOnlineUserIdRegistryAccelBytePtr FOnlineSubsystemAccelByte::GetUserIdRegistry() const
+{
+	return UserIdRegistry;
+}
+
+FOnlineAsyncTaskManagerAccelBytePtr FOnlineSubsystemAccelByte::GetAsyncTaskManager() const
+{
+	return AsyncTaskManager;
+}
+
+FOnlineAsyncTaskMetricsAccelBytePtr FOnlineSubsystemAccelByte::GetAsyncTaskMetrics() const
+{
+	return AsyncTaskMetrics;
+}
+
+IOnlineBackendAccelBytePtr FOnlineSubsystemAccelByte::GetBackend() const
+{
+	FScopeLock ScopeLock(&BackendLock);
+	return Backend;
+}
+
+void FOnlineSubsystemAccelByte::SetBackend(const IOnlineBackendAccelBytePtr& InBackend)
+{
+	const IOnlineBackendAccelBytePtr NewBackend = InBackend.IsValid() ? InBackend : MakeShared<FOnlineBackendAccelByte, ESPMode::ThreadSafe>();
+
+	FScopeLock ScopeLock(&BackendLock);
+
+	// Keep ticking the backend we swap out until it has answered every request already sent to it, otherwise tasks waiting
+	// on those responses would hang until they time out
+	RetiredBackends.Remove(NewBackend);
+	if (Backend.IsValid() && Backend != NewBackend && Backend->HasPendingResponses())
+	{
+		RetiredBackends.Add(Backend);
+	}
+
+	Backend = NewBackend;
+}
+
 IOnlineEntitlementsPtr FOnlineSubsystemAccelByte::GetEntitlementsInterface() const
 {
 	return EntitlementsInterface;
@@ -234,8 +311,34 @@ bool FOnlineSubsystemAccelByte::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputD
 		{
 			bWasHandled = UserInterface->TestExec(InWorld, Cmd, Ar);
 		}
+		else if (FParse::Command(&Cmd, TEXT("BENCHMARK")))
+		{
+			bWasHandled = BenchmarkExec(InWorld, Cmd, Ar);
+		}
 #endif
 	}
+	else if (FParse::Command(&Cmd, TEXT("TASKSTATS")))
+	{
+		// Full command to dump async task metrics is ONLINE TASKSTATS, or ONLINE TASKSTATS RESET to clear them afterwards
+		if (AsyncTaskMetrics.IsValid())
+		{
+			AsyncTaskMetrics->Dump(Ar);
+			if (FParse::Command(&Cmd, TEXT("RESET")))
+			{
+				AsyncTaskMetrics->Reset();
+			}
+		}
+#if AB_OSS_ASYNC_TASK_POOL_ENABLED
+		FOnlineAsyncTaskPoolAccelByte::Get().Dump(Ar);
+#endif
+		bWasHandled = true;
+	}
+	else if (FParse::Command(&Cmd, TEXT("TRACEDUMP")))
+	{
+		// Full command to dump the most recent trace macro hits is ONLINE TRACEDUMP
+		FAccelByteTraceRingBuffer::Get().Dump(Ar);
+		bWasHandled = true;
+	}
 	
 	// If we didn't handle any exec tests, then just pass handling to the super method
 	if (!bWasHandled)
@@ -246,6 +349,79 @@ bool FOnlineSubsystemAccelByte::Exec(UWorld* InWorld, const TCHAR* Cmd, FOutputD
 	return bWasHandled;
 }
 
+#if WITH_DEV_AUTOMATION_TESTS
+bool FOnlineSubsystemAccelByte::BenchmarkExec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar)
+{
+	bool bWasHandled = false;
+
+	if (FParse::Command(&Cmd, TEXT("USERID")))
+	{
+		// Full command to benchmark user ID encoding is ONLINE TEST BENCHMARK USERID <Iterations>
+		const int32 Iterations = FCString::Atoi(*FParse::Token(Cmd, false));
+
+		TSharedPtr<FExecTestBenchmarkUserId> UserIdBenchmark = MakeShared<FExecTestBenchmarkUserId>(InWorld, ACCELBYTE_SUBSYSTEM, (Iterations > 0) ? Iterations : 10000);
+		UserIdBenchmark->Run();
+
+		AddExecTest(UserIdBenchmark);
+		bWasHandled = true;
+	}
+	else if (FParse::Command(&Cmd, TEXT("USERCACHE")))
+	{
+		// Full command to benchmark user cache contention is ONLINE TEST BENCHMARK USERCACHE <Threads> <OpsPerThread>
+		const int32 NumThreads = FCString::Atoi(*FParse::Token(Cmd, false));
+		const int32 OpsPerThread = FCString::Atoi(*FParse::Token(Cmd, false));
+
+		TSharedPtr<FExecTestBenchmarkUserCache> UserCacheBenchmark = MakeShared<FExecTestBenchmarkUserCache>(InWorld, ACCELBYTE_SUBSYSTEM, (NumThreads > 0) ? NumThreads : 8, (OpsPerThread > 0) ? OpsPerThread : 100000);
+		UserCacheBenchmark->Run();
+
+		AddExecTest(UserCacheBenchmark);
+		bWasHandled = true;
+	}
+	else if (FParse::Command(&Cmd, TEXT("PLATFORMKEY")))
+	{
+		// Full command to benchmark platform user lookups is ONLINE TEST BENCHMARK PLATFORMKEY <Iterations>
+		const int32 Iterations = FCString::Atoi(*FParse::Token(Cmd, false));
+
+		TSharedPtr<FExecTestBenchmarkPlatformUserKey> PlatformKeyBenchmark = MakeShared<FExecTestBenchmarkPlatformUserKey>(InWorld, ACCELBYTE_SUBSYSTEM, (Iterations > 0) ? Iterations : 100000);
+		PlatformKeyBenchmark->Run();
+
+		AddExecTest(PlatformKeyBenchmark);
+		bWasHandled = true;
+	}
+#if AB_USE_V2_SESSIONS
+	else if (FParse::Command(&Cmd, TEXT("SESSIONATTRIBUTES")))
+	{
+		// Full command to benchmark session attribute conversion is ONLINE TEST BENCHMARK SESSIONATTRIBUTES <Iterations> <Attributes>
+		const int32 Iterations = FCString::Atoi(*FParse::Token(Cmd, false));
+		const int32 NumAttributes = FCString::Atoi(*FParse::Token(Cmd, false));
+
+		TSharedPtr<FExecTestBenchmarkSessionAttributes> SessionAttributesBenchmark = MakeShared<FExecTestBenchmarkSessionAttributes>(InWorld, ACCELBYTE_SUBSYSTEM, (Iterations > 0) ? Iterations : 10000, (NumAttributes > 0) ? NumAttributes : 32);
+		SessionAttributesBenchmark->Run();
+
+		AddExecTest(SessionAttributesBenchmark);
+		bWasHandled = true;
+	}
+#endif
+#if AB_OSS_FAKE_BACKEND_ENABLED
+	else if (FParse::Command(&Cmd, TEXT("FAKEBACKEND")))
+	{
+		// Full command to benchmark task flows against the fake backend is ONLINE TEST BENCHMARK FAKEBACKEND <Users> <LatencyMs> <ErrorPercent>
+		const int32 NumUsers = FCString::Atoi(*FParse::Token(Cmd, false));
+		const FString LatencyMsToken = FParse::Token(Cmd, false);
+		const float ErrorPercent = FCString::Atof(*FParse::Token(Cmd, false));
+
+		TSharedPtr<FExecTestBenchmarkFakeBackend> FakeBackendBenchmark = MakeShared<FExecTestBenchmarkFakeBackend>(InWorld, ACCELBYTE_SUBSYSTEM, (NumUsers > 0) ? NumUsers : 2000, LatencyMsToken.IsEmpty() ? 100.0f : FCString::Atof(*LatencyMsToken), ErrorPercent);
+		FakeBackendBenchmark->Run();
+
+		AddExecTest(FakeBackendBenchmark);
+		bWasHandled = true;
+	}
+#endif
+
+	return bWasHandled;
+}
+#endif
+
 bool FOnlineSubsystemAccelByte::IsEnabled() const
 {
 	return FOnlineSubsystemImpl::IsEnabled();
@@ -257,6 +433,8 @@ bool FOnlineSubsystemAccelByte::Tick(float DeltaTime)
 	{
 		return false;
 	}
+
+	const double TickStartedInSeconds = FPlatformTime::Seconds();
 	
 	if (AsyncTaskManager)
 	{
@@ -268,8 +446,51 @@ bool FOnlineSubsystemAccelByte::Tick(float DeltaTime)
 		SessionInterface->Tick(DeltaTime);
 	}
 
-	// If we have automation testing enabled, check if we have any exec tests that are complete and if so, remove them
+	if (UserCache.IsValid())
+	{
+		UserCache->Tick(DeltaTime);
+	}
+
+	IOnlineBackendAccelBytePtr CurrentBackend;
+	TArray<IOnlineBackendAccelBytePtr> BackendsToDrain;
+	{
+		FScopeLock ScopeLock(&BackendLock);
+		CurrentBackend = Backend;
+		BackendsToDrain = RetiredBackends;
+	}
+
+	if (CurrentBackend.IsValid())
+	{
+		CurrentBackend->Tick(DeltaTime);
+	}
+
+	if (BackendsToDrain.Num() > 0)
+	{
+		for (const IOnlineBackendAccelBytePtr& RetiredBackend : BackendsToDrain)
+		{
+			RetiredBackend->Tick(DeltaTime);
+		}
+
+		FScopeLock ScopeLock(&BackendLock);
+		RetiredBackends.RemoveAll([](const IOnlineBackendAccelBytePtr& RetiredBackend) {
+			return !RetiredBackend->HasPendingResponses();
+		});
+	}
+
+	if (AsyncTaskMetrics.IsValid())
+	{
+		AsyncTaskMetrics->RecordGameThreadFrame(FPlatformTime::Seconds() - TickStartedInSeconds);
+	}
+
+	// If we have automation testing enabled, tick any exec tests still running, then remove those that are complete
 #if WITH_DEV_AUTOMATION_TESTS
+	for (const TSharedPtr<FExecTestBase>& ExecTest : ActiveExecTests)
+	{
+		if (!ExecTest->bIsComplete)
+		{
+			ExecTest->Tick(DeltaTime);
+		}
+	}
 	ActiveExecTests.RemoveAll([](const TSharedPtr<FExecTestBase>& ExecTest) { return ExecTest->bIsComplete; });
 #endif
 
@@ -439,6 +660,8 @@ void FOnlineSubsystemAccelByte::OnLoginCallback(int32 LocalUserNum, bool bWasSuc
 
 void FOnlineSubsystemAccelByte::OnMessageNotif(const FAccelByteModelsNotificationMessage& InMessage, int32 LocalUserNum)
 {
+	AB_OSS_TRACE_FUNCTION_SCOPE();
+
 	UE_LOG_AB(Verbose, TEXT("Got freeform notification from backend at %s!\nTopic: %s\nPayload: %s"), *InMessage.SentAt.ToString(), *InMessage.Topic, *InMessage.Payload);
 }
 
@@ -1,9 +1,16 @@
 /**
  * Header to be used internally by the AccelByte OSS housing macros and other such definitions helpful to the
  * development of the OSS. This header also houses the definitions for the trace logging macros used in each interface.
+ *
+ * Trace macros only evaluate their arguments when the verbosity is active for our log category, so they are safe to pass
+ * expensive arguments such as ToDebugString. Every trace is also recorded to the trace ring buffer along with its
+ * arithmetic and enum arguments, which are the only arguments evaluated while logging is off, see
+ * FAccelByteTraceRingBuffer.
  */
 #pragma once
 
+#include "OnlineSubsystemAccelByteTrace.h"
+
 /**
  * Quick macro to be used in UE_LOG to output a boolean condition as a string for "true" or "false"
  * 
@@ -11,6 +18,16 @@
  */
 #define LOG_BOOL_FORMAT(Condition) ((Condition) ? TEXT("true") : TEXT("false"))
 
+/**
+ * Log to LogAccelByteOSS only if the verbosity is active for the category, making sure that no arguments are evaluated
+ * otherwise. Used by the trace macros below.
+ *
+ * @param Verbosity Log verbosity, corresponds to the verbosity for UE_LOG
+ * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
+ * @param Args Corresponds to the types set in Format, just like in UE_LOG
+ */
+#define AB_OSS_LOG_IF_ACTIVE(Verbosity, Format, ...) if (UE_LOG_ACTIVE(LogAccelByteOSS, Verbosity)) { UE_LOG_AB(Verbosity, Format, ##__VA_ARGS__); }
+
 /**
   * Simple macro for logging a trace for when an interface method begins. Should only be called on interfaces with the parent
   * subsystem as a member named 'AccelByteSubsystem'.
@@ -19,7 +36,10 @@
   * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
   * @param Args Corresponds to the types set in Format, just like in UE_LOG
   */
-#define AB_OSS_INTERFACE_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
+#define AB_OSS_INTERFACE_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) do { \
+	AB_OSS_TRACE_BUFFER_RECORD(Begin, Format, ##__VA_ARGS__); \
+	AB_OSS_LOG_IF_ACTIVE(Verbosity, TEXT(">>> %s (%s) was called. Args: ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__) \
+} while (0)
 
 /**
  * Simple macro for logging a trace for when an interface method begins. Should only be called on interfaces with the parent
@@ -39,7 +59,10 @@
  * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
  * @param Args Corresponds to the types set in Format, just like in UE_LOG
  */
-#define AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__)
+#define AB_OSS_INTERFACE_TRACE_END_VERBOSITY(Verbosity, Format, ...) do { \
+	AB_OSS_TRACE_BUFFER_RECORD(End, Format, ##__VA_ARGS__); \
+	AB_OSS_LOG_IF_ACTIVE(Verbosity, TEXT("<<< %s (%s) has finished execution. ") Format, *FString(__func__), *AccelByteSubsystem->GetInstanceName().ToString(), ##__VA_ARGS__) \
+} while (0)
 
 /**
  * Macro for logging a trace when an interface method has finished execution. Same as AB_OSS_INTERFACE_TRACE_END_VERBOSITY, except this will
@@ -58,7 +81,10 @@
   * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
   * @param Args Corresponds to the types set in Format, just like in UE_LOG
   */
-#define AB_OSS_GENERIC_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT(">>> %s was called. Args: ") Format, *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_GENERIC_TRACE_BEGIN_VERBOSITY(Verbosity, Format, ...) do { \
+	AB_OSS_TRACE_BUFFER_RECORD(Begin, Format, ##__VA_ARGS__); \
+	AB_OSS_LOG_IF_ACTIVE(Verbosity, TEXT(">>> %s was called. Args: ") Format, *FString(__func__), ##__VA_ARGS__) \
+} while (0)
 
 /**
  * Simple macro for logging a trace for when an method begins in a class that doesn't have a subsystem instance attached.
@@ -77,7 +103,10 @@
  * @param Format Same as a format string passed into UE_LOG, and as such must be wrapped with a TEXT macro.
  * @param Args Corresponds to the types set in Format, just like in UE_LOG
  */
-#define AB_OSS_GENERIC_TRACE_END_VERBOSITY(Verbosity, Format, ...) UE_LOG_AB(Verbosity, TEXT("<<< %s has finished execution. ") Format, *FString(__func__), ##__VA_ARGS__)
+#define AB_OSS_GENERIC_TRACE_END_VERBOSITY(Verbosity, Format, ...) do { \
+	AB_OSS_TRACE_BUFFER_RECORD(End, Format, ##__VA_ARGS__); \
+	AB_OSS_LOG_IF_ACTIVE(Verbosity, TEXT("<<< %s has finished execution. ") Format, *FString(__func__), ##__VA_ARGS__) \
+} while (0)
 
 /**
  * Macro for logging a trace when a method has finished execution in a class without a subsystem instance attached.
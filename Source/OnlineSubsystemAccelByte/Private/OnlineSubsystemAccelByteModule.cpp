@@ -8,6 +8,8 @@
 #include "OnlineSubsystemAccelByteDefines.h"
 #include "Modules/ModuleManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/CoreDelegates.h"
+#include "OnlineSubsystemAccelByteTrace.h"
 
 DEFINE_LOG_CATEGORY(LogAccelByteOSS);
 DEFINE_LOG_CATEGORY(LogAccelByteOSSParty);
@@ -61,12 +63,26 @@ void FOnlineSubsystemAccelByteModule::StartupModule()
 	AccelByteFactory = MakeUnique<FOnlineFactoryAccelByte>();
 	FOnlineSubsystemModule& OSS = FModuleManager::GetModuleChecked<FOnlineSubsystemModule>("OnlineSubsystem");
 	OSS.RegisterPlatformService(ACCELBYTE_SUBSYSTEM, AccelByteFactory.Get());
+
+#if AB_OSS_TRACE_BUFFER_ENABLED
+	// Leave a trail of recent OSS calls in the log for post-mortems, even when verbose logging was off
+	OnHandleSystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddLambda([]()
+	{
+		if (GLog != nullptr)
+		{
+			FAccelByteTraceRingBuffer::Get().Dump(*GLog);
+		}
+	});
+#endif
 }
 
 void FOnlineSubsystemAccelByteModule::ShutdownModule()
 {
 	UE_LOG_AB(Log, TEXT("Shutting down OnlineSubsystemAccelByte module!"));
 
+	FCoreDelegates::OnHandleSystemError.Remove(OnHandleSystemErrorHandle);
+	OnHandleSystemErrorHandle.Reset();
+
 	// Unregister our subsystem factory from the OnlineSubsystem module and reset our instance
 	FOnlineSubsystemModule& OSS = FModuleManager::GetModuleChecked<FOnlineSubsystemModule>("OnlineSubsystem");
 	OSS.UnregisterPlatformService(ACCELBYTE_SUBSYSTEM);
@@ -0,0 +1,129 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineSubsystemAccelByteTrace.h"
+#include "Misc/OutputDevice.h"
+
+#if AB_OSS_TRACE_CHANNEL_ENABLED
+UE_TRACE_CHANNEL_DEFINE(AccelByteOSSChannel);
+#endif
+
+FAccelByteTraceRingBuffer& FAccelByteTraceRingBuffer::Get()
+{
+	static FAccelByteTraceRingBuffer Instance;
+	return Instance;
+}
+
+void FAccelByteTraceRingBuffer::Dump(FOutputDevice& Ar) const
+{
+	const uint64 EndIndex = NextIndex.load(std::memory_order_acquire);
+	const uint64 StartIndex = (EndIndex > Capacity) ? EndIndex - Capacity : 0;
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+
+	Ar.Logf(TEXT("AccelByte OSS trace buffer, %llu most recent of %llu entries:"), EndIndex - StartIndex, EndIndex);
+	for (uint64 Index = StartIndex; Index < EndIndex; Index++)
+	{
+		const FEntry& Entry = Entries[Index & (Capacity - 1)];
+
+		// Read the fields between two loads of the sequence, and skip the entry if it was rewritten in the meantime
+		const uint64 Sequence = Entry.Sequence.load(std::memory_order_acquire);
+		if (Sequence != Index + 1)
+		{
+			continue;
+		}
+
+		const uint64 Cycles = Entry.Cycles.load(std::memory_order_relaxed);
+		const ANSICHAR* Function = Entry.Function.load(std::memory_order_relaxed);
+		const TCHAR* Format = Entry.Format.load(std::memory_order_relaxed);
+		const uint32 ThreadId = Entry.ThreadId.load(std::memory_order_relaxed);
+		const EAccelByteTraceEntryType Type = static_cast<EAccelByteTraceEntryType>(Entry.Type.load(std::memory_order_relaxed));
+		const uint32 ArgKinds = Entry.ArgKinds.load(std::memory_order_relaxed);
+		uint64 ArgValues[FAccelByteTraceArgs::MaxArgs];
+		for (int32 ArgIndex = 0; ArgIndex < FAccelByteTraceArgs::MaxArgs; ArgIndex++)
+		{
+			ArgValues[ArgIndex] = Entry.ArgValues[ArgIndex].load(std::memory_order_relaxed);
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Entry.Sequence.load(std::memory_order_relaxed) != Sequence)
+		{
+			continue;
+		}
+
+		const double SecondsAgo = (NowCycles >= Cycles) ? FPlatformTime::ToSeconds64(NowCycles - Cycles) : 0.0;
+		Ar.Logf(TEXT("[-%.6fs] [thread %u] %s %s %s"),
+			SecondsAgo,
+			ThreadId,
+			(Type == EAccelByteTraceEntryType::Begin) ? TEXT(">>>") : TEXT("<<<"),
+			(Function != nullptr) ? ANSI_TO_TCHAR(Function) : TEXT(""),
+			*FormatEntry(Format, ArgKinds, ArgValues));
+	}
+}
+
+FString FAccelByteTraceRingBuffer::FormatEntry(const TCHAR* Format, uint32 ArgKinds, const uint64* ArgValues)
+{
+	FString Message;
+	if (Format == nullptr)
+	{
+		return Message;
+	}
+
+	int32 ArgIndex = 0;
+	for (const TCHAR* Char = Format; *Char != TEXT('\0'); Char++)
+	{
+		if (*Char != TEXT('%'))
+		{
+			Message.AppendChar(*Char);
+			continue;
+		}
+
+		if (Char[1] == TEXT('%'))
+		{
+			Message.AppendChar(TEXT('%'));
+			Char++;
+			continue;
+		}
+
+		// Skip flags, width, precision and length up to the conversion character, which is all we format by
+		const TCHAR* Conversion = Char + 1;
+		while (*Conversion != TEXT('\0') && FCString::Strchr(TEXT("-+ #0123456789.hljztL"), *Conversion) != nullptr)
+		{
+			Conversion++;
+		}
+		if (*Conversion == TEXT('\0'))
+		{
+			break;
+		}
+
+		const EAccelByteTraceArgKind Kind = (ArgIndex < FAccelByteTraceArgs::MaxArgs)
+			? static_cast<EAccelByteTraceArgKind>((ArgKinds >> (ArgIndex * 4)) & 0xF)
+			: EAccelByteTraceArgKind::None;
+		const uint64 Value = (Kind != EAccelByteTraceArgKind::None) ? ArgValues[ArgIndex] : 0;
+		const bool bIsHex = *Conversion == TEXT('x') || *Conversion == TEXT('X');
+		switch (Kind)
+		{
+		case EAccelByteTraceArgKind::Int:
+			Message += bIsHex ? FString::Printf(TEXT("%llx"), Value) : FString::Printf(TEXT("%lld"), static_cast<int64>(Value));
+			break;
+		case EAccelByteTraceArgKind::UInt:
+			Message += bIsHex ? FString::Printf(TEXT("%llx"), Value) : FString::Printf(TEXT("%llu"), Value);
+			break;
+		case EAccelByteTraceArgKind::Double:
+		{
+			double DoubleValue;
+			FMemory::Memcpy(&DoubleValue, &Value, sizeof(DoubleValue));
+			Message += FString::SanitizeFloat(DoubleValue);
+			break;
+		}
+		default:
+			// Arguments that were not captured, such as strings
+			Message.AppendChar(TEXT('?'));
+			break;
+		}
+
+		ArgIndex++;
+		Char = Conversion;
+	}
+
+	return Message;
+}
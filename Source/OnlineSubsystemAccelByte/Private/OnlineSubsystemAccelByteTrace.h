@@ -0,0 +1,351 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+/**
+ * Tracing for the AccelByte OSS, made up of an Unreal Insights trace channel and a ring buffer of recent trace macro hits.
+ *
+ * The Insights channel emits CPU timing scopes for async task phases, SDK responses and lobby notification handlers, so
+ * that OSS work shows up on the Insights timeline next to frame data.
+ *
+ * Compiled in when AB_OSS_TRACE_ENABLED is set, which the build rules do for every configuration other than Shipping
+ * unless `bEnableInsightsTrace` in the `OnlineSubsystemAccelByte` settings says otherwise. Even when compiled in, no
+ * events are emitted until the channel is turned on, either with `-trace=cpu,AccelByteOSS` on the command line or
+ * with `Trace.Enable AccelByteOSS` at runtime.
+ */
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include <atomic>
+#include <type_traits>
+
+#ifndef AB_OSS_TRACE_ENABLED
+#define AB_OSS_TRACE_ENABLED 0
+#endif
+
+// Dynamic event names are only supported by the CPU profiler trace from 4.26 onwards
+#if AB_OSS_TRACE_ENABLED && (ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26)
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+#if AB_OSS_TRACE_ENABLED && (ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26) && UE_TRACE_ENABLED && CPUPROFILERTRACE_ENABLED
+#define AB_OSS_TRACE_CHANNEL_ENABLED 1
+#else
+#define AB_OSS_TRACE_CHANNEL_ENABLED 0
+#endif
+
+#if AB_OSS_TRACE_CHANNEL_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(AccelByteOSSChannel);
+
+/**
+ * Scoped timing event with a name only known at runtime. Pass a null name to skip the event entirely.
+ */
+class FAccelByteTraceDynamicScope
+{
+public:
+	explicit FAccelByteTraceDynamicScope(const TCHAR* EventName)
+		: bIsActive(EventName != nullptr)
+	{
+		if (bIsActive)
+		{
+			FCpuProfilerTrace::OutputBeginDynamicEvent(EventName);
+		}
+	}
+
+	~FAccelByteTraceDynamicScope()
+	{
+		if (bIsActive)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+	}
+
+private:
+	bool bIsActive;
+};
+
+/**
+ * Whether the AccelByte OSS trace channel is currently on. Use to skip building anything only needed for trace events.
+ */
+#define AB_OSS_TRACE_IS_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(AccelByteOSSChannel)
+
+/**
+ * Scoped timing event with a static name, which must be a string literal or otherwise live as long as the program.
+ *
+ * @param NameStr Name of the event as shown in Insights
+ */
+#define AB_OSS_TRACE_SCOPE(NameStr) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(NameStr, AccelByteOSSChannel)
+
+/**
+ * Scoped timing event named after the enclosing function.
+ */
+#define AB_OSS_TRACE_FUNCTION_SCOPE() AB_OSS_TRACE_SCOPE(__FUNCTION__)
+
+/**
+ * Scoped timing event with a name built at runtime. The name expression is only evaluated while the channel is on.
+ *
+ * @param NameExpr Expression convertible to FString that gives the name of the event as shown in Insights
+ */
+#define AB_OSS_TRACE_DYNAMIC_SCOPE(NameExpr) FAccelByteTraceDynamicScope PREPROCESSOR_JOIN(AccelByteTraceScope, __LINE__)(AB_OSS_TRACE_IS_ENABLED() ? *FString(NameExpr) : nullptr)
+
+#else
+
+#define AB_OSS_TRACE_IS_ENABLED() false
+#define AB_OSS_TRACE_SCOPE(NameStr)
+#define AB_OSS_TRACE_FUNCTION_SCOPE()
+#define AB_OSS_TRACE_DYNAMIC_SCOPE(NameExpr)
+
+#endif
+
+#ifndef AB_OSS_TRACE_BUFFER_ENABLED
+#define AB_OSS_TRACE_BUFFER_ENABLED 1
+#endif
+
+/**
+ * Kind of trace macro that recorded an entry in the trace ring buffer
+ */
+enum class EAccelByteTraceEntryType : uint8
+{
+	Begin = 0,
+	End
+};
+
+/**
+ * Kind of value held in an argument slot of a trace ring buffer entry
+ */
+enum class EAccelByteTraceArgKind : uint8
+{
+	/** Slot unused, or the argument was not captured */
+	None = 0,
+	Int,
+	UInt,
+	Double
+};
+
+/**
+ * Arguments of a single trace, copied into a fixed number of 64 bit slots. Only arithmetic and enum arguments are kept,
+ * any argument past the last slot is dropped.
+ */
+struct FAccelByteTraceArgs
+{
+	/** Number of argument slots in each entry */
+	static constexpr int32 MaxArgs = 6;
+
+	/** Kind of each slot, four bits per slot starting from the lowest bits */
+	uint32 Kinds = 0;
+	uint64 Values[MaxArgs];
+	int32 Num = 0;
+
+	template<typename T>
+	typename std::enable_if<std::is_floating_point<T>::value>::type Add(T Value)
+	{
+		const double DoubleValue = static_cast<double>(Value);
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &DoubleValue, sizeof(Bits));
+		AddSlot(EAccelByteTraceArgKind::Double, Bits);
+	}
+
+	template<typename T>
+	typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type Add(T Value)
+	{
+		AddSlot(EAccelByteTraceArgKind::Int, static_cast<uint64>(static_cast<int64>(Value)));
+	}
+
+	template<typename T>
+	typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type Add(T Value)
+	{
+		AddSlot(EAccelByteTraceArgKind::UInt, static_cast<uint64>(Value));
+	}
+
+	template<typename T>
+	typename std::enable_if<std::is_enum<T>::value>::type Add(T Value)
+	{
+		AddSlot(EAccelByteTraceArgKind::Int, static_cast<uint64>(static_cast<int64>(Value)));
+	}
+
+	/**
+	 * Take up a slot without a value, for an argument that was not captured
+	 */
+	void Skip()
+	{
+		AddSlot(EAccelByteTraceArgKind::None, 0);
+	}
+
+private:
+	void AddSlot(EAccelByteTraceArgKind Kind, uint64 Value)
+	{
+		if (Num >= MaxArgs)
+		{
+			return;
+		}
+
+		Kinds |= static_cast<uint32>(Kind) << (Num * 4);
+		Values[Num] = Value;
+		Num++;
+	}
+};
+
+/**
+ * Trace argument waiting to be captured into the ring buffer, made by AB_OSS_TRACE_CAPTURE_ARG. The argument expression
+ * is only evaluated if its type is arithmetic or an enum. Anything else, such as the strings built by ToDebugString, is
+ * left unevaluated so that traces stay cheap while logging is off, and shows up as '?' when the buffer is dumped.
+ *
+ * @tparam ExprType Type of the argument expression, as given by decltype
+ * @tparam GetterType Lambda that evaluates the argument expression
+ */
+template<typename ExprType, typename GetterType>
+struct TAccelByteTraceArg
+{
+	using ValueType = typename std::decay<ExprType>::type;
+
+	GetterType Getter;
+
+	template<typename T = ValueType>
+	typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type CaptureTo(FAccelByteTraceArgs& Args) const
+	{
+		Args.Add(static_cast<T>(Getter()));
+	}
+
+	template<typename T = ValueType>
+	typename std::enable_if<!(std::is_arithmetic<T>::value || std::is_enum<T>::value)>::type CaptureTo(FAccelByteTraceArgs& Args) const
+	{
+		Args.Skip();
+	}
+};
+
+template<typename ExprType, typename GetterType>
+TAccelByteTraceArg<ExprType, GetterType> MakeAccelByteTraceArg(GetterType Getter)
+{
+	return TAccelByteTraceArg<ExprType, GetterType>{Getter};
+}
+
+/**
+ * Fixed size ring buffer holding the most recent trace macro hits across every thread, kept so that builds running
+ * without verbose logging, such as shipping servers, still have a trail to look at after something goes wrong.
+ *
+ * Recording is lock-free and never formats anything. Each entry holds a timestamp, the thread, pointers to the function
+ * name and format string of the trace, which are static strings, and a copy of the trace's arithmetic and enum arguments
+ * (see TAccelByteTraceArg). Entries are formatted when dumped, either through the `ONLINE TRACEDUMP` console command or
+ * automatically on a system error.
+ *
+ * Compiled out by setting AB_OSS_TRACE_BUFFER_ENABLED to 0.
+ */
+class FAccelByteTraceRingBuffer
+{
+public:
+	/**
+	 * Get the buffer shared by every subsystem instance in the process
+	 */
+	static FAccelByteTraceRingBuffer& Get();
+
+	/**
+	 * Record a trace macro hit, overwriting the oldest entry once the buffer is full. Safe to call from any thread.
+	 *
+	 * @param Type Kind of trace macro being recorded
+	 * @param Function Name of the function the trace is in, must be a static string such as __func__
+	 * @param Format Format string passed to the trace macro, must be a static string
+	 * @param TraceArgs Arguments of the trace, made with AB_OSS_TRACE_CAPTURE_ARG
+	 */
+	template<typename... TraceArgTypes>
+	void Record(EAccelByteTraceEntryType Type, const ANSICHAR* Function, const TCHAR* Format, const TraceArgTypes&... TraceArgs)
+	{
+		FAccelByteTraceArgs Args;
+		const int32 Unused[] = { 0, (TraceArgs.CaptureTo(Args), 0)... };
+		(void)Unused;
+
+		const uint64 Index = NextIndex.fetch_add(1, std::memory_order_relaxed);
+		FEntry& Entry = Entries[Index & (Capacity - 1)];
+
+		// Zero the sequence while writing, so that a dump running at the same time skips this entry rather than
+		// reading a mix of old and new fields
+		Entry.Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Entry.Cycles.store(FPlatformTime::Cycles64(), std::memory_order_relaxed);
+		Entry.Function.store(Function, std::memory_order_relaxed);
+		Entry.Format.store(Format, std::memory_order_relaxed);
+		Entry.ThreadId.store(FPlatformTLS::GetCurrentThreadId(), std::memory_order_relaxed);
+		Entry.Type.store(static_cast<uint8>(Type), std::memory_order_relaxed);
+		Entry.ArgKinds.store(Args.Kinds, std::memory_order_relaxed);
+		for (int32 ArgIndex = 0; ArgIndex < Args.Num; ArgIndex++)
+		{
+			Entry.ArgValues[ArgIndex].store(Args.Values[ArgIndex], std::memory_order_relaxed);
+		}
+		Entry.Sequence.store(Index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * Format every entry still in the buffer, oldest first, to the output device passed in. Safe to call from any thread.
+	 */
+	void Dump(FOutputDevice& Ar) const;
+
+private:
+	/** Number of entries kept, must be a power of two */
+	static constexpr uint64 Capacity = 4096;
+
+	/** Single trace macro hit, with every field atomic so that dumps can race with writers safely */
+	struct FEntry
+	{
+		/** Index of the entry plus one once fully written, zero while being written */
+		std::atomic<uint64> Sequence{0};
+		std::atomic<uint64> Cycles{0};
+		std::atomic<const ANSICHAR*> Function{nullptr};
+		std::atomic<const TCHAR*> Format{nullptr};
+		std::atomic<uint32> ThreadId{0};
+		std::atomic<uint8> Type{0};
+
+		/** Kinds of the argument slots, as in FAccelByteTraceArgs. Values past the last used slot are left stale. */
+		std::atomic<uint32> ArgKinds{0};
+		std::atomic<uint64> ArgValues[FAccelByteTraceArgs::MaxArgs] = {};
+	};
+
+	/**
+	 * Build the message of an entry, substituting its captured arguments into the format string
+	 */
+	static FString FormatEntry(const TCHAR* Format, uint32 ArgKinds, const uint64* ArgValues);
+
+	FEntry Entries[Capacity];
+
+	/** Index that the next entry will be written to, before wrapping */
+	std::atomic<uint64> NextIndex{0};
+};
+
+#if AB_OSS_TRACE_BUFFER_ENABLED
+/**
+ * Wrap a single trace argument for the ring buffer, see TAccelByteTraceArg. The expression is not evaluated here.
+ */
+#define AB_OSS_TRACE_CAPTURE_ARG(Arg) MakeAccelByteTraceArg<decltype((Arg))>([&]() { return (Arg); })
+
+// Wrap each of up to eight trace arguments with AB_OSS_TRACE_CAPTURE_ARG, each preceded by a comma. The extra expansion
+// makes MSVC's traditional preprocessor split __VA_ARGS__ into separate arguments.
+#define AB_OSS_TRACE_EXPAND(X) X
+#define AB_OSS_TRACE_CAPTURE_ARGS_0()
+#define AB_OSS_TRACE_CAPTURE_ARGS_1(A) , AB_OSS_TRACE_CAPTURE_ARG(A)
+#define AB_OSS_TRACE_CAPTURE_ARGS_2(A, ...) , AB_OSS_TRACE_CAPTURE_ARG(A) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_1(__VA_ARGS__))
+#define AB_OSS_TRACE_CAPTURE_ARGS_3(A, ...) , AB_OSS_TRACE_CAPTURE_ARG(A) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_2(__VA_ARGS__))
+#define AB_OSS_TRACE_CAPTURE_ARGS_4(A, ...) , AB_OSS_TRACE_CAPTURE_ARG(A) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_3(__VA_ARGS__))
+#define AB_OSS_TRACE_CAPTURE_ARGS_5(A, ...) , AB_OSS_TRACE_CAPTURE_ARG(A) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_4(__VA_ARGS__))
+#define AB_OSS_TRACE_CAPTURE_ARGS_6(A, ...) , AB_OSS_TRACE_CAPTURE_ARG(A) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_5(__VA_ARGS__))
+#define AB_OSS_TRACE_CAPTURE_ARGS_7(A, ...) , AB_OSS_TRACE_CAPTURE_ARG(A) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_6(__VA_ARGS__))
+#define AB_OSS_TRACE_CAPTURE_ARGS_8(A, ...) , AB_OSS_TRACE_CAPTURE_ARG(A) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_7(__VA_ARGS__))
+#define AB_OSS_TRACE_CAPTURE_ARGS_SELECT(_0, _1, _2, _3, _4, _5, _6, _7, _8, Name, ...) Name
+#define AB_OSS_TRACE_CAPTURE_ARGS(...) AB_OSS_TRACE_EXPAND(AB_OSS_TRACE_CAPTURE_ARGS_SELECT(_, ##__VA_ARGS__, \
+	AB_OSS_TRACE_CAPTURE_ARGS_8, AB_OSS_TRACE_CAPTURE_ARGS_7, AB_OSS_TRACE_CAPTURE_ARGS_6, AB_OSS_TRACE_CAPTURE_ARGS_5, \
+	AB_OSS_TRACE_CAPTURE_ARGS_4, AB_OSS_TRACE_CAPTURE_ARGS_3, AB_OSS_TRACE_CAPTURE_ARGS_2, AB_OSS_TRACE_CAPTURE_ARGS_1, \
+	AB_OSS_TRACE_CAPTURE_ARGS_0)(__VA_ARGS__))
+
+/**
+ * Record a trace macro hit in the trace ring buffer.
+ *
+ * @param Type EAccelByteTraceEntryType value without the enum prefix
+ * @param Format Format string of the trace, must be a string literal
+ * @param Args Arguments of the trace, up to eight. Only arithmetic and enum arguments are evaluated.
+ */
+#define AB_OSS_TRACE_BUFFER_RECORD(Type, Format, ...) FAccelByteTraceRingBuffer::Get().Record(EAccelByteTraceEntryType::Type, __func__, Format AB_OSS_TRACE_CAPTURE_ARGS(__VA_ARGS__))
+#else
+#define AB_OSS_TRACE_BUFFER_RECORD(Type, Format, ...)
+#endif
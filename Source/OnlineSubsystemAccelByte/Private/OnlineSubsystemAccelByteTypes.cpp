@@ -14,28 +14,191 @@
 
 bool IsAccelByteIDValid(const FString& AccelByteId)
 {
-	// First check if our length is not equal to our typical ID length, if this is the case then we know that this is
-	// already an invalid ID
-	// Replace the - with empty. The session ID from Session Browser still using vanilla UUID
-	const FString FinalAccelByteId = AccelByteId.Replace(TEXT("-"), TEXT(""));
-	if (FinalAccelByteId.Len() != ACCELBYTE_ID_LENGTH)
+	// Walk the characters of the ID once, skipping any hyphens as the session ID from Session Browser still uses a
+	// vanilla UUID. Every other character must be a hex character, and we must end up with exactly our typical ID length.
+	// This is done in place rather than by stripping hyphens into a new string, as this is called for every ID we create.
+	int32 HexCharacterCount = 0;
+	for (int32 Index = 0; Index < AccelByteId.Len(); Index++)
 	{
-		return false;
+		const TCHAR Character = AccelByteId[Index];
+		if (Character == TEXT('-'))
+		{
+			continue;
+		}
+
+		if (!CheckTCharIsHex(Character) || ++HexCharacterCount > ACCELBYTE_ID_LENGTH)
+		{
+			return false;
+		}
 	}
 
-	// Iterate through the character array to make sure that the ID is a valid UUID hex string. Subtract one from the
-	// length of the array so that we don't include the null terminator that the array has.
-	TArray<TCHAR> CharArray = FinalAccelByteId.GetCharArray();
-	for (int64 Index = 0; Index < CharArray.Num() - 1; Index++)
+	return HexCharacterCount == ACCELBYTE_ID_LENGTH;
+}
+
+namespace
+{
+	/** Flag in the binary composite header denoting that the AccelByte ID is packed as raw bytes rather than a string */
+	constexpr uint8 COMPOSITE_FLAG_PACKED_ACCELBYTE_ID = 1 << 0;
+
+	/** Number of bytes that a packed AccelByte ID takes up in the binary composite */
+	constexpr int32 PACKED_ACCELBYTE_ID_SIZE = ACCELBYTE_ID_LENGTH / 2;
+
+	/** Maximum size in bytes of a single string field in the binary composite, as lengths are stored as a uint16 */
+	constexpr int32 MAX_COMPOSITE_STRING_SIZE = MAX_uint16;
+
+	/** Lookup table for converting a nibble back to its lowercase hex character */
+	const TCHAR HexCharacters[] = TEXT("0123456789abcdef");
+
+	/**
+	 * Convert a lowercase hex character to its nibble value, or INDEX_NONE if the character is not a lowercase hex character.
+	 * Uppercase characters are intentionally rejected so that packing an ID never changes its string representation.
+	 */
+	int32 LowercaseHexCharToNibble(const TCHAR Character)
 	{
-		const TCHAR& Character = CharArray[Index];
-		if (!CheckTCharIsHex(Character))
+		if (Character >= TEXT('0') && Character <= TEXT('9'))
+		{
+			return Character - TEXT('0');
+		}
+
+		if (Character >= TEXT('a') && Character <= TEXT('f'))
+		{
+			return Character - TEXT('a') + 10;
+		}
+
+		return INDEX_NONE;
+	}
+
+	/**
+	 * Attempt to pack an AccelByte ID into raw bytes. Only succeeds for IDs that are exactly ACCELBYTE_ID_LENGTH lowercase
+	 * hex characters, which is what the backend hands out for user IDs.
+	 */
+	bool TryPackAccelByteId(const FString& AccelByteId, TArray<uint8>& Buffer)
+	{
+		if (AccelByteId.Len() != ACCELBYTE_ID_LENGTH)
 		{
 			return false;
 		}
+
+		uint8 PackedId[PACKED_ACCELBYTE_ID_SIZE];
+		for (int32 Index = 0; Index < PACKED_ACCELBYTE_ID_SIZE; Index++)
+		{
+			const int32 HighNibble = LowercaseHexCharToNibble(AccelByteId[Index * 2]);
+			const int32 LowNibble = LowercaseHexCharToNibble(AccelByteId[Index * 2 + 1]);
+			if (HighNibble == INDEX_NONE || LowNibble == INDEX_NONE)
+			{
+				return false;
+			}
+
+			PackedId[Index] = static_cast<uint8>((HighNibble << 4) | LowNibble);
+		}
+
+		Buffer.Append(PackedId, PACKED_ACCELBYTE_ID_SIZE);
+		return true;
 	}
 
-	return true;
+	/**
+	 * Unpack an AccelByte ID from raw bytes back into its lowercase hex string representation.
+	 */
+	bool UnpackAccelByteId(const TArray<uint8>& Buffer, int32& Offset, FString& OutAccelByteId)
+	{
+		if (Offset + PACKED_ACCELBYTE_ID_SIZE > Buffer.Num())
+		{
+			return false;
+		}
+
+		OutAccelByteId.Empty(ACCELBYTE_ID_LENGTH);
+		for (int32 Index = 0; Index < PACKED_ACCELBYTE_ID_SIZE; Index++)
+		{
+			const uint8 Byte = Buffer[Offset + Index];
+			OutAccelByteId.AppendChar(HexCharacters[Byte >> 4]);
+			OutAccelByteId.AppendChar(HexCharacters[Byte & 0x0F]);
+		}
+
+		Offset += PACKED_ACCELBYTE_ID_SIZE;
+		return true;
+	}
+
+	/**
+	 * Write a string to the buffer as UTF-8, prefixed by its length in bytes as a little endian uint16.
+	 */
+	bool WriteCompositeString(const FString& Value, TArray<uint8>& Buffer)
+	{
+		const FTCHARToUTF8 Converter(*Value, Value.Len());
+		const int32 Length = Converter.Length();
+		if (Length > MAX_COMPOSITE_STRING_SIZE)
+		{
+			return false;
+		}
+
+		Buffer.Add(static_cast<uint8>(Length & 0xFF));
+		Buffer.Add(static_cast<uint8>((Length >> 8) & 0xFF));
+		Buffer.Append(reinterpret_cast<const uint8*>(Converter.Get()), Length);
+		return true;
+	}
+
+	/**
+	 * Read a length prefixed UTF-8 string from the buffer, advancing the offset past the string.
+	 */
+	bool ReadCompositeString(const TArray<uint8>& Buffer, int32& Offset, FString& OutValue)
+	{
+		if (Offset + 2 > Buffer.Num())
+		{
+			return false;
+		}
+
+		const int32 Length = Buffer[Offset] | (Buffer[Offset + 1] << 8);
+		Offset += 2;
+		if (Offset + Length > Buffer.Num())
+		{
+			return false;
+		}
+
+		if (Length == 0)
+		{
+			OutValue.Empty();
+			return true;
+		}
+
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + Offset), Length);
+		OutValue = FString(Converter.Length(), Converter.Get());
+		Offset += Length;
+		return true;
+	}
+
+	/**
+	 * Decode the binary composite format from a buffer that has already been decoded from Base64.
+	 */
+	bool DecodeBinaryComposite(const TArray<uint8>& Buffer, FAccelByteUniqueIdComposite& OutCompositeId)
+	{
+		// Header is made up of the version byte and the flags byte
+		if (Buffer.Num() < 2 || Buffer[0] != ACCELBYTE_USER_ID_ENCODING_VERSION)
+		{
+			return false;
+		}
+
+		const uint8 CompositeFlags = Buffer[1];
+		int32 Offset = 2;
+
+		const bool bDecodedId = (CompositeFlags & COMPOSITE_FLAG_PACKED_ACCELBYTE_ID)
+			? UnpackAccelByteId(Buffer, Offset, OutCompositeId.Id)
+			: ReadCompositeString(Buffer, Offset, OutCompositeId.Id);
+
+		return bDecodedId
+			&& ReadCompositeString(Buffer, Offset, OutCompositeId.PlatformType)
+			&& ReadCompositeString(Buffer, Offset, OutCompositeId.PlatformId)
+			&& Offset == Buffer.Num();
+	}
+
+	/**
+	 * Decode the legacy JSON composite format from a buffer that has already been decoded from Base64.
+	 */
+	bool DecodeLegacyJsonComposite(TArray<uint8>& Buffer, FAccelByteUniqueIdComposite& OutCompositeId)
+	{
+		// Make sure that the buffer is null terminated before we convert it to a string for the JSON parser
+		Buffer.Add(0);
+		const FString JSONString = UTF8_TO_TCHAR(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()));
+		return FJsonObjectConverter::JsonObjectStringToUStruct(JSONString, &OutCompositeId, 0, 0);
+	}
 }
 
 #pragma region FAccelByteUniqueIdComposite
@@ -177,12 +340,10 @@ FUniqueNetIdAccelByteUser::FUniqueNetIdAccelByteUser(const FAccelByteUniqueIdCom
 	: FUniqueNetIdAccelByteResource(EncodedComposite)
 	, CompositeStructure(CompositeId)
 {
-	// Check if this ID is valid and cache it so that we can cut down on processing of the ID later
-	if (!bHasCachedValidState)
-	{
-		bCachedValidState = IsValid();
-		bHasCachedValidState = true;
-	}
+	// We were handed the composite that the encoded string was built from, so there is no need to decode the string
+	// again to check validity. Just validate the composite components and cache that result.
+	bCachedValidState = !CompositeStructure.Id.IsEmpty() && IsAccelByteIDValid(CompositeStructure.Id);
+	bHasCachedValidState = true;
 }
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
@@ -194,15 +355,8 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(const FAccelByteU
 		return Invalid();
 	}
 
-	FString CompositeString;
-	if (!FJsonObjectConverter::UStructToJsonObjectString(CompositeId, CompositeString))
-	{
-		UE_LOG_AB(Warning, TEXT("Failed to convert composite structure for an FUniqueNetIdAccelByte to a JSON string!"));
-		return Invalid();
-	}
-
-	FString EncodedString = FBase64::Encode(CompositeString);
-	if (EncodedString.IsEmpty())
+	FString EncodedString;
+	if (!EncodeCompositeId(CompositeId, EncodedString))
 	{
 		UE_LOG_AB(Warning, TEXT("Failed to encode composite structure for an FUniqueNetIdAccelByte to a Base64 string!"));
 		return Invalid();
@@ -215,16 +369,23 @@ FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(const FAccelByteU
 
 FUniqueNetIdAccelByteUserRef FUniqueNetIdAccelByteUser::Create(const FString& InUniqueNetId)
 {
-	// Check if this is a Base64 encoded string, meaning that it _most likely_ is a full composite ID. If it is, just pass
-	// the string straight to MakeShared, as it will decode the components for you. Otherwise, treat it as just the AccelByte ID.
-	FString DecodedString;
-	if (!FBase64::Decode(InUniqueNetId, DecodedString))
+	// A bare AccelByte ID can never be a valid encoded composite, as encoded composites will always be padded Base64 of
+	// a different length. Check for this first so that we don't waste time trying to decode the ID.
+	if (IsAccelByteIDValid(InUniqueNetId))
+	{
+		return Create(FAccelByteUniqueIdComposite(InUniqueNetId));
+	}
+
+	// Try and decode the string as a composite ID. If we can, then we already have the components and can skip decoding
+	// them a second time in the constructor. Otherwise, treat it as just the AccelByte ID.
+	FAccelByteUniqueIdComposite DecodedComposite;
+	if (!DecodeCompositeId(InUniqueNetId, DecodedComposite))
 	{
 		return Create(FAccelByteUniqueIdComposite(InUniqueNetId));
 	}
 
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	return MakeShared<const FUniqueNetIdAccelByteUser>(InUniqueNetId);
+	return MakeShared<const FUniqueNetIdAccelByteUser>(DecodedComposite, InUniqueNetId);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 }
 
@@ -265,25 +426,18 @@ bool FUniqueNetIdAccelByteUser::IsValid() const
 	}
 
 	// Since our most important piece of the ID is the encoded string, we will crack that open and check validity of that.
-	// As well as check if there is a mismatch between our individual elements and the JSON representation itself, which
+	// As well as check if there is a mismatch between our individual elements and the decoded composite itself, which
 	// would indicate a major issue.
-	FString JSONString;
-	if (!FBase64::Decode(UniqueNetIdStr, JSONString))
-	{
-		UE_LOG_AB(VeryVerbose, TEXT("UniqueID validity test failed: unable to decode Base64 ID with string value of '%s'!"), *UniqueNetIdStr);
-		return false;
-	}
-
 	FAccelByteUniqueIdComposite DecodedComposite;
-	if (!FJsonObjectConverter::JsonObjectStringToUStruct(JSONString, &DecodedComposite, 0, 0))
+	if (!DecodeCompositeId(UniqueNetIdStr, DecodedComposite))
 	{
-		UE_LOG_AB(VeryVerbose, TEXT("UniqueID validity test failed: unable to decode JSON composite object with string value of '%s'!"), *JSONString);
+		UE_LOG_AB(VeryVerbose, TEXT("UniqueID validity test failed: unable to decode composite ID with string value of '%s'!"), *UniqueNetIdStr);
 		return false;
 	}
 
 	if (CompositeStructure != DecodedComposite)
 	{
-		UE_LOG_AB(VeryVerbose, TEXT("UniqueID validity test failed: underlying components of ID and JSON composite object components do not match! JSON object: %s; Underlying components: %s"), *JSONString, *CompositeStructure.ToString());
+		UE_LOG_AB(VeryVerbose, TEXT("UniqueID validity test failed: underlying components of ID and decoded composite components do not match! Decoded composite: %s; Underlying components: %s"), *DecodedComposite.ToString(), *CompositeStructure.ToString());
 		return false;
 	}
 
@@ -308,17 +462,17 @@ FString FUniqueNetIdAccelByteUser::ToDebugString() const
 	return OutString;
 }
 
-FString FUniqueNetIdAccelByteUser::GetAccelByteId() const
+const FString& FUniqueNetIdAccelByteUser::GetAccelByteId() const
 {
 	return CompositeStructure.Id;
 }
 
-FString FUniqueNetIdAccelByteUser::GetPlatformType() const
+const FString& FUniqueNetIdAccelByteUser::GetPlatformType() const
 {
 	return CompositeStructure.PlatformType;
 }
 
-FString FUniqueNetIdAccelByteUser::GetPlatformId() const
+const FString& FUniqueNetIdAccelByteUser::GetPlatformId() const
 {
 	return CompositeStructure.PlatformId;
 }
@@ -389,6 +543,90 @@ bool FUniqueNetIdAccelByteUser::Compare(const FUniqueNetId& Other) const
 	return FUniqueNetIdString::Compare(Other);
 }
 
+uint32 FUniqueNetIdAccelByteUser::GetTypeHash() const
+{
+	// Legacy and binary encoded strings of the same ID differ, but compare equal, so they must hash off the components.
+	// IDs are equal whenever their AccelByte IDs match, which makes the AccelByte ID the only component safe to hash.
+	return ::GetTypeHash(CompositeStructure.Id);
+}
+
+bool FUniqueNetIdAccelByteUser::EncodeCompositeId(const FAccelByteUniqueIdComposite& CompositeId, FString& OutEncodedComposite)
+{
+	return EncodeCompositeId(CompositeId, OutEncodedComposite, ShouldUseBinaryCompositeIds());
+}
+
+bool FUniqueNetIdAccelByteUser::EncodeCompositeId(const FAccelByteUniqueIdComposite& CompositeId, FString& OutEncodedComposite, bool bUseBinaryEncoding)
+{
+	if (!bUseBinaryEncoding)
+	{
+		FString CompositeString;
+		if (!FJsonObjectConverter::UStructToJsonObjectString(CompositeId, CompositeString))
+		{
+			return false;
+		}
+
+		OutEncodedComposite = FBase64::Encode(CompositeString);
+		return !OutEncodedComposite.IsEmpty();
+	}
+
+	// Version byte, flags byte, packed ID, and two empty length prefixes are the most common case, so reserve for that
+	TArray<uint8> Buffer;
+	Buffer.Reserve(2 + PACKED_ACCELBYTE_ID_SIZE + 4 + CompositeId.PlatformType.Len() + CompositeId.PlatformId.Len());
+	Buffer.Add(ACCELBYTE_USER_ID_ENCODING_VERSION);
+	Buffer.Add(0);
+
+	// Pack the ID as raw bytes if we can, otherwise fall back to storing it as a string
+	if (TryPackAccelByteId(CompositeId.Id, Buffer))
+	{
+		Buffer[1] |= COMPOSITE_FLAG_PACKED_ACCELBYTE_ID;
+	}
+	else if (!WriteCompositeString(CompositeId.Id, Buffer))
+	{
+		return false;
+	}
+
+	if (!WriteCompositeString(CompositeId.PlatformType, Buffer) || !WriteCompositeString(CompositeId.PlatformId, Buffer))
+	{
+		return false;
+	}
+
+	OutEncodedComposite = FBase64::Encode(Buffer);
+	return !OutEncodedComposite.IsEmpty();
+}
+
+bool FUniqueNetIdAccelByteUser::DecodeCompositeId(const FString& EncodedComposite, FAccelByteUniqueIdComposite& OutCompositeId)
+{
+	TArray<uint8> Buffer;
+	if (!FBase64::Decode(EncodedComposite, Buffer) || Buffer.Num() <= 0)
+	{
+		return false;
+	}
+
+	// Leading byte tells us which format we are dealing with, legacy JSON composites will always start with an opening brace
+	if (Buffer[0] == ACCELBYTE_USER_ID_ENCODING_VERSION)
+	{
+		return DecodeBinaryComposite(Buffer, OutCompositeId);
+	}
+
+	return DecodeLegacyJsonComposite(Buffer, OutCompositeId);
+}
+
+bool FUniqueNetIdAccelByteUser::ShouldUseBinaryCompositeIds()
+{
+	// Read once, as this is checked for every ID we create, and every running instance has to agree on the format anyway
+	static const bool bUseBinaryCompositeIds = []()
+	{
+		bool bValue = false;
+		if (GConfig != nullptr)
+		{
+			GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bUseBinaryCompositeIds"), bValue, GEngineIni);
+		}
+		return bValue;
+	}();
+
+	return bUseBinaryCompositeIds;
+}
+
 void FUniqueNetIdAccelByteUser::DecodeIDElements()
 {
 	// If this is supposed to be an invalid ID, then just return that accordingly
@@ -398,23 +636,17 @@ void FUniqueNetIdAccelByteUser::DecodeIDElements()
 		return;
 	}
 
-	FString JSONString;
-	if (!FBase64::Decode(UniqueNetIdStr, JSONString))
-	{
-		UE_LOG_AB(Warning, TEXT("Failed to decode ID with string value of '%s' to Base64 AccelByte composite ID format!"), *UniqueNetIdStr);
-		return;
-	}
-
-	if (!FJsonObjectConverter::JsonObjectStringToUStruct(JSONString, &CompositeStructure, 0, 0))
+	if (!DecodeCompositeId(UniqueNetIdStr, CompositeStructure))
 	{
-		UE_LOG_AB(Warning, TEXT("Failed to get JSON object for AccelByte composite ID from decoded string value of '%s'!"), *JSONString);
+		UE_LOG_AB(Warning, TEXT("Failed to decode ID with string value of '%s' to AccelByte composite ID format!"), *UniqueNetIdStr);
 		return;
 	}
 
-	// Finally, cache a valid state from this ID if we haven't yet
+	// Finally, cache a valid state from this ID if we haven't yet. We have just decoded the components from our string,
+	// so there is no need to decode them again through IsValid, just check the AccelByte ID itself.
 	if (!bHasCachedValidState)
 	{
-		bCachedValidState = IsValid();
+		bCachedValidState = !CompositeStructure.Id.IsEmpty() && IsAccelByteIDValid(CompositeStructure.Id);
 		bHasCachedValidState = true;
 	}
 }
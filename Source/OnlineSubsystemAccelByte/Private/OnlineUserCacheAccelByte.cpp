@@ -7,15 +7,324 @@
 #include "OnlineSubsystemAccelByteTypes.h"
 #include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUsersByIds.h"
 #include "OnlineSubsystemUtils.h"
+#include "OnlineIdentityInterfaceAccelByte.h"
+#include "OnlineBackendAccelByte.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 
 bool IsInvalidAccelByteId(const FString& Id)
 {
 	return !IsAccelByteIDValid(Id);
 }
 
+namespace
+{
+	/** Magic number at the start of a persistent user cache file, "ABUC" */
+	constexpr uint32 PersistentUserCacheMagic = 0x43554241;
+
+	/**
+	 * Version of the persistent user cache record layout, files with any other version are discarded.
+	 * 
+	 * 2 - Records are prefixed with their size in bytes and include custom attributes
+	 */
+	constexpr uint32 PersistentUserCacheVersion = 2;
+
+	/** Largest single record we will read back, anything bigger can only come from a corrupt size prefix */
+	constexpr int32 MaxPersistentUserRecordSize = 1024 * 1024;
+
+	/** Lock serializing every write to persistent user cache files */
+	FCriticalSection PersistentUserCacheFileLock;
+
+	/** Single user as stored in the persistent user cache, records are appended and later records win */
+	struct FPersistentUserRecord
+	{
+		FString AccelByteId;
+		FString PlatformType;
+		FString PlatformId;
+		FString DisplayName;
+		FString PublicId;
+
+		/** Custom attributes of the user as a condensed JSON object string, blank if the user has none */
+		FString CustomAttributes;
+
+		bool bIsImportant = false;
+		int64 ExpiresAtUnixTime = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FPersistentUserRecord& Record)
+		{
+			Ar << Record.AccelByteId;
+			Ar << Record.PlatformType;
+			Ar << Record.PlatformId;
+			Ar << Record.DisplayName;
+			Ar << Record.PublicId;
+			Ar << Record.CustomAttributes;
+			Ar << Record.bIsImportant;
+			Ar << Record.ExpiresAtUnixTime;
+			return Ar;
+		}
+	};
+
+	/** Serialize the header that every persistent user cache file starts with */
+	TArray<uint8> MakePersistentUserCacheHeader()
+	{
+		TArray<uint8> HeaderBytes;
+		FMemoryWriter Writer(HeaderBytes);
+		uint32 Magic = PersistentUserCacheMagic;
+		uint32 Version = PersistentUserCacheVersion;
+		Writer << Magic;
+		Writer << Version;
+		return HeaderBytes;
+	}
+
+	/** Serialize a record to the end of a buffer, prefixed with its size so that readers can skip bad records */
+	void WritePersistentUserRecord(TArray<uint8>& OutBytes, FPersistentUserRecord& Record)
+	{
+		TArray<uint8> RecordBytes;
+		FMemoryWriter RecordWriter(RecordBytes);
+		RecordWriter << Record;
+
+		FMemoryWriter Writer(OutBytes, false, true);
+		int32 RecordSize = RecordBytes.Num();
+		Writer << RecordSize;
+		OutBytes.Append(RecordBytes);
+	}
+
+	/** Convert custom attributes of a user to the string stored in their persistent record */
+	FString SerializePersistentUserAttributes(const FJsonObject& CustomAttributes)
+	{
+		if (CustomAttributes.Values.Num() <= 0)
+		{
+			return FString();
+		}
+
+		const TSharedRef<FJsonObject> AttributesObject = MakeShared<FJsonObject>();
+		AttributesObject->Values = CustomAttributes.Values;
+
+		FString AttributesString;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&AttributesString);
+		FJsonSerializer::Serialize(AttributesObject, JsonWriter);
+		return AttributesString;
+	}
+
+	/** Restore custom attributes of a user from the string stored in their persistent record */
+	bool DeserializePersistentUserAttributes(const FString& AttributesString, FJsonObject& OutCustomAttributes)
+	{
+		if (AttributesString.IsEmpty())
+		{
+			return true;
+		}
+
+		TSharedPtr<FJsonObject> AttributesObject;
+		const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(AttributesString);
+		if (!FJsonSerializer::Deserialize(JsonReader, AttributesObject) || !AttributesObject.IsValid())
+		{
+			return false;
+		}
+
+		OutCustomAttributes.Values = MoveTemp(AttributesObject->Values);
+		return true;
+	}
+
+	/**
+	 * Read every record from a persistent user cache file, keeping only the latest record for each user, and dropping
+	 * users that expired before the time given. A truncated trailing record, such as from a crash mid write, is ignored.
+	 * 
+	 * The file is streamed a record at a time rather than loaded whole, so only the records kept are ever held in memory.
+	 * 
+	 * Returns the number of records read from the file, including those that were dropped.
+	 */
+	int32 ReadPersistentUserRecords(const FString& FilePath, int64 DiscardBeforeUnixTime, TArray<FPersistentUserRecord>& OutRecords)
+	{
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+		if (!Reader.IsValid())
+		{
+			return 0;
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		if (Reader->TotalSize() >= static_cast<int64>(sizeof(Magic) + sizeof(Version)))
+		{
+			*Reader << Magic;
+			*Reader << Version;
+		}
+
+		if (Reader->IsError() || Magic != PersistentUserCacheMagic || Version != PersistentUserCacheVersion)
+		{
+			UE_LOG_AB(Log, TEXT("Discarding persistent user cache at '%s' as it is not a version we can read"), *FilePath);
+			Reader.Reset();
+			IFileManager::Get().Delete(*FilePath, false, false, true);
+			return 0;
+		}
+
+		TMap<FString, int32> RecordIndexById;
+		TArray<uint8> RecordBytes;
+		int32 NumRecordsRead = 0;
+		bool bIsTruncated = false;
+		const int64 TotalSize = Reader->TotalSize();
+		while (Reader->Tell() < TotalSize)
+		{
+			// Check sizes against what is left of the file before reading, so a truncated record never reads past the end
+			int32 RecordSize = 0;
+			if (TotalSize - Reader->Tell() < static_cast<int64>(sizeof(RecordSize)))
+			{
+				bIsTruncated = true;
+				break;
+			}
+
+			*Reader << RecordSize;
+			if (Reader->IsError() || RecordSize <= 0 || RecordSize > MaxPersistentUserRecordSize || RecordSize > TotalSize - Reader->Tell())
+			{
+				bIsTruncated = true;
+				break;
+			}
+
+			// Counted as soon as its bytes are read, so that records we fail to deserialize still count as dead weight
+			RecordBytes.SetNumUninitialized(RecordSize);
+			Reader->Serialize(RecordBytes.GetData(), RecordSize);
+			NumRecordsRead++;
+
+			FPersistentUserRecord Record;
+			FMemoryReader RecordReader(RecordBytes);
+			RecordReader << Record;
+			if (Reader->IsError() || RecordReader.IsError())
+			{
+				// Records are framed by their size, so a single bad record can be skipped without losing the rest
+				continue;
+			}
+
+			const int32* ExistingIndex = RecordIndexById.Find(Record.AccelByteId);
+			if (ExistingIndex != nullptr)
+			{
+				OutRecords[*ExistingIndex] = MoveTemp(Record);
+			}
+			else
+			{
+				RecordIndexById.Add(Record.AccelByteId, OutRecords.Num());
+				OutRecords.Add(MoveTemp(Record));
+			}
+		}
+
+		OutRecords.RemoveAll([DiscardBeforeUnixTime](const FPersistentUserRecord& Record) {
+			return Record.ExpiresAtUnixTime < DiscardBeforeUnixTime;
+		});
+
+		// Count a truncated file as fully dead weight so that it always gets rewritten cleanly
+		return bIsTruncated ? MAX_int32 : NumRecordsRead;
+	}
+
+	/** Replace a persistent user cache file with just the records given */
+	void WritePersistentUserRecords(const FString& FilePath, TArray<FPersistentUserRecord>& Records)
+	{
+		TArray<uint8> FileBytes = MakePersistentUserCacheHeader();
+		for (FPersistentUserRecord& Record : Records)
+		{
+			WritePersistentUserRecord(FileBytes, Record);
+		}
+
+		FScopeLock ScopeLock(&PersistentUserCacheFileLock);
+		FFileHelper::SaveArrayToFile(FileBytes, *FilePath);
+	}
+
+	/** Serialize users into records for the persistent user cache, each expiring at the time given */
+	TArray<uint8> SerializePersistentUserRecords(const TArray<TSharedRef<FAccelByteUserInfo>>& Users, int64 ExpiresAtUnixTime)
+	{
+		TArray<uint8> RecordBytes;
+		for (const TSharedRef<FAccelByteUserInfo>& User : Users)
+		{
+			if (!User->Id.IsValid())
+			{
+				continue;
+			}
+
+			FPersistentUserRecord Record;
+			Record.AccelByteId = User->Id->GetAccelByteId();
+			Record.PlatformType = User->Id->GetPlatformType();
+			Record.PlatformId = User->Id->GetPlatformId();
+			Record.DisplayName = User->DisplayName;
+			Record.PublicId = User->PublicId;
+			Record.CustomAttributes = SerializePersistentUserAttributes(User->CustomAttributes);
+			Record.bIsImportant = User->bIsImportant;
+			Record.ExpiresAtUnixTime = ExpiresAtUnixTime;
+			WritePersistentUserRecord(RecordBytes, Record);
+		}
+		return RecordBytes;
+	}
+
+	/** Append already serialized records to a persistent user cache file, creating it if needed */
+	void AppendPersistentUserRecords(const FString& FilePath, const TArray<uint8>& RecordBytes)
+	{
+		FScopeLock ScopeLock(&PersistentUserCacheFileLock);
+		if (IFileManager::Get().FileSize(*FilePath) <= 0)
+		{
+			FFileHelper::SaveArrayToFile(MakePersistentUserCacheHeader(), *FilePath);
+		}
+		FFileHelper::SaveArrayToFile(RecordBytes, *FilePath, &IFileManager::Get(), FILEWRITE_Append);
+	}
+}
+
+bool FAccelBytePendingUserQuery::IsResolved() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumPendingIds <= 0;
+}
+
+bool FAccelBytePendingUserQuery::HasFailure() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return FailedIds.Num() > 0;
+}
+
+TArray<TSharedRef<FAccelByteUserInfo>> FAccelBytePendingUserQuery::GetResolvedUsers() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return ResolvedUsers;
+}
+
+TArray<FString> FAccelBytePendingUserQuery::GetFailedIds() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return FailedIds;
+}
+
+void FAccelBytePendingUserQuery::SetOnResolved(TFunction<void()> InOnResolved)
+{
+	FScopeLock ScopeLock(&Lock);
+	OnResolved = MoveTemp(InOnResolved);
+}
+
 FOnlineUserCacheAccelByte::FOnlineUserCacheAccelByte(FOnlineSubsystemAccelByte* InSubsystem)
 	: Subsystem(InSubsystem)
 {
+	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableUserQueryBatching"), bIsQueryBatchingEnabled, GEngineIni);
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("UserQueryBatchWindowSeconds"), QueryBatchWindowSeconds, GEngineIni);
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("UserQueryBatchMaxIds"), QueryBatchMaxIds, GEngineIni);
+	QueryBatchMaxIds = FMath::Max(QueryBatchMaxIds, 1);
+
+	TArray<FString> StringUniqueNetIdTypeNames;
+	GConfig->GetArray(TEXT("OnlineSubsystemAccelByte"), TEXT("StringUniqueNetIdTypes"), StringUniqueNetIdTypeNames, GEngineIni);
+	for (const FString& TypeName : StringUniqueNetIdTypeNames)
+	{
+		StringUniqueNetIdTypes.Add(FName(*TypeName));
+	}
+
+	GConfig->GetBool(TEXT("OnlineSubsystemAccelByte"), TEXT("bEnableUserCachePersistence"), bIsPersistenceEnabled, GEngineIni);
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("PersistentUserCacheTTLSeconds"), PersistentEntryTTLSeconds, GEngineIni);
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("PersistentUserCacheMaxStaleSeconds"), PersistentEntryMaxStaleSeconds, GEngineIni);
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("PersistentUserCacheFlushIntervalSeconds"), PersistFlushIntervalSeconds, GEngineIni);
+
+	GConfig->GetDouble(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCachePurgeTimeoutSeconds"), UserCachePurgeTimeoutSeconds, GEngineIni);
+	GConfig->GetInt(TEXT("OnlineSubsystemAccelByte"), TEXT("UserCacheMaxEntries"), MaxCachedUsers, GEngineIni);
+	UserCachePurgeTimeoutSeconds = FMath::Max(UserCachePurgeTimeoutSeconds, 0.0);
+	EvictionSlotSeconds = FMath::Max(UserCachePurgeTimeoutSeconds / NumEvictionSlotsPerTimeout, 0.01);
+	NextEvictionSlot = GetEvictionSlot(FPlatformTime::Seconds());
 }
 
 bool FOnlineUserCacheAccelByte::GetFromSubsystem(const IOnlineSubsystem* Subsystem, FOnlineUserCacheAccelBytePtr& OutInterfaceInstance)
@@ -45,81 +354,335 @@ bool FOnlineUserCacheAccelByte::GetFromWorld(const UWorld* World, FOnlineUserCac
 
 int32 FOnlineUserCacheAccelByte::Purge()
 {
-	// Lock while we attempt to purge from the caches
-	FScopeLock ScopeLock(&CacheLock);
-
-	// Filter all of the users in the map that have gone past their elapsed time and aren't marked as important so we can
-	// purge them from the user cache maps
 	const double CurrentTimeInSeconds = FPlatformTime::Seconds();
 
-	TMap<FString, TSharedRef<FAccelByteUserInfo>> FilteredUserMap;
-	FilteredUserMap.Reserve(AccelByteIdToUserInfoMap.Num());
-	for (const TPair<FString, TSharedRef<FAccelByteUserInfo>>& UserIdToUserInfo : AccelByteIdToUserInfoMap)
+	// Every bucket before this one only holds users last accessed longer ago than the purge timeout
+	const int64 ExpiredEndSlot = GetEvictionSlot(CurrentTimeInSeconds - UserCachePurgeTimeoutSeconds);
+
+	TArray<TPair<int64, FEvictionEntry>> DueEntries;
 	{
-		const double ElapsedTimeInSeconds = CurrentTimeInSeconds - UserIdToUserInfo.Value->LastAccessedTimeInSeconds;
-		if (ElapsedTimeInSeconds >= UserCachePurgeTimeoutSeconds && !UserIdToUserInfo.Value->bIsImportant)
+		FScopeLock ScopeLock(&EvictionLock);
+		if (ExpiredEndSlot > NextEvictionSlot)
 		{
-			FilteredUserMap.Add(UserIdToUserInfo);
+			TakeEvictionSlotsLocked(NextEvictionSlot, ExpiredEndSlot, DueEntries);
+			NextEvictionSlot = ExpiredEndSlot;
 		}
 	}
-	
+
 	int32 ItemsPurged = 0;
 
-	// Now iterate through the users that we got back from the filter and remove them from the real maps
-	for (const TPair<FString, TSharedRef<FAccelByteUserInfo>>& UserIdToUserInfo : FilteredUserMap)
+	// Entries are only a hint of when a user was last accessed, so check each against the user actually in the cache. Users
+	// that were accessed since being bucketed are moved to the bucket for their latest access rather than purged.
+	const auto ProcessEntry = [this, &ItemsPurged](const TPair<int64, FEvictionEntry>& DueEntry, TArray<TSharedRef<FAccelByteUserInfo>>& OutUsersToReschedule) {
+		const FEvictionEntry& Entry = DueEntry.Value;
+		const TSharedPtr<FAccelByteUserInfo> User = FindByAccelByteId(Entry.AccelByteId, false);
+		if (!User.IsValid() || User.Get() != Entry.User || User->bIsImportant)
+		{
+			return;
+		}
+
+		const double AccessedBeforeTimeInSeconds = (DueEntry.Key + 1) * EvictionSlotSeconds;
+		if (RemoveUserIfUnchanged(Entry.AccelByteId, Entry.User, AccessedBeforeTimeInSeconds))
+		{
+			ItemsPurged++;
+		}
+		else
+		{
+			OutUsersToReschedule.Add(User.ToSharedRef());
+		}
+	};
+
+	TArray<TSharedRef<FAccelByteUserInfo>> UsersToReschedule;
+	for (const TPair<int64, FEvictionEntry>& DueEntry : DueEntries)
+	{
+		ProcessEntry(DueEntry, UsersToReschedule);
+	}
+
+	if (UsersToReschedule.Num() > 0)
 	{
-		// Remove the user from the AccelByte ID cache map
-		TSharedPtr<const FAccelByteUserInfo> UserInfo = UserIdToUserInfo.Value;
-		AccelByteIdToUserInfoMap.Remove(UserIdToUserInfo.Key);
+		FScopeLock ScopeLock(&EvictionLock);
+		ScheduleEvictionLocked(UsersToReschedule);
+	}
 
-		// Check if the user has a platform ID, if so format it and remove them from the platform cache
-		if (UserInfo->Id.IsValid() && UserInfo->Id->HasPlatformInformation())
+	// If we are still over capacity, walk buckets from the oldest onward purging users regardless of age. Users that were
+	// accessed since being bucketed are rescheduled straight away, so that we run into them again further along the walk.
+	if (MaxCachedUsers > 0 && NumCachedUsers.GetValue() > MaxCachedUsers)
+	{
+		int64 Slot = 0;
 		{
-			const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserInfo->Id->GetPlatformType(), UserInfo->Id->GetPlatformId());
-			PlatformIdToUserInfoMap.Remove(PlatformId);
+			FScopeLock ScopeLock(&EvictionLock);
+			Slot = NextEvictionSlot;
 		}
 
-		ItemsPurged++;
+		const int64 EndSlot = GetEvictionSlot(CurrentTimeInSeconds) + 1;
+		for (; Slot < EndSlot && NumCachedUsers.GetValue() > MaxCachedUsers; Slot++)
+		{
+			TArray<TPair<int64, FEvictionEntry>> SlotEntries;
+			{
+				FScopeLock ScopeLock(&EvictionLock);
+				TakeEvictionSlotsLocked(Slot, Slot + 1, SlotEntries);
+			}
+
+			UsersToReschedule.Reset();
+			int32 EntryIndex = 0;
+			for (; EntryIndex < SlotEntries.Num() && NumCachedUsers.GetValue() > MaxCachedUsers; EntryIndex++)
+			{
+				ProcessEntry(SlotEntries[EntryIndex], UsersToReschedule);
+			}
+
+			FScopeLock ScopeLock(&EvictionLock);
+			ScheduleEvictionLocked(UsersToReschedule);
+
+			// Put back anything we did not need to look at once we got under capacity
+			if (EntryIndex < SlotEntries.Num())
+			{
+				TArray<FEvictionEntry>& Bucket = EvictionWheel.FindOrAdd(FMath::Max(Slot, NextEvictionSlot));
+				for (; EntryIndex < SlotEntries.Num(); EntryIndex++)
+				{
+					Bucket.Add(MoveTemp(SlotEntries[EntryIndex].Value));
+				}
+			}
+		}
 	}
 
 	return ItemsPurged;
 }
 
-bool FOnlineUserCacheAccelByte::IsUserCached(const FAccelByteUniqueIdComposite& Id)
+int64 FOnlineUserCacheAccelByte::GetEvictionSlot(double TimeInSeconds) const
+{
+	return static_cast<int64>(FMath::FloorToDouble(TimeInSeconds / EvictionSlotSeconds));
+}
+
+void FOnlineUserCacheAccelByte::ScheduleEvictionLocked(const TArray<TSharedRef<FAccelByteUserInfo>>& Users)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
+	for (const TSharedRef<FAccelByteUserInfo>& User : Users)
+	{
+		// Important users are never purged, so there is no need to track them
+		if (User->bIsImportant || !User->Id.IsValid())
+		{
+			continue;
+		}
+
+		const int64 Slot = FMath::Max(GetEvictionSlot(User->LastAccessedTimeInSeconds.load(std::memory_order_relaxed)), NextEvictionSlot);
+		EvictionWheel.FindOrAdd(Slot).Add({ User->Id->GetAccelByteId(), &User.Get() });
+	}
+}
+
+void FOnlineUserCacheAccelByte::TakeEvictionSlotsLocked(int64 FirstSlot, int64 EndSlot, TArray<TPair<int64, FEvictionEntry>>& OutEntries)
+{
+	const auto TakeSlot = [this, &OutEntries](int64 Slot) {
+		TArray<FEvictionEntry> Bucket;
+		if (EvictionWheel.RemoveAndCopyValue(Slot, Bucket))
+		{
+			for (FEvictionEntry& Entry : Bucket)
+			{
+				OutEntries.Emplace(Slot, MoveTemp(Entry));
+			}
+		}
+	};
+
+	// Walk the range directly if it is short, otherwise walk the buckets we actually have, such as after a long hitch
+	if (EndSlot - FirstSlot <= EvictionWheel.Num())
+	{
+		for (int64 Slot = FirstSlot; Slot < EndSlot; Slot++)
+		{
+			TakeSlot(Slot);
+		}
+		return;
+	}
+
+	TArray<int64> SlotsInRange;
+	for (const TPair<int64, TArray<FEvictionEntry>>& Bucket : EvictionWheel)
+	{
+		if (Bucket.Key >= FirstSlot && Bucket.Key < EndSlot)
+		{
+			SlotsInRange.Add(Bucket.Key);
+		}
+	}
+	SlotsInRange.Sort();
+
+	for (const int64 Slot : SlotsInRange)
+	{
+		TakeSlot(Slot);
+	}
+}
 
+bool FOnlineUserCacheAccelByte::RemoveUserIfUnchanged(const FString& AccelByteId, const FAccelByteUserInfo* ExpectedUser, double AccessedBeforeTimeInSeconds)
+{
+	// Keep the ID alive past the removal, as the platform key view below borrows its strings
+	TSharedPtr<const FUniqueNetIdAccelByteUser> RemovedUserId;
+	{
+		FUserCacheShard& Shard = Shards[GetShardIndex(AccelByteId)];
+		FWriteScopeLock WriteLock(Shard.Lock);
+
+		// Check again under the write lock, as the user may have been replaced, marked important or accessed meanwhile
+		const TSharedRef<FAccelByteUserInfo>* FoundUserInfo = Shard.AccelByteIdToUserInfoMap.Find(AccelByteId);
+		if (FoundUserInfo == nullptr
+			|| &FoundUserInfo->Get() != ExpectedUser
+			|| (*FoundUserInfo)->bIsImportant
+			|| (*FoundUserInfo)->LastAccessedTimeInSeconds.load(std::memory_order_relaxed) >= AccessedBeforeTimeInSeconds)
+		{
+			return false;
+		}
+
+		RemovedUserId = (*FoundUserInfo)->Id;
+		Shard.AccelByteIdToUserInfoMap.Remove(AccelByteId);
+	}
+	NumCachedUsers.Decrement();
+
+	// Platform entries may live in a different shard, so this is done after releasing the AccelByte ID shard lock to
+	// avoid ever holding two shard locks at once
+	if (RemovedUserId.IsValid() && RemovedUserId->HasPlatformInformation())
+	{
+		const FPlatformUserKeyView PlatformKey(RemovedUserId->GetPlatformType(), RemovedUserId->GetPlatformId());
+		FUserCacheShard& Shard = Shards[GetShardIndex(PlatformKey.Hash)];
+		FWriteScopeLock WriteLock(Shard.Lock);
+
+		// Only remove the mapping if it still points at the purged user, as a fresh query may have replaced it meanwhile
+		const TSharedRef<FAccelByteUserInfo>* FoundUserInfo = Shard.PlatformIdToUserInfoMap.FindByHash(PlatformKey.Hash, PlatformKey);
+		if (FoundUserInfo != nullptr && &FoundUserInfo->Get() == ExpectedUser)
+		{
+			Shard.PlatformIdToUserInfoMap.RemoveByHash(PlatformKey.Hash, PlatformKey);
+		}
+	}
+
+	return true;
+}
+
+bool FOnlineUserCacheAccelByte::IsUserCached(const FAccelByteUniqueIdComposite& Id)
+{
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
 	if (!Id.Id.IsEmpty())
 	{
-		return AccelByteIdToUserInfoMap.Contains(Id.Id);
+		return FindByAccelByteId(Id.Id, false).IsValid();
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
 	if (!Id.PlatformType.IsEmpty() && !Id.PlatformId.IsEmpty())
 	{
-		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(Id.PlatformType, Id.PlatformId);
-		return PlatformIdToUserInfoMap.Contains(PlatformId);
+		return FindByPlatformKey(FPlatformUserKeyView(Id.PlatformType, Id.PlatformId), false).IsValid();
 	}
 
 	return false;
 }
 
-void FOnlineUserCacheAccelByte::GetQueryAndCacheArrays(const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<TSharedRef<FAccelByteUserInfo>>& UsersInCache)
+void FOnlineUserCacheAccelByte::GetQueryAndCacheArrays(const FAccelBytePendingUserQueryRef& Query, const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<TSharedRef<FAccelByteUserInfo>>& UsersInCache, bool bRefreshStaleUsers /*= false*/)
 {
-	for (const FString& AccelByteId : AccelByteIds)
+	int32 NumIdsAttached = 0;
 	{
-		const TSharedRef<FAccelByteUserInfo>* FoundCachedUser = AccelByteIdToUserInfoMap.Find(AccelByteId);
-		if (FoundCachedUser != nullptr)
+		// Hold the pending lock across both the cache check and the in-flight check, so that an owner cannot resolve an
+		// ID in between and leave us thinking that it is neither cached nor in flight
+		FScopeLock PendingScopeLock(&PendingUsersLock);
+		for (const FString& AccelByteId : AccelByteIds)
 		{
-			UsersInCache.Add(*FoundCachedUser);
+			// Stale users are served straight away and refreshed in the background, unless this query is that refresh
+			const TSharedPtr<FAccelByteUserInfo> FoundCachedUser = FindByAccelByteId(AccelByteId, false);
+			if (FoundCachedUser.IsValid() && !(bRefreshStaleUsers && FoundCachedUser->bIsStale))
+			{
+				UsersInCache.Add(FoundCachedUser.ToSharedRef());
+				MarkForRefreshIfStale(FoundCachedUser);
+				continue;
+			}
+
+			FPendingUserEntry* FoundPendingEntry = PendingUsers.Find(AccelByteId);
+			if (FoundPendingEntry != nullptr && FoundPendingEntry->Owner.HasSameObject(&Query.Get()))
+			{
+				// Duplicate ID in our own request, we are already fetching it
+				continue;
+			}
+
+			// Only wait on another query if it is still alive to resolve the ID, otherwise take over fetching it ourselves
+			if (FoundPendingEntry != nullptr && FoundPendingEntry->Owner.IsValid())
+			{
+				FoundPendingEntry->Waiters.Add(Query);
+				NumIdsAttached++;
+				continue;
+			}
+
+			FPendingUserEntry& NewEntry = PendingUsers.Add(AccelByteId);
+			NewEntry.Owner = Query;
+			UsersToQuery.Add(AccelByteId);
 		}
-		else
+
+		// Count the IDs we are waiting on before releasing the pending lock, so that no owner can resolve them first
+		if (NumIdsAttached > 0)
 		{
-			UsersToQuery.Add(AccelByteId);
+			FScopeLock QueryScopeLock(&Query->Lock);
+			Query->NumPendingIds += NumIdsAttached;
+		}
+	}
+
+	if (NumIdsAttached > 0)
+	{
+		NumCoalescedQueries.Increment();
+		UE_LOG_AB(VeryVerbose, TEXT("User query attached to %d user IDs already in flight rather than fetching them again"), NumIdsAttached);
+	}
+}
+
+void FOnlineUserCacheAccelByte::ResolvePendingUsers(const FAccelBytePendingUserQueryRef& Query, const TArray<FString>& AccelByteIds, const TArray<TSharedRef<FAccelByteUserInfo>>& UsersQueried, bool bWasSuccessful)
+{
+	// Add users to the cache before they stop being in flight, so that there is never a moment where a user we fetched
+	// is neither cached nor pending and would be fetched again
+	if (bWasSuccessful)
+	{
+		AddUsersToCache(UsersQueried);
+	}
+
+	TArray<FPendingUserEntry> ResolvedEntries;
+	TArray<FString> ResolvedIds;
+	{
+		FScopeLock PendingScopeLock(&PendingUsersLock);
+		for (const FString& AccelByteId : AccelByteIds)
+		{
+			FPendingUserEntry* FoundPendingEntry = PendingUsers.Find(AccelByteId);
+			if (FoundPendingEntry == nullptr || !FoundPendingEntry->Owner.HasSameObject(&Query.Get()))
+			{
+				continue;
+			}
+
+			ResolvedIds.Add(AccelByteId);
+			ResolvedEntries.Add(MoveTemp(*FoundPendingEntry));
+			PendingUsers.Remove(AccelByteId);
+		}
+	}
+
+	// Hand results to any queries waiting on these IDs. A missing user just means that the backend did not know them.
+	TArray<TFunction<void()>> ResolvedCallbacks;
+	for (int32 Index = 0; Index < ResolvedEntries.Num(); Index++)
+	{
+		if (ResolvedEntries[Index].Waiters.Num() <= 0)
+		{
+			continue;
+		}
+
+		const TSharedRef<FAccelByteUserInfo>* FoundUser = UsersQueried.FindByPredicate([&AccelByteId = ResolvedIds[Index]](const TSharedRef<FAccelByteUserInfo>& User) {
+			return User->Id.IsValid() && User->Id->GetAccelByteId() == AccelByteId;
+		});
+
+		for (const FAccelBytePendingUserQueryRef& Waiter : ResolvedEntries[Index].Waiters)
+		{
+			FScopeLock WaiterScopeLock(&Waiter->Lock);
+			if (!bWasSuccessful)
+			{
+				Waiter->FailedIds.Add(ResolvedIds[Index]);
+			}
+			else if (FoundUser != nullptr)
+			{
+				Waiter->ResolvedUsers.Add(*FoundUser);
+			}
+
+			Waiter->NumPendingIds--;
+			if (Waiter->NumPendingIds <= 0 && Waiter->OnResolved)
+			{
+				ResolvedCallbacks.Add(Waiter->OnResolved);
+			}
 		}
 	}
+
+	for (const TFunction<void()>& ResolvedCallback : ResolvedCallbacks)
+	{
+		ResolvedCallback();
+	}
 }
 
 bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant/*=false*/)
@@ -135,7 +698,13 @@ bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(int32 LocalUserNum, con
 		return false;
 	}
 
-	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, FilteredIds, bIsImportant, Delegate);
+	if (bIsQueryBatchingEnabled)
+	{
+		AddQueryToBatch(LocalUserNum, FilteredIds, Delegate, bIsImportant);
+		return true;
+	}
+
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, MoveTemp(FilteredIds), bIsImportant, Delegate);
 	return true;
 }
 
@@ -172,7 +741,19 @@ bool FOnlineUserCacheAccelByte::QueryUsersByAccelByteIds(const FUniqueNetId& Use
 		return false;
 	}
 
-	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, UserId, FilteredIds, bIsImportant, Delegate);
+	// Batches are per local user, so only batch if we can find which local user this ID belongs to
+	if (bIsQueryBatchingEnabled)
+	{
+		const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(Subsystem->GetIdentityInterface());
+		int32 LocalUserNum = 0;
+		if (IdentityInterface.IsValid() && IdentityInterface->GetLocalUserNum(UserId, LocalUserNum))
+		{
+			AddQueryToBatch(LocalUserNum, FilteredIds, Delegate, bIsImportant);
+			return true;
+		}
+	}
+
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, UserId, MoveTemp(FilteredIds), bIsImportant, Delegate);
 	return true;
 }
 
@@ -196,11 +777,136 @@ bool FOnlineUserCacheAccelByte::QueryUsersByPlatformIds(const FUniqueNetId& User
 	return true;
 }
 
-TSharedPtr<const FAccelByteUserInfo> FOnlineUserCacheAccelByte::GetUser(const FUniqueNetId& UserId)
+void FOnlineUserCacheAccelByte::Tick(float DeltaTime)
+{
+	// Cheap when nothing is due, as it only looks at the buckets of the timing wheel that have expired since last tick
+	Purge();
+
+	if (bIsPersistenceEnabled)
+	{
+		if (!bHasStartedPersistentLoad)
+		{
+			StartPersistentCacheLoad();
+		}
+
+		const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+		if (bHasLoadedPersistentCache && CurrentTimeInSeconds - LastPersistFlushTimeInSeconds >= PersistFlushIntervalSeconds)
+		{
+			LastPersistFlushTimeInSeconds = CurrentTimeInSeconds;
+			FlushPersistentCache(false);
+			RefreshStaleUsers();
+		}
+	}
+
+	if (!bIsQueryBatchingEnabled)
+	{
+		return;
+	}
+
+	// Pull out every batch whose window has elapsed, and send them once we no longer hold the batch lock
+	TArray<TPair<TPair<int32, bool>, FUserQueryBatch>> DueBatches;
+	{
+		FScopeLock ScopeLock(&QueryBatchLock);
+		const double CurrentTimeInSeconds = FPlatformTime::Seconds();
+		for (auto It = QueryBatches.CreateIterator(); It; ++It)
+		{
+			if (CurrentTimeInSeconds - It.Value().OpenedTimeInSeconds >= QueryBatchWindowSeconds)
+			{
+				DueBatches.Emplace(It.Key(), MoveTemp(It.Value()));
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	for (TPair<TPair<int32, bool>, FUserQueryBatch>& DueBatch : DueBatches)
+	{
+		DispatchQueryBatch(DueBatch.Key.Key, DueBatch.Key.Value, MoveTemp(DueBatch.Value));
+	}
+}
+
+void FOnlineUserCacheAccelByte::AddQueryToBatch(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
+	FUserQueryBatch FullBatch;
+	bool bIsBatchFull = false;
+	{
+		FScopeLock ScopeLock(&QueryBatchLock);
+		const TPair<int32, bool> BatchKey(LocalUserNum, bIsImportant);
+
+		FUserQueryBatch* Batch = QueryBatches.Find(BatchKey);
+		if (Batch == nullptr)
+		{
+			Batch = &QueryBatches.Add(BatchKey);
+			Batch->OpenedTimeInSeconds = FPlatformTime::Seconds();
+		}
 
+		Batch->AccelByteIds.Append(AccelByteIds);
+		Batch->Queries.Add({ AccelByteIds, Delegate });
+
+		if (Batch->AccelByteIds.Num() >= QueryBatchMaxIds)
+		{
+			FullBatch = MoveTemp(*Batch);
+			QueryBatches.Remove(BatchKey);
+			bIsBatchFull = true;
+		}
+	}
+
+	if (bIsBatchFull)
+	{
+		DispatchQueryBatch(LocalUserNum, bIsImportant, MoveTemp(FullBatch));
+	}
+}
+
+void FOnlineUserCacheAccelByte::DispatchQueryBatch(int32 LocalUserNum, bool bIsImportant, FUserQueryBatch&& Batch)
+{
+	UE_LOG_AB(VeryVerbose, TEXT("Sending batch of %d user queries for %d unique IDs"), Batch.Queries.Num(), Batch.AccelByteIds.Num());
+
+	// Hand each caller only the users that they asked for once the bulk query completes
+	const FOnQueryUsersComplete OnBatchComplete = FOnQueryUsersComplete::CreateLambda([Queries = MoveTemp(Batch.Queries)](bool bIsSuccessful, TArray<TSharedRef<FAccelByteUserInfo>> UsersQueried, TArray<FString> FailedIds) {
+		const TSet<FString> FailedIdSet(FailedIds);
+
+		TMap<FString, TSharedRef<FAccelByteUserInfo>> UsersById;
+		UsersById.Reserve(UsersQueried.Num());
+		for (const TSharedRef<FAccelByteUserInfo>& User : UsersQueried)
+		{
+			if (User->Id.IsValid())
+			{
+				UsersById.Add(User->Id->GetAccelByteId(), User);
+			}
+		}
+
+		for (const FBatchedUserQuery& Query : Queries)
+		{
+			TArray<TSharedRef<FAccelByteUserInfo>> QueryUsers;
+			TArray<FString> QueryFailedIds;
+			for (const FString& AccelByteId : Query.AccelByteIds)
+			{
+				const TSharedRef<FAccelByteUserInfo>* FoundUser = UsersById.Find(AccelByteId);
+				if (FoundUser != nullptr)
+				{
+					QueryUsers.AddUnique(*FoundUser);
+				}
+				else if (FailedIdSet.Contains(AccelByteId))
+				{
+					QueryFailedIds.AddUnique(AccelByteId);
+				}
+			}
+
+			// The batch is a single query as far as the backend is concerned, so it succeeds or fails for every caller
+			// in it, but each caller is only told about the failed IDs that they asked for
+			Query.Delegate.ExecuteIfBound(bIsSuccessful, QueryUsers, QueryFailedIds);
+		}
+	});
+
+	Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, Batch.AccelByteIds.Array(), bIsImportant, OnBatchComplete);
+}
+
+int32 FOnlineUserCacheAccelByte::GetNumCoalescedQueries() const
+{
+	return NumCoalescedQueries.GetValue();
+}
+
+TSharedPtr<const FAccelByteUserInfo> FOnlineUserCacheAccelByte::GetUser(const FUniqueNetId& UserId)
+{
 	// If this unique ID is an AccelByte composite ID already, then forward to the GetUser using the composite structure
 	if (UserId.GetType() == ACCELBYTE_SUBSYSTEM)
 	{
@@ -208,64 +914,349 @@ TSharedPtr<const FAccelByteUserInfo> FOnlineUserCacheAccelByte::GetUser(const FU
 		return GetUser(AccelByteId->GetCompositeStructure());
 	}
 
-	// Otherwise, query as if it is a platform ID
-	const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.GetType().ToString(), UserId.ToString());
-	const TSharedRef<FAccelByteUserInfo>* FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
-	if (FoundUserInfo != nullptr)
+	// Otherwise, query as if it is a platform ID. The type name is written out to the stack, and IDs of types known to
+	// be string backed are read in place, so that probing those does not allocate.
+	TCHAR PlatformTypeBuffer[NAME_SIZE];
+	const uint32 PlatformTypeLength = UserId.GetType().ToString(PlatformTypeBuffer, NAME_SIZE);
+	const FStringView PlatformType(PlatformTypeBuffer, PlatformTypeLength);
+
+	FString PlatformIdStorage;
+	const FStringView PlatformId = GetPlatformIdView(UserId, StringUniqueNetIdTypes, PlatformIdStorage);
+
+	const TSharedPtr<FAccelByteUserInfo> FoundUserInfo = FindByPlatformKey(FPlatformUserKeyView(PlatformType, PlatformId), true);
+	MarkForRefreshIfStale(FoundUserInfo);
+	return FoundUserInfo;
+}
+
+FStringView FOnlineUserCacheAccelByte::GetPlatformIdView(const FUniqueNetId& UserId, const TSet<FName>& StringIdTypes, FString& OutIdStorage)
+{
+	if (StringIdTypes.Contains(UserId.GetType()))
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		return *FoundUserInfo;
+		// FUniqueNetIdString::ToString hands back a copy of this same string
+		const FString& IdString = static_cast<const FUniqueNetIdString&>(UserId).UniqueNetIdStr;
+		return FStringView(*IdString, IdString.Len());
 	}
 
-	return nullptr;
+	OutIdStorage = UserId.ToString();
+	return FStringView(*OutIdStorage, OutIdStorage.Len());
 }
 
 TSharedPtr<const FAccelByteUserInfo> FOnlineUserCacheAccelByte::GetUser(const FAccelByteUniqueIdComposite& UserId)
 {
-	// Lock while we access the cache
-	FScopeLock ScopeLock(&CacheLock);
-
 	// Start by checking the cache for the user associated with the AccelByte ID, if we have one to query
-	TSharedRef<FAccelByteUserInfo>* FoundUserInfo = nullptr;
+	TSharedPtr<FAccelByteUserInfo> FoundUserInfo = nullptr;
 	if (!UserId.Id.IsEmpty())
 	{
-		FoundUserInfo = AccelByteIdToUserInfoMap.Find(UserId.Id);
+		FoundUserInfo = FindByAccelByteId(UserId.Id, true);
 	}
 
 	// Next, if we didn't already find the user using the AccelByte ID, and we have platform type and ID try and query by that
-	if (FoundUserInfo == nullptr && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
+	if (!FoundUserInfo.IsValid() && (!UserId.PlatformType.IsEmpty() && !UserId.PlatformId.IsEmpty()))
 	{
-		const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(UserId.PlatformType, UserId.PlatformId);
-		FoundUserInfo = PlatformIdToUserInfoMap.Find(PlatformId);
+		FoundUserInfo = FindByPlatformKey(FPlatformUserKeyView(UserId.PlatformType, UserId.PlatformId), true);
 	}
 
-	if (FoundUserInfo != nullptr)
+	MarkForRefreshIfStale(FoundUserInfo);
+	return FoundUserInfo;
+}
+
+void FOnlineUserCacheAccelByte::AddUsersToCache(const TArray<TSharedRef<FAccelByteUserInfo>>& UsersQueried)
+{
+	AddUsersToCacheInternal(UsersQueried, true);
+
+	// Users made up by a fake backend must never outlive the run that made them, so only persist users from the live
+	// backend. Standalone caches, such as the ones benchmarks build, have no subsystem and never persist.
+	if (Subsystem == nullptr || !bIsPersistenceEnabled)
 	{
-		(*FoundUserInfo)->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
-		return *FoundUserInfo;
+		return;
 	}
 
-	return nullptr;
+	const IOnlineBackendAccelBytePtr Backend = Subsystem->GetBackend();
+	if (Backend.IsValid() && Backend->IsLiveBackend())
+	{
+		FScopeLock ScopeLock(&PersistLock);
+		UsersToPersist.Append(UsersQueried);
+	}
 }
 
-void FOnlineUserCacheAccelByte::AddUsersToCache(const TArray<TSharedRef<FAccelByteUserInfo>>& UsersQueried)
+int32 FOnlineUserCacheAccelByte::RemoveUsers(const TArray<FString>& AccelByteIds)
+{
+	int32 NumUsersRemoved = 0;
+	for (const FString& AccelByteId : AccelByteIds)
+	{
+		const TSharedPtr<FAccelByteUserInfo> User = FindByAccelByteId(AccelByteId, false);
+		if (User.IsValid() && RemoveUserIfUnchanged(AccelByteId, User.Get(), TNumericLimits<double>::Max()))
+		{
+			NumUsersRemoved++;
+		}
+	}
+
+	return NumUsersRemoved;
+}
+
+void FOnlineUserCacheAccelByte::AddUsersToCacheInternal(const TArray<TSharedRef<FAccelByteUserInfo>>& Users, bool bOverwriteExisting)
+{
+	// Bucket users by the shard that each of their keys belongs to first, so that we only take each shard's write lock
+	// once per batch rather than once per user
+	TArray<TPair<FString, TSharedRef<FAccelByteUserInfo>>> AccelByteIdEntries[NumShards];
+	for (const TSharedRef<FAccelByteUserInfo>& User : Users)
+	{
+		const FString& AccelByteId = User->Id->GetAccelByteId();
+		AccelByteIdEntries[GetShardIndex(AccelByteId)].Emplace(AccelByteId, User);
+	}
+
+	// Add to the AccelByte ID maps first, keeping track of which users made it in so that we only add platform mappings
+	// for those users
+	TArray<TPair<FPlatformUserKey, TSharedRef<FAccelByteUserInfo>>> PlatformIdEntries[NumShards];
+	TArray<TSharedRef<FAccelByteUserInfo>> AddedUsers;
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ShardIndex++)
+	{
+		if (AccelByteIdEntries[ShardIndex].Num() <= 0)
+		{
+			continue;
+		}
+
+		FUserCacheShard& Shard = Shards[ShardIndex];
+		FWriteScopeLock WriteLock(Shard.Lock);
+		for (const TPair<FString, TSharedRef<FAccelByteUserInfo>>& Entry : AccelByteIdEntries[ShardIndex])
+		{
+			TSharedRef<FAccelByteUserInfo>* ExistingUser = Shard.AccelByteIdToUserInfoMap.Find(Entry.Key);
+			if (ExistingUser != nullptr)
+			{
+				if (!bOverwriteExisting)
+				{
+					continue;
+				}
+
+				// A refreshed user should not lose importance given to them by an earlier query
+				Entry.Value->bIsImportant |= (*ExistingUser)->bIsImportant;
+				*ExistingUser = Entry.Value;
+			}
+			else
+			{
+				Shard.AccelByteIdToUserInfoMap.Add(Entry.Key, Entry.Value);
+				NumCachedUsers.Increment();
+			}
+			AddedUsers.Add(Entry.Value);
+
+			// Try and add the user to the platform mapping cache if they have platform information
+			const TSharedRef<FAccelByteUserInfo>& User = Entry.Value;
+			if (User->Id->HasPlatformInformation())
+			{
+				FPlatformUserKey PlatformKey(FPlatformUserKeyView(User->Id->GetPlatformType(), User->Id->GetPlatformId()));
+				const int32 PlatformShardIndex = GetShardIndex(PlatformKey.Hash);
+				PlatformIdEntries[PlatformShardIndex].Emplace(MoveTemp(PlatformKey), User);
+			}
+		}
+	}
+
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ShardIndex++)
+	{
+		if (PlatformIdEntries[ShardIndex].Num() <= 0)
+		{
+			continue;
+		}
+
+		FUserCacheShard& Shard = Shards[ShardIndex];
+		FWriteScopeLock WriteLock(Shard.Lock);
+		for (TPair<FPlatformUserKey, TSharedRef<FAccelByteUserInfo>>& Entry : PlatformIdEntries[ShardIndex])
+		{
+			Shard.PlatformIdToUserInfoMap.Add(MoveTemp(Entry.Key), Entry.Value);
+		}
+	}
+
+	// Any user we replaced leaves a dead entry behind in the timing wheel, which purging skips once it is reached
+	FScopeLock ScopeLock(&EvictionLock);
+	ScheduleEvictionLocked(AddedUsers);
+}
+
+void FOnlineUserCacheAccelByte::MarkForRefreshIfStale(const TSharedPtr<FAccelByteUserInfo>& User)
+{
+	if (User.IsValid() && User->bIsStale)
+	{
+		FScopeLock ScopeLock(&PersistLock);
+		StaleUsersToRefresh.Add(User->Id->GetAccelByteId());
+	}
+}
+
+void FOnlineUserCacheAccelByte::StartPersistentCacheLoad()
+{
+	bHasStartedPersistentLoad = true;
+
+	// Keep a separate file per namespace, so that switching environments never serves users from another one
+	PersistentCacheFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AccelByte"), FString::Printf(TEXT("UserCache_%s.bin"), *Subsystem->GetAppId()));
+
+	TWeakPtr<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Async(EAsyncExecution::ThreadPool, [WeakThis, FilePath = PersistentCacheFilePath, MaxStaleSeconds = PersistentEntryMaxStaleSeconds]() {
+		TArray<TSharedRef<FAccelByteUserInfo>> LoadedUsers;
+		LoadPersistentCacheFile(FilePath, MaxStaleSeconds, LoadedUsers);
+
+		const TSharedPtr<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe> StrongThis = WeakThis.Pin();
+		if (!StrongThis.IsValid())
+		{
+			return;
+		}
+
+		// Never replace users that were fetched while we were loading, they are fresher than anything on disk
+		StrongThis->AddUsersToCacheInternal(LoadedUsers, false);
+		StrongThis->bHasLoadedPersistentCache = true;
+	});
+}
+
+bool FOnlineUserCacheAccelByte::LoadPersistentCacheFile(const FString& FilePath, double MaxStaleSeconds, TArray<TSharedRef<FAccelByteUserInfo>>& OutUsers)
 {
-	for (const TSharedRef<FAccelByteUserInfo>& User : UsersQueried)
+	const int64 CurrentUnixTime = FDateTime::UtcNow().ToUnixTimestamp();
+	const int64 DiscardBeforeUnixTime = CurrentUnixTime - static_cast<int64>(MaxStaleSeconds);
+
+	TArray<FPersistentUserRecord> Records;
+	const int32 NumRecordsRead = ReadPersistentUserRecords(FilePath, DiscardBeforeUnixTime, Records);
+
+	// The file is append only, so rewrite it with just the live records once more than half of it is dead weight
+	const bool bShouldRewrite = NumRecordsRead > Records.Num() * 2;
+	if (bShouldRewrite)
 	{
-		// Add the user to the AccelByte ID mapping cache first
-		AccelByteIdToUserInfoMap.Add(User->Id->GetAccelByteId(), User);
+		WritePersistentUserRecords(FilePath, Records);
+	}
 
-		// Try and add the user to the platform mapping cache if they have platform information
-		if (User->Id->HasPlatformInformation())
+	OutUsers.Reserve(OutUsers.Num() + Records.Num());
+	int32 NumStaleUsers = 0;
+	for (const FPersistentUserRecord& Record : Records)
+	{
+		TSharedRef<FAccelByteUserInfo> User = MakeShared<FAccelByteUserInfo>();
+		User->Id = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(Record.AccelByteId, Record.PlatformType, Record.PlatformId));
+		if (!User->Id->IsValid())
 		{
-			const FString PlatformId = ConvertPlatformTypeAndIdToCacheKey(User->Id->GetPlatformType(), User->Id->GetPlatformId());
-			PlatformIdToUserInfoMap.Add(PlatformId, User);
+			continue;
 		}
+
+		User->DisplayName = Record.DisplayName;
+		User->PublicId = Record.PublicId;
+		User->bIsImportant = Record.bIsImportant;
+
+		// A user whose attributes we could not restore is still worth serving, just refresh them straight away
+		const bool bRestoredAttributes = DeserializePersistentUserAttributes(Record.CustomAttributes, User->CustomAttributes);
+		User->bIsStale = !bRestoredAttributes || Record.ExpiresAtUnixTime <= CurrentUnixTime;
+		User->LastAccessedTimeInSeconds = FPlatformTime::Seconds();
+		NumStaleUsers += User->bIsStale ? 1 : 0;
+		OutUsers.Add(User);
 	}
+
+	UE_LOG_AB(Verbose, TEXT("Loaded %d users from the persistent user cache at '%s', %d of which are stale"), Records.Num(), *FilePath, NumStaleUsers);
+	return bShouldRewrite;
+}
+
+void FOnlineUserCacheAccelByte::AppendToPersistentCacheFile(const FString& FilePath, const TArray<TSharedRef<FAccelByteUserInfo>>& Users, double TTLSeconds)
+{
+	const int64 ExpiresAtUnixTime = FDateTime::UtcNow().ToUnixTimestamp() + static_cast<int64>(TTLSeconds);
+	AppendPersistentUserRecords(FilePath, SerializePersistentUserRecords(Users, ExpiresAtUnixTime));
 }
 
-FString FOnlineUserCacheAccelByte::ConvertPlatformTypeAndIdToCacheKey(const FString& Type, const FString& Id) const
+void FOnlineUserCacheAccelByte::FlushPersistentCache(bool bIsSynchronous)
 {
-	const FString PlatformId = FString::Printf(TEXT("%s;%s"), *Type, *Id);
-	return PlatformId;
+	TArray<TSharedRef<FAccelByteUserInfo>> Users;
+	{
+		FScopeLock ScopeLock(&PersistLock);
+		Users = MoveTemp(UsersToPersist);
+		UsersToPersist.Reset();
+	}
+
+	if (Users.Num() <= 0)
+	{
+		return;
+	}
+
+	if (bIsSynchronous)
+	{
+		AppendToPersistentCacheFile(PersistentCacheFilePath, Users, PersistentEntryTTLSeconds);
+	}
+	else
+	{
+		const int64 ExpiresAtUnixTime = FDateTime::UtcNow().ToUnixTimestamp() + static_cast<int64>(PersistentEntryTTLSeconds);
+		TArray<uint8> RecordBytes = SerializePersistentUserRecords(Users, ExpiresAtUnixTime);
+		Async(EAsyncExecution::ThreadPool, [FilePath = PersistentCacheFilePath, RecordBytes = MoveTemp(RecordBytes)]() {
+			AppendPersistentUserRecords(FilePath, RecordBytes);
+		});
+	}
+}
+
+void FOnlineUserCacheAccelByte::RefreshStaleUsers()
+{
+	const FOnlineIdentityAccelBytePtr IdentityInterface = StaticCastSharedPtr<FOnlineIdentityAccelByte>(Subsystem->GetIdentityInterface());
+	const int32 LocalUserNum = Subsystem->GetLocalUserNumCached();
+	if (!IdentityInterface.IsValid() || IdentityInterface->GetLoginStatus(LocalUserNum) != ELoginStatus::LoggedIn)
+	{
+		// Leave stale users queued until someone is logged in to refresh them with
+		return;
+	}
+
+	TArray<FString> AccelByteIds;
+	{
+		FScopeLock ScopeLock(&PersistLock);
+		AccelByteIds = StaleUsersToRefresh.Array();
+		StaleUsersToRefresh.Reset();
+	}
+
+	if (AccelByteIds.Num() > 0)
+	{
+		Subsystem->CreateAndDispatchAsyncTaskParallel<FOnlineAsyncTaskAccelByteQueryUsersByIds>(Subsystem, LocalUserNum, MoveTemp(AccelByteIds), false, FOnQueryUsersComplete(), true);
+	}
+}
+
+FOnlineUserCacheAccelByte::~FOnlineUserCacheAccelByte()
+{
+	if (bIsPersistenceEnabled && bHasLoadedPersistentCache)
+	{
+		FlushPersistentCache(true);
+	}
+}
+
+int32 FOnlineUserCacheAccelByte::GetShardIndex(const FString& Key)
+{
+	// FString hashing is case insensitive, matching how the shard maps compare their keys
+	return GetShardIndex(GetTypeHash(Key));
+}
+
+int32 FOnlineUserCacheAccelByte::GetShardIndex(uint32 KeyHash)
+{
+	static_assert((NumShards & (NumShards - 1)) == 0, "NumShards must be a power of two");
+
+	// Shard maps bucket on the low bits of the same hash, so pick the shard from mixed high bits instead. Otherwise every
+	// key in a shard would share its low bits and only ever land in a fraction of that shard's map buckets.
+	return static_cast<int32>(((KeyHash * 0x9E3779B1u) >> 16) & (NumShards - 1));
+}
+
+TSharedPtr<FAccelByteUserInfo> FOnlineUserCacheAccelByte::FindByAccelByteId(const FString& AccelByteId, bool bUpdateAccessTime) const
+{
+	const FUserCacheShard& Shard = Shards[GetShardIndex(AccelByteId)];
+	FReadScopeLock ReadLock(Shard.Lock);
+
+	const TSharedRef<FAccelByteUserInfo>* FoundUserInfo = Shard.AccelByteIdToUserInfoMap.Find(AccelByteId);
+	if (FoundUserInfo == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (bUpdateAccessTime)
+	{
+		(*FoundUserInfo)->LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+	}
+	return *FoundUserInfo;
+}
+
+TSharedPtr<FAccelByteUserInfo> FOnlineUserCacheAccelByte::FindByPlatformKey(const FPlatformUserKeyView& PlatformKey, bool bUpdateAccessTime) const
+{
+	const FUserCacheShard& Shard = Shards[GetShardIndex(PlatformKey.Hash)];
+	FReadScopeLock ReadLock(Shard.Lock);
+
+	const TSharedRef<FAccelByteUserInfo>* FoundUserInfo = Shard.PlatformIdToUserInfoMap.FindByHash(PlatformKey.Hash, PlatformKey);
+	if (FoundUserInfo == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (bUpdateAccessTime)
+	{
+		(*FoundUserInfo)->LastAccessedTimeInSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+	}
+	return *FoundUserInfo;
 }
@@ -0,0 +1,159 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "OnlineUserIdRegistryAccelByte.h"
+#include "OnlineSubsystemAccelByte.h"
+
+#if AB_OSS_USER_ID_INTERNING_ENABLED
+namespace
+{
+	template <typename ObjectType, ESPMode Mode>
+	constexpr ESPMode GetSharedRefMode(const TSharedRef<ObjectType, Mode>*)
+	{
+		return Mode;
+	}
+}
+
+static_assert(GetSharedRefMode(static_cast<const FUniqueNetIdAccelByteUserRef*>(nullptr)) == ESPMode::ThreadSafe,
+	"Interned user IDs are shared across threads, so their reference count must be thread safe. Define AB_OSS_USER_ID_INTERNING_ENABLED as 0 to turn interning off.");
+#endif
+
+FUniqueNetIdAccelByteUserRef FOnlineUserIdRegistryAccelByte::FindOrCreate(const FAccelByteUniqueIdComposite& CompositeId)
+{
+	return FindOrCreate(CompositeId.Id, CompositeId.PlatformType, CompositeId.PlatformId);
+}
+
+FUniqueNetIdAccelByteUserRef FOnlineUserIdRegistryAccelByte::FindOrCreate(const FString& AccelByteId, const FString& PlatformType, const FString& PlatformId)
+{
+	if (AccelByteId.IsEmpty())
+	{
+		UE_LOG_AB(Warning, TEXT("Failed to get an interned FUniqueNetIdAccelByte as we don't have a value for the AccelByte ID!"));
+		return FUniqueNetIdAccelByteUser::Invalid();
+	}
+
+#if !AB_OSS_USER_ID_INTERNING_ENABLED
+	return FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, PlatformType, PlatformId));
+#else
+	// Fast path, we most likely already have this ID in use, so just take a read lock and hand it back
+	{
+		FRWScopeLock ReadLock(RegistryLock, SLT_ReadOnly);
+		const FUniqueNetIdAccelByteUserPtr FoundId = FindLocked(AccelByteId, PlatformType, PlatformId);
+		if (FoundId.IsValid())
+		{
+			return FoundId.ToSharedRef();
+		}
+	}
+
+	// Create the ID outside of the lock, as encoding the composite is the expensive part of this operation
+	const FUniqueNetIdAccelByteUserRef NewId = FUniqueNetIdAccelByteUser::Create(FAccelByteUniqueIdComposite(AccelByteId, PlatformType, PlatformId));
+	if (!NewId->IsValid())
+	{
+		// Do not intern invalid IDs, just hand them back to the caller as-is
+		return NewId;
+	}
+
+	FRWScopeLock WriteLock(RegistryLock, SLT_Write);
+
+	// Another thread may have registered this ID while we were creating ours, if so prefer theirs
+	const FUniqueNetIdAccelByteUserPtr FoundId = FindLocked(AccelByteId, PlatformType, PlatformId);
+	if (FoundId.IsValid())
+	{
+		return FoundId.ToSharedRef();
+	}
+
+	TArray<FEntry, TInlineAllocator<1>>& Entries = EntryMap.FindOrAdd(AccelByteId);
+
+	// Reuse a stale slot for this platform pair if there is one, otherwise add a new variant
+	FEntry* ExistingEntry = Entries.FindByPredicate([&PlatformType, &PlatformId](const FEntry& Entry) {
+		return Entry.PlatformType.Equals(PlatformType, ESearchCase::CaseSensitive) && Entry.PlatformId.Equals(PlatformId, ESearchCase::CaseSensitive);
+	});
+
+	if (ExistingEntry != nullptr)
+	{
+		ExistingEntry->Id = NewId;
+	}
+	else
+	{
+		Entries.Add(FEntry{PlatformType, PlatformId, NewId});
+	}
+
+	// Sweep stale entries once we have inserted as many entries as are in the map, this keeps the cost of sweeping
+	// amortized to a constant per insertion
+	InsertionsSinceLastSweep++;
+	if (InsertionsSinceLastSweep >= FMath::Max(EntryMap.Num(), MinInsertionsBetweenSweeps))
+	{
+		RemoveStaleEntriesLocked();
+	}
+
+	return NewId;
+#endif
+}
+
+int32 FOnlineUserIdRegistryAccelByte::Num() const
+{
+#if !AB_OSS_USER_ID_INTERNING_ENABLED
+	return 0;
+#else
+	FRWScopeLock ReadLock(RegistryLock, SLT_ReadOnly);
+
+	int32 EntryCount = 0;
+	for (const TPair<FString, TArray<FEntry, TInlineAllocator<1>>>& Pair : EntryMap)
+	{
+		EntryCount += Pair.Value.Num();
+	}
+
+	return EntryCount;
+#endif
+}
+
+int32 FOnlineUserIdRegistryAccelByte::RemoveStaleEntries()
+{
+#if !AB_OSS_USER_ID_INTERNING_ENABLED
+	return 0;
+#else
+	FRWScopeLock WriteLock(RegistryLock, SLT_Write);
+	return RemoveStaleEntriesLocked();
+#endif
+}
+
+#if AB_OSS_USER_ID_INTERNING_ENABLED
+FUniqueNetIdAccelByteUserPtr FOnlineUserIdRegistryAccelByte::FindLocked(const FString& AccelByteId, const FString& PlatformType, const FString& PlatformId) const
+{
+	const TArray<FEntry, TInlineAllocator<1>>* Entries = EntryMap.Find(AccelByteId);
+	if (Entries == nullptr)
+	{
+		return nullptr;
+	}
+
+	for (const FEntry& Entry : *Entries)
+	{
+		if (Entry.PlatformType.Equals(PlatformType, ESearchCase::CaseSensitive) && Entry.PlatformId.Equals(PlatformId, ESearchCase::CaseSensitive))
+		{
+			return Entry.Id.Pin();
+		}
+	}
+
+	return nullptr;
+}
+
+int32 FOnlineUserIdRegistryAccelByte::RemoveStaleEntriesLocked()
+{
+	int32 EntriesRemoved = 0;
+	for (auto EntryIt = EntryMap.CreateIterator(); EntryIt; ++EntryIt)
+	{
+		EntriesRemoved += EntryIt.Value().RemoveAll([](const FEntry& Entry) {
+			return !Entry.Id.IsValid();
+		});
+
+		if (EntryIt.Value().Num() <= 0)
+		{
+			EntryIt.RemoveCurrent();
+		}
+	}
+
+	InsertionsSinceLastSweep = 0;
+	return EntriesRemoved;
+}
+
+#endif
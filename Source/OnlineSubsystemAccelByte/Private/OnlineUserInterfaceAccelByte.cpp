@@ -12,6 +12,9 @@
 #include "Api/AccelByteUserProfileApi.h"
 #include "ExecTests/ExecTestQueryExternalIds.h"
 #include "ExecTests/ExecTestQueryUserIdMapping.h"
+#include "ExecTests/ExecTestUserCachePersistence.h"
+#include "ExecTests/ExecTestPlatformUserIdKey.h"
+#include "ExecTests/ExecTestUserQueryPartialFailure.h"
 #include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUserInfo.h"
 #include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryUserIdMapping.h"
 #include "AsyncTasks/User/OnlineAsyncTaskAccelByteQueryExternalIdMappings.h"
@@ -219,6 +222,37 @@ bool FOnlineUserAccelByte::TestExec(UWorld* InWorld, const TCHAR* Cmd, FOutputDe
 		AccelByteSubsystem->AddExecTest(QueryUserIdMappingTest);
 		bWasHandled = true;
 	}
+	else if (FParse::Command(&Cmd, TEXT("CACHEFILE")))
+	{
+		// Full command to test loading and compacting the persistent user cache file is ONLINE TEST USER CACHEFILE <Users>
+		const int32 NumUsers = FCString::Atoi(*FParse::Token(Cmd, false));
+
+		TSharedPtr<FExecTestUserCachePersistence> CacheFileTest = MakeShared<FExecTestUserCachePersistence>(InWorld, ACCELBYTE_SUBSYSTEM, (NumUsers > 0) ? NumUsers : 100);
+		CacheFileTest->Run();
+
+		AccelByteSubsystem->AddExecTest(CacheFileTest);
+		bWasHandled = true;
+	}
+	else if (FParse::Command(&Cmd, TEXT("PLATFORMID")))
+	{
+		// Full command to test the strings platform unique IDs are looked up by is ONLINE TEST USER PLATFORMID
+		TSharedPtr<FExecTestPlatformUserIdKey> PlatformIdTest = MakeShared<FExecTestPlatformUserIdKey>(InWorld, ACCELBYTE_SUBSYSTEM);
+		PlatformIdTest->Run();
+
+		AccelByteSubsystem->AddExecTest(PlatformIdTest);
+		bWasHandled = true;
+	}
+#if AB_OSS_FAKE_BACKEND_ENABLED
+	else if (FParse::Command(&Cmd, TEXT("PARTIALFAILURE")))
+	{
+		// Full command to test user queries where only some chunks fail is ONLINE TEST USER PARTIALFAILURE
+		TSharedPtr<FExecTestUserQueryPartialFailure> PartialFailureTest = MakeShared<FExecTestUserQueryPartialFailure>(InWorld, ACCELBYTE_SUBSYSTEM);
+		PartialFailureTest->Run();
+
+		AccelByteSubsystem->AddExecTest(PartialFailureTest);
+		bWasHandled = true;
+	}
+#endif
 
 	return bWasHandled;
 }
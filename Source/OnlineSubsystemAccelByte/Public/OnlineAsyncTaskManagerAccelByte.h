@@ -7,7 +7,61 @@
 #include "OnlineAsyncTaskManager.h"
 
 class FOnlineSubsystemAccelByte;
+class FOnlineAsyncTaskAccelByte;
+class FOnlineAsyncTaskWorkerAccelByte;
+class FOnlineAsyncTaskMetricsAccelByte;
 
+/**
+ * Priority classes that our parallel tasks are scheduled in, highest first
+ */
+enum class EAccelByteAsyncTaskPriority : uint8
+{
+	High = 0, // Latency critical tasks a player is actively waiting on, such as joining a game session
+	Normal, // Everything that does not pick a priority
+	Low, // Background work that can wait, such as paging through the store catalogue
+	Num
+};
+
+ONLINESUBSYSTEMACCELBYTE_API const TCHAR* LexToString(EAccelByteAsyncTaskPriority Priority);
+
+/**
+ * Async task manager for the AccelByte OSS.
+ * 
+ * By default this behaves just like the base manager, ticking every parallel task from the single online thread. Setting
+ * `AsyncTaskWorkerThreadCount` in the `OnlineSubsystemAccelByte` settings to more than zero instead spreads parallel task
+ * ticks across a pool of that many worker threads, plus the online thread itself. Each worker has its own queue and
+ * steals from the others once it runs dry.
+ * 
+ * Parallel tasks that share an ordering key (see FOnlineAsyncTaskAccelByte::GetOrderingKey) are grouped into a single
+ * unit of work, so that they are never ticked at the same time and always tick in the order they were dispatched. Serial
+ * tasks are still run one at a time from the online thread.
+ * 
+ * Our own parallel tasks are only ticked when they need it (see FOnlineAsyncTaskAccelByte::ShouldTick), and the online
+ * thread sleeps until a task asks for a tick or one is due, rather than waking on a fixed polling interval. Idle tasks
+ * are still ticked every `AsyncTaskIdleTickIntervalSeconds` as a safety net, which defaults to one second.
+ * 
+ * Our own parallel tasks are also scheduled by priority class (see EAccelByteAsyncTaskPriority). Each class may limit how
+ * many of its tasks are in flight at once, through `AsyncTaskMaxInFlightNormalPriority` and
+ * `AsyncTaskMaxInFlightLowPriority`, where zero means no limit. No class is limited by default, and high priority tasks
+ * never are, so that limiting the classes below keeps background work from crowding the backend connection while
+ * something latency critical is waiting. Tasks over the limit wait in a queue for their class, and are started in
+ * dispatch order from the game thread as earlier tasks of the same class finish. As every limit is at least one task, and tasks only
+ * wait on tasks of their own class, each class always makes progress no matter how busy the classes above it are. Work
+ * items are also ticked highest priority first.
+ * 
+ * Setting `bEnableAsyncTaskDeduplication` in the `OnlineSubsystemAccelByte` settings also merges identical parallel tasks
+ * for task types that opt in (see FOnlineAsyncTaskAccelByte::GetDeduplicationArguments). A task dispatched while an
+ * identical one is still in flight never starts, and instead triggers its delegates with the results of the first.
+ * 
+ * Finished tasks are finalized and have their delegates triggered from GameTick, highest priority class first and in
+ * the order they finished within each class. Setting `AsyncTaskGameThreadBudgetMs` in the `OnlineSubsystemAccelByte`
+ * settings limits how long GameTick spends on this each frame, carrying whatever is left over to the following frames,
+ * and paying back any time overspent by a slow task out of the budget of the next frame. At least one task is finalized
+ * every frame regardless, so nothing is held back forever. Zero, the default, finalizes everything in a single frame.
+ * 
+ * Our own tasks are also timed as they move through the manager, and reported to the subsystem's async task metrics
+ * (see FOnlineAsyncTaskMetricsAccelByte) once the game thread is done with them, along with the time spent in GameTick.
+ */
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineAsyncTaskManagerAccelByte : public FOnlineAsyncTaskManager
 {
 public:
@@ -15,13 +69,216 @@ public:
 	/** Constructor to set up the cached parent subsystem for this manager instance */
 	FOnlineAsyncTaskManagerAccelByte(FOnlineSubsystemAccelByte* ParentSubsystem);
 
-	virtual ~FOnlineAsyncTaskManagerAccelByte() = default;
+	virtual ~FOnlineAsyncTaskManagerAccelByte();
 
 	void OnlineTick() override;
 
+	//~ Begin FRunnable Interface
+	virtual bool Init() override;
+	virtual void Stop() override;
+	virtual void Exit() override;
+	//~ End FRunnable Interface
+
+	//~ Begin FSingleThreadRunnable Interface
+	virtual void Tick() override;
+	//~ End FSingleThreadRunnable Interface
+
+	/**
+	 * Finalize and trigger delegates for finished tasks, highest priority first, until the game thread budget for the
+	 * frame runs out, reporting metrics for each of our own tasks. Replaces the base manager's GameTick, which the
+	 * subsystem calls through this type.
+	 */
+	void GameTick();
+
+	using FOnlineAsyncTaskManager::AddToParallelTasks;
+
+	/**
+	 * Add one of our own tasks to the parallel tasks, tracking it so that the worker pool can respect its ordering key.
+	 * If the task's priority class is at its in flight limit, the task waits and is started later from the game thread.
+	 */
+	void AddToParallelTasks(FOnlineAsyncTaskAccelByte* NewTask);
+
+	using FOnlineAsyncTaskManager::AddToInQueue;
+
+	/**
+	 * Add one of our own tasks to the serial in queue, tracking it so that its metrics are reported once it finishes.
+	 */
+	void AddToInQueue(FOnlineAsyncTaskAccelByte* NewTask);
+
+	/**
+	 * Wake the online thread so that it ticks right away, used by tasks asking to be ticked. Safe to call from any thread.
+	 */
+	void WakeOnlineThread();
+
 private:
 
+	friend class FOnlineAsyncTaskWorkerAccelByte;
+
 	/** Pointer to subsystem instance that constructed this manager */
 	FOnlineSubsystemAccelByte* AccelByteSubsystem;
 
+	/** Number of worker threads to tick parallel tasks from, zero to tick everything from the online thread */
+	int32 NumWorkerThreads = 0;
+
+	/** Longest time in seconds that one of our parallel tasks goes without a tick, even when it has not asked for one */
+	double IdleTickIntervalSeconds = 1.0;
+
+	/** Polling interval that the base manager started with, used whenever there is work that we cannot wait on */
+	uint32 DefaultPollingInterval = 0;
+
+	/** Queue of work item indices owned by a single thread, which other threads may steal from */
+	struct FWorkQueue
+	{
+		FCriticalSection Lock;
+		TArray<int32> WorkItemIndices;
+	};
+
+	/** One queue per worker, with the last belonging to the online thread */
+	TArray<TUniquePtr<FWorkQueue>> WorkQueues;
+
+	/** Worker runnables, owned alongside the threads running them */
+	TArray<TUniquePtr<FOnlineAsyncTaskWorkerAccelByte>> Workers;
+
+	/** Threads running each worker */
+	TArray<TUniquePtr<FRunnableThread>> WorkerThreads;
+
+	/**
+	 * Units of work for the current tick, each a run of tasks that must be ticked in order on one thread. Only written by
+	 * the online thread while no work is queued.
+	 */
+	TArray<TArray<FOnlineAsyncTask*, TInlineAllocator<4>>> WorkItems;
+
+	/** Number of work items from the current tick that have not finished yet */
+	FThreadSafeCounter NumPendingWorkItems;
+
+	/** Event triggered once the last work item of a tick finishes */
+	FEvent* WorkItemsCompleteEvent = nullptr;
+
+	/** Lock guarding AccelByteTasks */
+	FCriticalSection AccelByteTasksLock;
+
+	/**
+	 * Tasks that were added as FOnlineAsyncTaskAccelByte, and so can be ticked on demand, ordered by key and report
+	 * metrics. Tasks stay in here until the game thread is done with them. Each is mapped to the index of the priority
+	 * class that it holds an in flight slot in, or INDEX_NONE for serial tasks.
+	 */
+	TMap<const FOnlineAsyncTask*, int32> AccelByteTasks;
+
+	/** Lock guarding the priority class state below */
+	FCriticalSection PriorityLock;
+
+	/** Most tasks of each priority class that may be in flight at once, zero for no limit. Only ever set from config. */
+	int32 MaxInFlightTasks[static_cast<int32>(EAccelByteAsyncTaskPriority::Num)] = {};
+
+	/** Tasks of each priority class that have been started and not yet finished by the game thread */
+	int32 NumInFlightTasks[static_cast<int32>(EAccelByteAsyncTaskPriority::Num)] = {};
+
+	/** Tasks of each priority class waiting on an in flight slot, in dispatch order */
+	TArray<FOnlineAsyncTaskAccelByte*> WaitingTasks[static_cast<int32>(EAccelByteAsyncTaskPriority::Num)];
+
+	/** Whether identical tasks are merged, read from config on construction */
+	bool bIsDeduplicationEnabled = false;
+
+	/** Task that others with the same key are merged into, along with the tasks merged into it so far */
+	struct FDeduplicatedTask
+	{
+		FString Key;
+		TArray<FOnlineAsyncTaskAccelByte*> Duplicates;
+	};
+
+	/** Lock guarding the deduplication state below */
+	FCriticalSection DeduplicationLock;
+
+	/** In flight task for each deduplication key */
+	TMap<FString, FOnlineAsyncTaskAccelByte*> DeduplicationKeyToTask;
+
+	/** Deduplication state for each in flight task with a key, until the game thread picks the task up */
+	TMap<const FOnlineAsyncTask*, FDeduplicatedTask> DeduplicatedTasks;
+
+	/** Longest time in seconds that GameTick spends finalizing tasks each frame, zero for no limit */
+	double GameThreadBudgetSeconds = 0.0;
+
+	/** Time overspent by GameTick in earlier frames, taken out of the budget of the following frames */
+	double GameThreadBudgetDebtSeconds = 0.0;
+
+	/** Finished items waiting on the game thread for a single priority class, first in first out */
+	struct FGameThreadQueue
+	{
+		TArray<FOnlineAsyncItem*> Items;
+
+		/** Index of the next item to finalize, items before it have already been taken */
+		int32 Head = 0;
+
+		int32 Num() const
+		{
+			return Items.Num() - Head;
+		}
+	};
+
+	/**
+	 * Items taken from the out queue that have yet to be finalized, one queue per priority class, including any carried
+	 * over from earlier frames. Items that are not our own tasks go in with normal priority. Game thread only.
+	 */
+	FGameThreadQueue GameThreadQueues[static_cast<int32>(EAccelByteAsyncTaskPriority::Num)];
+
+	/** Metrics that our tasks are reported to, cached from the subsystem */
+	TSharedPtr<FOnlineAsyncTaskMetricsAccelByte, ESPMode::ThreadSafe> Metrics;
+
+	/** Spin up the worker pool, if configured */
+	void StartWorkers();
+
+	/** Stop and join every worker thread */
+	void StopWorkers();
+
+	/** Name for trace events covering the given phase of a task, only used while the trace channel is on */
+	FString GetTraceEventName(const FOnlineAsyncTask* Task, const TCHAR* Phase);
+
+	/** Tick a single parallel task, wrapped in a trace event */
+	void TickTask(FOnlineAsyncTask* Task);
+
+	/**
+	 * Merge a task into an identical task already in flight, if deduplication is enabled and the task opts into it.
+	 * Otherwise the task becomes the one that later identical tasks are merged into.
+	 * 
+	 * @return true if the task was merged, in which case it must not be started
+	 */
+	bool TryMergeDuplicateTask(FOnlineAsyncTaskAccelByte* NewTask);
+
+	/** Stop merging into a task, returning every task merged into it so far. Game thread only. */
+	TArray<FOnlineAsyncTaskAccelByte*> TakeDuplicateTasks(const FOnlineAsyncTask* Task);
+
+	/** Initialize a parallel task that holds an in flight slot, and hand it over to the online thread */
+	void StartParallelTask(FOnlineAsyncTaskAccelByte* Task);
+
+	/** Move every item in the out queue into the game thread queue for its priority class. Game thread only. */
+	void TakeOutQueueItems();
+
+	/** Take the next item to finalize from the highest priority game thread queue, or nullptr if all are empty */
+	FOnlineAsyncItem* PopGameThreadItem();
+
+	/** Number of items across every game thread queue */
+	int32 GetNumGameThreadItems() const;
+
+	/** Finalize and trigger delegates for a single finished item, then delete it. Game thread only. */
+	void FinalizeItem(FOnlineAsyncItem* Item);
+
+	/** Free the in flight slot held by a finished task, then start any waiting tasks that now fit. Game thread only. */
+	void ReleasePrioritySlot(int32 PriorityIndex);
+
+	/** Group parallel tasks into work items by ordering key, highest priority first, replacing the current work items */
+	void BuildWorkItems(const TArray<FOnlineAsyncTask*>& TasksToTick);
+
+	/** Whether a serial task is queued or running, which the base manager can only poll */
+	bool HasSerialWork();
+
+	/** Spread the current work items across every queue, highest priority first in each */
+	void QueueWorkItems();
+
+	/**
+	 * Run one work item from the given queue, or stolen from another queue if that one is empty.
+	 * 
+	 * @return false if there was no work left to run in any queue
+	 */
+	bool TryRunWorkItem(int32 QueueIndex);
+
 };
@@ -0,0 +1,241 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelBytePackage.h"
+
+/**
+ * Stages of an async task's life that we measure latency for, each the time between two of the task's timestamps
+ */
+enum class EAccelByteAsyncTaskStage : uint8
+{
+	Queue = 0, // Dispatched until Initialize starts, only really meaningful for serial tasks waiting in the in queue
+	Request, // Initialize returned, having sent its first request, until the first response came back for the task
+	Work, // Initialize starts until the task is marked complete
+	Handoff, // Task marked complete until the game thread picks it up to run Finalize
+	Finalize, // Time spent in Finalize on the game thread
+	Delegates, // Time spent in TriggerDelegates on the game thread
+	Total, // Dispatched until TriggerDelegates returns
+	Num
+};
+
+ONLINESUBSYSTEMACCELBYTE_API const TCHAR* LexToString(EAccelByteAsyncTaskStage Stage);
+
+/**
+ * Timestamps recorded over the life of a single async task, in FPlatformTime::Seconds. Any timestamp that the task never
+ * reached is left at zero, and any stage ending in or starting from such a timestamp is left out of the metrics.
+ */
+struct FAccelByteAsyncTaskTimestamps
+{
+	double Queued = 0.0;
+	double Initialized = 0.0;
+	double RequestSent = 0.0;
+	double ResponseReceived = 0.0;
+	double Completed = 0.0;
+	double FinalizeStarted = 0.0;
+	double DelegatesStarted = 0.0;
+	double Done = 0.0;
+};
+
+/**
+ * Latency percentiles for one stage of a task, all in seconds. Percentiles are approximate, reported as the upper bound
+ * of the histogram bucket that they fall in, which is within 25% of the real value.
+ */
+struct FAccelByteLatencySummary
+{
+	int32 Count = 0;
+	double MeanSeconds = 0.0;
+	double P50Seconds = 0.0;
+	double P95Seconds = 0.0;
+	double P99Seconds = 0.0;
+	double MaxSeconds = 0.0;
+};
+
+/**
+ * Aggregated metrics for every task sharing a task name
+ */
+struct FAccelByteAsyncTaskStats
+{
+	FString TaskName;
+	int32 NumCompleted = 0;
+	int32 NumSucceeded = 0;
+	int32 NumTimedOut = 0;
+	FAccelByteLatencySummary Stages[static_cast<int32>(EAccelByteAsyncTaskStage::Num)];
+};
+
+/**
+ * Depth of each of the task manager's queues, both as last sampled and the highest seen since the last reset
+ */
+struct FAccelByteAsyncTaskQueueStats
+{
+	int32 NumParallelTasks = 0;
+	int32 MaxParallelTasks = 0;
+	int32 NumSerialTasks = 0;
+	int32 MaxSerialTasks = 0;
+	int32 NumOutQueueItems = 0;
+	int32 MaxOutQueueItems = 0;
+};
+
+/**
+ * Time the OSS spends on the game thread each frame, as percentiles over every frame since the last reset
+ */
+struct FAccelByteGameThreadStats
+{
+	/** Time spent in the subsystem's tick, covering everything the OSS does on the game thread each frame */
+	FAccelByteLatencySummary FrameTime;
+
+	/** Part of the frame time spent finalizing tasks and triggering their delegates */
+	FAccelByteLatencySummary TaskTime;
+
+	/** Number of frames that spent longer on tasks than the game thread budget allows */
+	int32 NumFramesOverBudget = 0;
+
+	/** Number of frames that left finished tasks over for a later frame */
+	int32 NumFramesWithCarryOver = 0;
+
+	/** Finished tasks left over for a later frame, both as of the last frame and the most seen since the last reset */
+	int32 NumCarriedOverTasks = 0;
+	int32 MaxCarriedOverTasks = 0;
+};
+
+/**
+ * Latency and throughput metrics for our async tasks, owned by the subsystem.
+ *
+ * The task manager reports every task as the game thread finishes with it, and the metrics are aggregated per task name
+ * into a log-scale histogram per stage, so that memory use does not grow with the number of tasks run. Queue depths are
+ * sampled by the task manager on each tick, and game thread time is sampled by the subsystem and task manager each frame.
+ *
+ * Enabled by default, set `bEnableAsyncTaskMetrics` in the `OnlineSubsystemAccelByte` settings to false to turn off.
+ * Current metrics can be dumped with the `ONLINE TASKSTATS` console command, adding `RESET` clears them afterwards.
+ *
+ * All methods are thread safe.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineAsyncTaskMetricsAccelByte
+{
+public:
+	/**
+	 * Whether metrics are being collected. When disabled, every record call is a no-op.
+	 */
+	bool IsEnabled() const
+	{
+		return bIsEnabled;
+	}
+
+	/**
+	 * Add a finished task to the metrics for its name.
+	 *
+	 * @param TaskName Name of the task, as returned from its GetTaskName
+	 * @param Timestamps Timestamps recorded over the life of the task
+	 * @param bWasSuccessful Whether the task finished successfully
+	 * @param bTimedOut Whether the task finished by timing out
+	 */
+	void RecordTask(const FString& TaskName, const FAccelByteAsyncTaskTimestamps& Timestamps, bool bWasSuccessful, bool bTimedOut);
+
+	/**
+	 * Sample the depth of the parallel tasks and the serial in queue
+	 */
+	void RecordTaskQueueDepth(int32 NumParallelTasks, int32 NumSerialTasks);
+
+	/**
+	 * Sample the depth of the out queue waiting on the game thread
+	 */
+	void RecordOutQueueDepth(int32 NumOutQueueItems);
+
+	/**
+	 * Sample the time the task manager spent finalizing tasks on the game thread this frame
+	 *
+	 * @param TaskSeconds Time spent finalizing tasks and triggering their delegates
+	 * @param NumCarriedOverTasks Number of finished tasks left over for a later frame
+	 * @param bWasOverBudget Whether the time spent went over the game thread budget
+	 */
+	void RecordGameTick(double TaskSeconds, int32 NumCarriedOverTasks, bool bWasOverBudget);
+
+	/**
+	 * Sample the time the subsystem's tick took on the game thread this frame
+	 */
+	void RecordGameThreadFrame(double FrameSeconds);
+
+	/**
+	 * Get the aggregated metrics for every task name that has finished since the last reset, slowest total time first
+	 */
+	TArray<FAccelByteAsyncTaskStats> GetTaskStats() const;
+
+	/**
+	 * Get the sampled depth of each of the task manager's queues
+	 */
+	FAccelByteAsyncTaskQueueStats GetQueueStats() const;
+
+	/**
+	 * Get the sampled game thread time of the OSS
+	 */
+	FAccelByteGameThreadStats GetGameThreadStats() const;
+
+	/**
+	 * Clear every metric collected so far
+	 */
+	void Reset();
+
+	/**
+	 * Write a table of the current metrics to the output device passed in
+	 */
+	void Dump(FOutputDevice& Ar) const;
+
+PACKAGE_SCOPE:
+	FOnlineAsyncTaskMetricsAccelByte();
+
+private:
+	/**
+	 * Histogram of latencies in log-scale buckets, each 25% wider than the last, starting at 10 microseconds. Eighty
+	 * buckets cover anything up to several minutes, and anything slower lands in the last bucket.
+	 */
+	class FLatencyHistogram
+	{
+	public:
+		void Add(double Seconds);
+		FAccelByteLatencySummary Summarize() const;
+
+	private:
+		static constexpr int32 NumBuckets = 80;
+
+		uint32 Buckets[NumBuckets] = {};
+		int32 Count = 0;
+		double SumSeconds = 0.0;
+		double MaxSeconds = 0.0;
+
+		double GetPercentile(double Percentile) const;
+	};
+
+	/** Metrics for every task sharing a name */
+	struct FTaskMetrics
+	{
+		int32 NumCompleted = 0;
+		int32 NumSucceeded = 0;
+		int32 NumTimedOut = 0;
+		FLatencyHistogram Stages[static_cast<int32>(EAccelByteAsyncTaskStage::Num)];
+	};
+
+	/** Whether metrics are being collected, read from config on construction */
+	bool bIsEnabled = true;
+
+	/** Lock guarding all metrics below */
+	mutable FCriticalSection MetricsLock;
+
+	/** Metrics for each task name */
+	TMap<FString, FTaskMetrics> TaskMetrics;
+
+	/** Sampled depth of the task manager's queues */
+	FAccelByteAsyncTaskQueueStats QueueStats;
+
+	/** Time spent in the subsystem's tick per frame */
+	FLatencyHistogram GameThreadFrameTime;
+
+	/** Time spent finalizing tasks per frame */
+	FLatencyHistogram GameThreadTaskTime;
+
+	/** Game thread counters, the summaries in here are filled in from the histograms when requested */
+	FAccelByteGameThreadStats GameThreadStats;
+
+};
@@ -0,0 +1,87 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteApiClient.h"
+#include "Core/AccelByteError.h"
+#include "JsonObjectWrapper.h"
+#include "Models/AccelByteUserModels.h"
+#include "Models/AccelByteSessionModels.h"
+#include "Models/AccelByteLobbyModels.h"
+
+/**
+ * Layer between our async tasks and the SDK, that tasks send backend requests through rather than calling the API on
+ * their API client directly. The subsystem owns the backend, which by default forwards every request to the SDK, and can
+ * swap in a fake backend that answers requests with scripted or recorded responses, so that task flows can be driven
+ * offline for benchmarking.
+ *
+ * Only requests that have been moved over to the backend layer are listed here, anything else still goes straight to
+ * the SDK. Same as with the SDK, handlers may be fired from any thread, and the API client passed in may be invalid for
+ * backends other than the live one.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API IOnlineBackendAccelByte
+{
+public:
+	virtual ~IOnlineBackendAccelByte() = default;
+
+	/**
+	 * Whether this backend forwards requests to the real AccelByte services
+	 */
+	virtual bool IsLiveBackend() const = 0;
+
+	/**
+	 * Tick the backend on the game thread, called from the subsystem's tick
+	 */
+	virtual void Tick(float DeltaTime)
+	{
+	}
+
+	/**
+	 * Whether this backend still has responses to deliver from its own tick. A backend swapped out while this is true keeps
+	 * being ticked by the subsystem until it has delivered them all.
+	 */
+	virtual bool HasPendingResponses() const
+	{
+		return false;
+	}
+
+	/**
+	 * Get basic user info for a list of AccelByte user IDs, see AccelByte::Api::User::BulkGetUserInfo
+	 */
+	virtual void BulkGetUserInfo(const AccelByte::FApiClientPtr& ApiClient, const TArray<FString>& UserIds, const THandler<FListBulkUserInfo>& OnSuccess, const FErrorHandler& OnError) = 0;
+
+	/**
+	 * Get the AccelByte user IDs linked to a list of platform user IDs, see AccelByte::Api::User::BulkGetUserByOtherPlatformUserIds
+	 */
+	virtual void BulkGetUserByOtherPlatformUserIds(const AccelByte::FApiClientPtr& ApiClient, EAccelBytePlatformType PlatformType, const TArray<FString>& PlatformUserIds, const THandler<FBulkPlatformUserIdResponse>& OnSuccess, const FErrorHandler& OnError) = 0;
+
+	/**
+	 * Query a page of game sessions, see AccelByte::Api::Session::QueryGameSessions
+	 */
+	virtual void QueryGameSessions(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteModelsV2GameSessionQuery& Query, const THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult>& OnSuccess, const FErrorHandler& OnError, int32 Offset, int32 Limit) = 0;
+
+	/**
+	 * Write to the storage of a V1 party, see AccelByte::Api::Lobby::WritePartyStorage
+	 */
+	virtual void WritePartyStorage(const AccelByte::FApiClientPtr& ApiClient, const FString& PartyId, TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PartyStorageWriter, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler& OnError) = 0;
+
+};
+
+/**
+ * Backend forwarding every request to the SDK through the API client passed in
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineBackendAccelByte : public IOnlineBackendAccelByte
+{
+public:
+	//~ Begin IOnlineBackendAccelByte Interface
+	virtual bool IsLiveBackend() const override;
+	virtual void BulkGetUserInfo(const AccelByte::FApiClientPtr& ApiClient, const TArray<FString>& UserIds, const THandler<FListBulkUserInfo>& OnSuccess, const FErrorHandler& OnError) override;
+	virtual void BulkGetUserByOtherPlatformUserIds(const AccelByte::FApiClientPtr& ApiClient, EAccelBytePlatformType PlatformType, const TArray<FString>& PlatformUserIds, const THandler<FBulkPlatformUserIdResponse>& OnSuccess, const FErrorHandler& OnError) override;
+	virtual void QueryGameSessions(const AccelByte::FApiClientPtr& ApiClient, const FAccelByteModelsV2GameSessionQuery& Query, const THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult>& OnSuccess, const FErrorHandler& OnError, int32 Offset, int32 Limit) override;
+	virtual void WritePartyStorage(const AccelByte::FApiClientPtr& ApiClient, const FString& PartyId, TFunction<FJsonObjectWrapper(FJsonObjectWrapper)> PartyStorageWriter, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess, const FErrorHandler& OnError) override;
+	//~ End IOnlineBackendAccelByte Interface
+
+};
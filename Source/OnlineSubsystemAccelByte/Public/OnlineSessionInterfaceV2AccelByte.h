@@ -17,16 +17,60 @@
 #include "OnlineSubsystemAccelByte.h"
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemAccelByteTypes.h"
+#include "OnlineSessionSettingsAccelByte.h"
 #include "Models/AccelByteMatchmakingModels.h"
 #include "Models/AccelByteDSHubModels.h"
 
 class FInternetAddr;
 class FNamedOnlineSession;
+class FOnlineSessionSearchCacheAccelByte;
+
+/**
+ * Change to the status of a single session member between two updates of the session's member list
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteSessionMemberChange
+{
+	/** Member as they are after the update. Members that were removed from the list are given the LEFT status. */
+	FAccelByteModelsV2SessionUser Member{};
+
+	/** Status that the member had before the update, only meaningful if bIsNewMember is false */
+	EAccelByteV2SessionMemberStatus PreviousStatus{};
+
+	/** Whether the member was missing from the member list before the update */
+	bool bIsNewMember{false};
+};
+
+/**
+ * Changes between two updates of a session's member list, with only the members whose status changed
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FAccelByteSessionMembersChangeSet
+{
+	/** Members that are now joined or connected to the session, and were not before */
+	TArray<FAccelByteSessionMemberChange> Joined{};
+
+	/** Members that were joined or connected to the session, and no longer are */
+	TArray<FAccelByteSessionMemberChange> Left{};
+
+	/** Members whose status changed in any other way, such as going from joined to connected, or being invited */
+	TArray<FAccelByteSessionMemberChange> StatusChanged{};
+
+	/** Whether no member's status changed in the update */
+	bool IsEmpty() const
+	{
+		return Joined.Num() == 0 && Left.Num() == 0 && StatusChanged.Num() == 0;
+	}
+};
 
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineSessionInfoAccelByteV2 : public FOnlineSessionInfo
 {
 public:
-	FOnlineSessionInfoAccelByteV2(const FString& SessionIdStr);
+	/**
+	 * Construct session info for the session ID passed in.
+	 * 
+	 * @param SessionIdStr ID of the session that this information is for
+	 * @param InUserIdRegistry Registry used to reuse member IDs across updates, if not set new IDs are created on each update
+	 */
+	FOnlineSessionInfoAccelByteV2(const FString& SessionIdStr, const FOnlineUserIdRegistryAccelBytePtr& InUserIdRegistry = nullptr);
 
 	//~ Begin FOnlineSessionInfo overrides
 	const FUniqueNetId& GetSessionId() const override;
@@ -84,11 +128,26 @@ PACKAGE_SCOPE:
 	 */
 	void UpdateLeaderId();
 
+	/**
+	 * Replace the members in the backend session data with a new member list from a notification. Members are matched to
+	 * the previous list by ID, and only the members whose status changed are patched into the joined and invited player
+	 * lists, rather than rebuilding both lists from scratch.
+	 *
+	 * @param NewMembers Full member list of the session after the update
+	 * @param OutChangeSet Members whose status changed between the previous list and the new one
+	 */
+	void UpdateMembers(const TArray<FAccelByteModelsV2SessionUser>& NewMembers, FAccelByteSessionMembersChangeSet& OutChangeSet);
+
 	/**
 	 * Update the stored connection information for this server.
 	 */
 	void UpdateConnectionInfo();
 
+	/**
+	 * Get an ID for a member of this session, reusing an existing ID instance from the user ID registry if we have one.
+	 */
+	FUniqueNetIdAccelByteUserRef GetMemberId(const FAccelByteModelsV2SessionUser& Member) const;
+
 private:
 	/**
 	 * Structure representing the session data on the backend, used for updating session data.
@@ -130,6 +189,11 @@ private:
 	 */
 	FUniqueNetIdPtr LeaderId{};
 
+	/**
+	 * Registry that member IDs are interned through, held weakly as the subsystem owns the registry.
+	 */
+	TWeakPtr<FOnlineUserIdRegistryAccelByte, ESPMode::ThreadSafe> UserIdRegistry{};
+
 };
 
 UENUM(BlueprintType)
@@ -291,6 +355,12 @@ typedef FOnMatchmakingExpired::FDelegate FOnMatchmakingExpiredDelegate;
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnBackfillProposalReceived, FAccelByteModelsV2MatchmakingBackfillProposalNotif /*Proposal*/);
 typedef FOnBackfillProposalReceived::FDelegate FOnBackfillProposalReceivedDelegate;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSessionMembersChanged, FName /*SessionName*/, const FAccelByteSessionMembersChangeSet& /*ChangeSet*/);
+typedef FOnSessionMembersChanged::FDelegate FOnSessionMembersChangedDelegate;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnFindSessionsResultsReceived, const TSharedRef<FOnlineSessionSearch>& /*SearchSettings*/, const TArray<FOnlineSessionSearchResult>& /*NewResults*/);
+typedef FOnFindSessionsResultsReceived::FDelegate FOnFindSessionsResultsReceivedDelegate;
 //~ End custom delegates
 
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineSessionV2AccelByte : public IOnlineSession, public TSharedFromThis<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe>
@@ -528,6 +598,21 @@ public:
 	 */
 	bool RefreshSession(const FName& SessionName, const FOnRefreshSessionComplete& Delegate);
 
+	/**
+	 * Register the schema of the session attributes that this game uses, ideally once at startup before any sessions are
+	 * created or found. Attributes in the schema are converted to and from session settings through lookup tables built
+	 * here, rather than working out their type and names on every conversion, and are read back with the type registered
+	 * rather than the closest JSON type. Registering a new schema replaces the previous one.
+	 *
+	 * @param Fields Name, type and array-ness of each session attribute, an empty array removes the schema
+	 */
+	void RegisterSessionAttributeSchema(const TArray<FSessionAttributeSchemaFieldAccelByte>& Fields);
+
+	/**
+	 * Get the session attribute schema registered through RegisterSessionAttributeSchema, or nullptr if there is none
+	 */
+	FOnlineSessionAttributeSchemaAccelBytePtr GetSessionAttributeSchema() const;
+
 	/**
 	 * Accept a backfill proposal from matchmaking. Which will then invite the players backfilled to your session.
 	 */
@@ -591,6 +676,25 @@ public:
 	 */
 	DEFINE_ONLINE_DELEGATE_ONE_PARAM(OnBackfillProposalReceived, FAccelByteModelsV2MatchmakingBackfillProposalNotif /*Proposal*/);
 
+	/**
+	 * Delegate fired when the member list of a game or party session is updated from a notification, with only the members
+	 * whose status changed. Fired after the session info has been updated, and after the participant change delegates.
+	 *
+	 * @param SessionName Name of the session that has had its members change
+	 * @param ChangeSet Members that joined, left, or otherwise changed status in the update
+	 */
+	DEFINE_ONLINE_DELEGATE_TWO_PARAM(OnSessionMembersChanged, FName /*SessionName*/, const FAccelByteSessionMembersChangeSet& /*ChangeSet*/);
+
+	/**
+	 * Delegate fired during FindSessions each time another page of results has been added to the search, in the order
+	 * the backend returns them, so that a server browser can show results before the whole search is done. Always
+	 * fired before OnFindSessionsComplete.
+	 *
+	 * @param SearchSettings Search that the results were added to
+	 * @param NewResults Results that were just appended to the search results
+	 */
+	DEFINE_ONLINE_DELEGATE_TWO_PARAM(OnFindSessionsResultsReceived, const TSharedRef<FOnlineSessionSearch>& /*SearchSettings*/, const TArray<FOnlineSessionSearchResult>& /*NewResults*/);
+
 #if (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION <= 25)
 	/**
 	 * Delegate fired when the members in a session have changed. From the UE 4.26+ base session interface delegates.
@@ -791,6 +895,77 @@ PACKAGE_SCOPE:
 	 * Read a JSON object into a session settings instance
 	 */
 	FOnlineSessionSettings ReadSessionSettingsFromJsonObject(const TSharedRef<FJsonObject>& Object) const;
+
+	/**
+	 * Swap in an already compiled session attribute schema, or nullptr to remove it
+	 */
+	void SetSessionAttributeSchema(const FOnlineSessionAttributeSchemaAccelBytePtr& InSchema);
+
+	/**
+	 * Queue an update of a session's settings on the backend. Only one update request is in flight for a session at a
+	 * time, and calls made while one is in flight, or within SessionUpdateCoalesceWindowSeconds of the first call, are
+	 * merged into a single request with the latest settings passed in. OnUpdateSessionComplete still fires once per call.
+	 */
+	void QueueSessionUpdate(const FName& SessionName, const FOnlineSessionSettings& UpdatedSessionSettings);
+
+	/**
+	 * Called by session update tasks once their request is done, to send the next update queued for the session, if any
+	 */
+	void OnSessionUpdateRequestComplete(const FName& SessionName);
+
+	/**
+	 * Diff a set of session attributes against the attributes last acknowledged by the backend
+	 *
+	 * @param BaseAttributes Attributes from the last session model received from the backend, may be nullptr
+	 * @param NewAttributes Attributes converted from the settings being sent
+	 * @param OutChangedAttributes Fields that were added or whose value changed
+	 * @param OutRemovedFields Names of fields in the base attributes that are missing from the new attributes
+	 */
+	static void DiffSessionAttributes(const TSharedPtr<FJsonObject>& BaseAttributes, const TSharedRef<FJsonObject>& NewAttributes, const TSharedRef<FJsonObject>& OutChangedAttributes, TArray<FString>& OutRemovedFields);
+
+	/**
+	 * Apply changed and removed attribute fields from DiffSessionAttributes on top of a copy of another set of attributes
+	 */
+	static TSharedRef<FJsonObject> MergeSessionAttributes(const TSharedPtr<FJsonObject>& BaseAttributes, const TSharedRef<FJsonObject>& ChangedAttributes, const TArray<FString>& RemovedFields);
+
+	/**
+	 * Whether session updates should only send the attributes that changed since the last acknowledged version
+	 */
+	bool ShouldSendSessionAttributeDeltas() const;
+
+	/**
+	 * Whether an error from a session update request means that the session was updated on the backend since the version
+	 * that the request was made against
+	 */
+	bool IsSessionVersionConflict(int32 ErrorCode) const;
+
+	/**
+	 * Most times a session update is merged into the latest backend version and retried after a version conflict
+	 */
+	int32 GetMaxSessionUpdateConflictRetries() const;
+
+	/**
+	 * Most pages of game session results that FindSessions requests from the backend at once
+	 */
+	int32 GetFindSessionsMaxConcurrentPages() const;
+
+	/**
+	 * Queue results found by FindSessions to be appended to the search and handed to OnFindSessionsResultsReceived on the
+	 * game thread. Safe to call from any thread.
+	 */
+	void QueueFindSessionsResultsReceived(const TSharedRef<FOnlineSessionSearch>& SearchSettings, TArray<FOnlineSessionSearchResult>&& NewResults);
+
+	/**
+	 * Append every batch of results queued so far to its search and fire OnFindSessionsResultsReceived with it. Called on
+	 * the game thread from our tick, and before a search is marked done, so that every batch is delivered before the
+	 * search completes.
+	 */
+	void FlushFindSessionsResultsReceived();
+
+	/**
+	 * Get the cache of sessions recently seen from the backend, shared by FindSessions, FindSessionById and invite lookups
+	 */
+	TSharedPtr<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe> GetSessionSearchCache() const;
 	
 	/**
 	 * Convert a session search parameters into a json object that can be used to fill match ticket attributes
@@ -834,6 +1009,58 @@ private:
 	/** Sessions stored in this interface, associated by session name */
 	TMap<FName, TSharedPtr<FNamedOnlineSession>> Sessions;
 
+	/** Critical section to lock the session attribute schema pointer while swapping or copying it */
+	mutable FCriticalSection SessionAttributeSchemaLock;
+
+	/** Schema of the session attributes used by the game, immutable once registered so that it can be read from any thread */
+	FOnlineSessionAttributeSchemaAccelBytePtr SessionAttributeSchema;
+
+	/** Session settings update that is waiting to be sent for a session, along with whether another is in flight */
+	struct FQueuedSessionUpdate
+	{
+		/** Whether an update request for the session is in flight */
+		bool bIsRequestInFlight{false};
+
+		/** Latest settings passed to UpdateSession that have yet to be sent, or nullptr if there are none */
+		TSharedPtr<FOnlineSessionSettings> PendingSettings{nullptr};
+
+		/** Number of UpdateSession calls merged into the pending settings */
+		int32 NumPendingCalls{0};
+
+		/** Time to send the pending settings at, in FPlatformTime::Seconds */
+		double DispatchTime{0.0};
+	};
+
+	/** Session settings updates that are queued or in flight, by session name. Only accessed on the game thread. */
+	TMap<FName, FQueuedSessionUpdate> QueuedSessionUpdates;
+
+	/** Whether session updates only send attributes that changed, requires the backend to merge attributes on update */
+	bool bSendSessionAttributeDeltas{false};
+
+	/** Time that UpdateSession calls are held for to be merged with later calls, zero to only merge calls made while a request is in flight */
+	double SessionUpdateCoalesceWindowSeconds{0.0};
+
+	/** Most times a session update is retried after a version conflict */
+	int32 MaxSessionUpdateConflictRetries{3};
+
+	/** Error code that the backend fails session updates with when the version sent is out of date */
+	int32 SessionVersionConflictErrorCode{409};
+
+	/** Most pages of game session results requested at once by FindSessions, one to request pages in sequence */
+	int32 FindSessionsMaxConcurrentPages{1};
+
+	/** Batches of search results waiting to be handed to OnFindSessionsResultsReceived, guarded by FindSessionsResultsLock */
+	TArray<TPair<TSharedRef<FOnlineSessionSearch>, TArray<FOnlineSessionSearchResult>>> PendingFindSessionsResults;
+	FCriticalSection FindSessionsResultsLock;
+
+	/** Sessions recently seen from the backend along with their converted search results */
+	TSharedPtr<FOnlineSessionSearchCacheAccelByte, ESPMode::ThreadSafe> SessionSearchCache;
+
+	/**
+	 * Send the pending settings of a queued session update through an update task
+	 */
+	void DispatchSessionUpdate(const FName& SessionName, FQueuedSessionUpdate& QueuedUpdate);
+
 	/** Flag denoting whether there is already a task in progress to get a session associated with a server */
 	bool bIsGettingServerClaimedSession{ false };
 
@@ -932,6 +1159,9 @@ protected:
 
 	// Making this async task a friend so that it can add new named sessions
 	friend class FOnlineAsyncTaskAccelByteGetServerClaimedV2Session;
+
+	// Making the fake backend a friend so that it can push lobby notifications through our handlers
+	friend class FOnlineFakeBackendAccelByte;
 };
 
 typedef TSharedPtr<FOnlineSessionV2AccelByte, ESPMode::ThreadSafe> FOnlineSessionV2AccelBytePtr;
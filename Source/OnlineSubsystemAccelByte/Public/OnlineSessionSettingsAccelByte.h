@@ -6,6 +6,9 @@
 
 #include "OnlineSessionSettings.h"
 
+class FJsonObject;
+class FJsonValue;
+
 enum class ESessionSettingsAccelByteArrayFieldType : uint8
 {
 	INVALID = 0,
@@ -13,6 +16,104 @@ enum class ESessionSettingsAccelByteArrayFieldType : uint8
 	DOUBLES
 };
 
+/**
+ * Description of a single session attribute, registered as part of a session attribute schema
+ */
+struct ONLINESUBSYSTEMACCELBYTE_API FSessionAttributeSchemaFieldAccelByte
+{
+	FSessionAttributeSchemaFieldAccelByte()
+	{
+	}
+
+	FSessionAttributeSchemaFieldAccelByte(const FName& InName, EOnlineKeyValuePairDataType::Type InType, bool bInIsArray = false)
+		: Name(InName)
+		, Type(InType)
+		, bIsArray(bInIsArray)
+	{
+	}
+
+	/** Name of the session setting that holds the attribute */
+	FName Name{};
+
+	/**
+	 * Type of the attribute's value, or of each item for array attributes. Bool, Int32, Int64, Float, Double and String
+	 * are supported, though arrays may only hold strings or doubles.
+	 */
+	EOnlineKeyValuePairDataType::Type Type{EOnlineKeyValuePairDataType::Empty};
+
+	/** Whether the attribute is an array, set with FOnlineSessionSettingsAccelByte::Set */
+	bool bIsArray{false};
+};
+
+/**
+ * Schema of the session attributes that a game uses, compiled once into lookup tables keyed by setting name and by
+ * attribute field name, with each field's name interned and its upper case field name built ahead of time. Used by the
+ * session interface to convert session settings to and from session attributes without working out the type of each
+ * attribute, or building its names, every time a session is created, updated or found.
+ *
+ * Attributes left out of the schema are still converted, the same way as when no schema is registered.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineSessionAttributeSchemaAccelByte
+{
+public:
+	/** Attribute from the schema, along with the names precomputed for it */
+	struct FCompiledField
+	{
+		/** Name of the session setting that holds the attribute */
+		FName Name;
+
+		/** Name of the field that the attribute is stored under in session attributes, the setting name in upper case */
+		FString FieldName;
+
+		/** Type of the attribute's value, or of each item for array attributes */
+		EOnlineKeyValuePairDataType::Type Type;
+
+		/** Whether the attribute is an array */
+		bool bIsArray;
+	};
+
+	/**
+	 * Compile a schema from the attributes passed in. Attributes with an unsupported type, or with the same name as an
+	 * attribute before them, are left out with a warning.
+	 */
+	explicit FOnlineSessionAttributeSchemaAccelByte(const TArray<FSessionAttributeSchemaFieldAccelByte>& InFields);
+
+	/** Find the attribute held by the session setting with the name passed in, or nullptr if it is not in the schema */
+	const FCompiledField* FindBySettingName(const FName& SettingName) const;
+
+	/** Find the attribute stored under the session attribute field passed in, or nullptr if it is not in the schema */
+	const FCompiledField* FindByFieldName(const FString& FieldName) const;
+
+	/** Number of attributes in the schema */
+	int32 Num() const;
+
+	/**
+	 * Write a session setting value into a session attributes object, under the field name of its attribute
+	 *
+	 * @return false if the value does not match the attribute's type, in which case nothing is written
+	 */
+	static bool WriteAttribute(const FCompiledField& Field, const FVariantData& Data, const TSharedRef<FJsonObject>& OutObject);
+
+	/**
+	 * Read a session attribute value into session settings, under the setting name of its attribute
+	 *
+	 * @return false if the value does not match the attribute's type, in which case nothing is read
+	 */
+	static bool ReadAttribute(const FCompiledField& Field, const TSharedPtr<FJsonValue>& Value, FOnlineSessionSettings& OutSettings);
+
+private:
+	/** Every attribute in the schema */
+	TArray<FCompiledField> Fields;
+
+	/** Index into Fields of each attribute, keyed by setting name */
+	TMap<FName, int32> FieldIndicesBySettingName;
+
+	/** Index into Fields of each attribute, keyed by session attribute field name */
+	TMap<FString, int32> FieldIndicesByFieldName;
+};
+
+typedef TSharedPtr<const FOnlineSessionAttributeSchemaAccelByte, ESPMode::ThreadSafe> FOnlineSessionAttributeSchemaAccelBytePtr;
+
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineSearchSettingsAccelByte : public FOnlineSearchSettings
 {
 public:
@@ -36,11 +36,14 @@ class FOnlinePresenceAccelByte;
 class FOnlineFriendsAccelByte;
 class FOnlinePartySystemAccelByte;
 class FOnlineUserCacheAccelByte;
+class FOnlineUserIdRegistryAccelByte;
+class FOnlineAsyncTaskMetricsAccelByte;
 class FOnlineEntitlementsAccelByte;
 class FOnlineStoreV2AccelByte;
 class FOnlinePurchaseAccelByte;
 class FOnlineAgreementAccelByte;
 class FOnlineWalletAccelByte;
+class IOnlineBackendAccelByte;
 class FExecTestBase;
 
 struct FAccelByteModelsNotificationMessage;
@@ -79,9 +82,15 @@ typedef TSharedPtr<FOnlinePartySystemAccelByte, ESPMode::ThreadSafe> FOnlinePart
 /** Shared pointer to the AccelByte user store */
 typedef TSharedPtr<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe> FOnlineUserCacheAccelBytePtr;
 
+/** Shared pointer to the AccelByte user ID registry */
+typedef TSharedPtr<FOnlineUserIdRegistryAccelByte, ESPMode::ThreadSafe> FOnlineUserIdRegistryAccelBytePtr;
+
 /** Shared pointer to the AccelByte async task manager for this OSS */
 typedef TSharedPtr<FOnlineAsyncTaskManagerAccelByte, ESPMode::ThreadSafe> FOnlineAsyncTaskManagerAccelBytePtr;
 
+/** Shared pointer to the AccelByte async task metrics */
+typedef TSharedPtr<FOnlineAsyncTaskMetricsAccelByte, ESPMode::ThreadSafe> FOnlineAsyncTaskMetricsAccelBytePtr;
+
 /** Shared pointer to the AccelByte entitlements */
 typedef TSharedPtr<FOnlineEntitlementsAccelByte, ESPMode::ThreadSafe> FOnlineEntitlementsAccelBytePtr;
 
@@ -97,6 +106,9 @@ typedef TSharedPtr<FOnlineAgreementAccelByte, ESPMode::ThreadSafe> FOnlineAgreem
 /** Shared pointer to the AccelByte Wallet */
 typedef TSharedPtr<FOnlineWalletAccelByte, ESPMode::ThreadSafe> FOnlineWalletAccelBytePtr;
 
+/** Shared pointer to the backend that AccelByte async tasks send requests through */
+typedef TSharedPtr<IOnlineBackendAccelByte, ESPMode::ThreadSafe> IOnlineBackendAccelBytePtr;
+
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineSubsystemAccelByte final : public FOnlineSubsystemImpl
 {
 public:
@@ -139,6 +151,34 @@ public:
 	 */
 	FOnlineUserCacheAccelBytePtr GetUserCache() const;
 
+	/**
+	 * Retrieves the user ID registry instance for this subsystem, used to reuse user ID instances across updates
+	 */
+	FOnlineUserIdRegistryAccelBytePtr GetUserIdRegistry() const;
+
+	/**
+	 * Retrieves the async task manager instance for this subsystem
+	 */
+	FOnlineAsyncTaskManagerAccelBytePtr GetAsyncTaskManager() const;
+
+	/**
+	 * Retrieves the latency and queue depth metrics collected for async tasks run by this subsystem
+	 */
+	FOnlineAsyncTaskMetricsAccelBytePtr GetAsyncTaskMetrics() const;
+
+	/**
+	 * Retrieves the backend that async tasks send requests through, which is the live backend unless a fake one has been
+	 * swapped in. Safe to call from any thread.
+	 */
+	IOnlineBackendAccelBytePtr GetBackend() const;
+
+	/**
+	 * Swap the backend that async tasks send requests through, such as for a fake backend to run tasks offline. Requests
+	 * already sent keep going to the previous backend, which is ticked until it has answered them. Passing nullptr
+	 * restores the live backend.
+	 */
+	void SetBackend(const IOnlineBackendAccelBytePtr& InBackend);
+
 	//~ Begin FTickerObjectBase
 	virtual bool Tick(float DeltaTime) override;
 	//~ End FTickerObjectBase
@@ -203,7 +243,9 @@ PACKAGE_SCOPE:
 		, PartyInterface(nullptr)
 		, PresenceInterface(nullptr)
 		, UserCache(nullptr)
+		, UserIdRegistry(nullptr)
 		, AsyncTaskManager(nullptr)
+		, AsyncTaskMetrics(nullptr)
 		, Language(FGenericPlatformMisc::GetDefaultLanguage())
 	{
 	}
@@ -221,6 +263,23 @@ PACKAGE_SCOPE:
 		AsyncTaskManager->AddToParallelTasks(NewTask);
 	}
 
+	/**
+	 * Create and queue an async task to the parallel tasks queue in the given priority class, overriding whatever the
+	 * task would pick for itself. See FOnlineAsyncTaskManagerAccelByte for how priority classes are scheduled.
+	 */
+	template <typename TOnlineAsyncTask, typename... TArguments>
+	FORCEINLINE void CreateAndDispatchAsyncTaskParallel(EAccelByteAsyncTaskPriority Priority, TArguments&&... Arguments)
+	{
+		// compile time check to make sure that the template type passed in derives from FOnlineAsyncTaskAccelByte, as only our own tasks have a priority
+		static_assert(TIsDerivedFrom<TOnlineAsyncTask, FOnlineAsyncTaskAccelByte>::IsDerived, "Type passed to CreateAndDispatchAsyncTaskParallel with a priority must derive from FOnlineAsyncTaskAccelByte");
+
+		check(AsyncTaskManager.IsValid());
+
+		TOnlineAsyncTask* NewTask = new TOnlineAsyncTask(Forward<TArguments>(Arguments)...);
+		NewTask->SetPriority(Priority);
+		AsyncTaskManager->AddToParallelTasks(NewTask);
+	}
+
 	/** Create and queue an async task to the in queue */
 	template <typename TOnlineAsyncTask, typename... TArguments>
 	FORCEINLINE void CreateAndDispatchAsyncTaskSerial(TArguments&&... Arguments)
@@ -255,6 +314,11 @@ PACKAGE_SCOPE:
 	{
 		ActiveExecTests.Add(ExecTest);
 	}
+
+	/**
+	 * Handle ONLINE TEST BENCHMARK console commands, spawning the benchmark exec test requested.
+	 */
+	bool BenchmarkExec(UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar);
 #endif
 
 	/**
@@ -335,9 +399,24 @@ private:
 	/** Shared instance of our user cache */
 	FOnlineUserCacheAccelBytePtr UserCache;
 
+	/** Shared instance of our user ID registry */
+	FOnlineUserIdRegistryAccelBytePtr UserIdRegistry;
+
 	/** Async task manager used by interfaces in our OSS to handle async */
 	FOnlineAsyncTaskManagerAccelBytePtr AsyncTaskManager;
 
+	/** Latency and queue depth metrics for tasks run by our async task manager */
+	FOnlineAsyncTaskMetricsAccelBytePtr AsyncTaskMetrics;
+
+	/** Backend that our async tasks send requests through */
+	IOnlineBackendAccelBytePtr Backend;
+
+	/** Backends swapped out while they still had responses to deliver, ticked until they have delivered them all */
+	TArray<IOnlineBackendAccelBytePtr> RetiredBackends;
+
+	/** Lock guarding the backend pointer and retired backends, as tasks read the backend from the online thread */
+	mutable FCriticalSection BackendLock;
+
 	/** Shared instance of our agreement interface implementation */
 	FOnlineAgreementAccelBytePtr AgreementInterface;
 	
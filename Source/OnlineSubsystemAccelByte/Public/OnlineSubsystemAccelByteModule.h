@@ -19,6 +19,9 @@ private:
 	/** Class responsible for creating instance(s) of the subsystem */
 	TUniquePtr<IOnlineFactory> AccelByteFactory;
 
+	/** Handle for dumping the trace ring buffer to the log when the engine hits a system error */
+	FDelegateHandle OnHandleSystemErrorHandle;
+
 public:
 
 	FOnlineSubsystemAccelByteModule() :
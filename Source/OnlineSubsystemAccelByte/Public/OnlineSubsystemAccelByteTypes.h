@@ -19,6 +19,10 @@ class FOnlineSubsystemAccelByte;
 // Value to represent an invalid NetID, mostly to ease debugging
 #define ACCELBYTE_INVALID_ID_VALUE TEXT("INVALID")
 
+// Version byte that leads the compact binary encoding of a composite user ID. Legacy IDs are Base64 encoded JSON objects,
+// which will always start with a '{' byte once decoded, so this can never collide with them.
+#define ACCELBYTE_USER_ID_ENCODING_VERSION 1
+
 /**
  * Does a simple check to see if the actual AccelByte ID for the composite is valid.
  */
@@ -146,14 +150,28 @@ protected:
  * - PlatformTypeString
  * - PlatformIDString
  * 
- * When any of these are set, the underlying string for FUniqueNetIdString is set to a Base64 encoded JSON object that contains
- * all of these fields individually. An example of this JSON object is as follows:
+ * When any of these are set, the underlying string for FUniqueNetIdString is set to a Base64 encoded JSON object that
+ * contains all of these fields individually, such as the following:
  * {
  *     "id": "<AccelByte ID>", 
  *     "platformType": "<type of platform the platformId field corresponds to, can be blank>",
  *     "platformId": "<ID of the platform that platformType corresponds to, can be blank>"
  * }
  * 
+ * If bUseBinaryCompositeIds is set to true in the OnlineSubsystemAccelByte section of DefaultEngine.ini, the fields are
+ * instead encoded as a more compact Base64 encoded binary blob. Only enable this once every game client and server that
+ * exchanges IDs understands the binary format. The layout of this blob is as follows:
+ * - uint8 encoding version, currently ACCELBYTE_USER_ID_ENCODING_VERSION
+ * - uint8 flags, where bit zero denotes that the AccelByte ID is packed as 16 raw bytes instead of a string
+ * - AccelByte ID, either as 16 raw bytes or as a length prefixed UTF-8 string
+ * - Platform type, as a length prefixed UTF-8 string
+ * - Platform ID, as a length prefixed UTF-8 string
+ * 
+ * Strings in the blob are prefixed with their length in bytes as a little endian uint16.
+ * 
+ * IDs in either format are accepted when constructing an ID from a string, whichever format is being written. Two IDs
+ * with the same components are equal and hash the same regardless of the format their string was encoded with.
+ * 
  * ToString will return the encoded version of this string, while ToDebugString will return the decoded version.
  * 
  * To get any of these fields from the ID, you will want to cast to an FUniqueNetIdAccelByte and use the getters there.
@@ -222,8 +240,10 @@ public:
 	/**
 	 * @brief Whether or not this ID is a valid FUniqueNetIdAccelByte type. Will do a number of checks including:
 	 * - Whether the underlying string value is Base64
-	 * - Whether upon decoding the string value there is a JSON object with id, platformType, and platformId fields
-	 * - Whether the id field in the JSON object is in the correct format for an AccelByte ID
+	 * - Whether upon decoding the string value there is a binary or JSON composite with id, platformType, and platformId fields
+	 * - Whether the id field in the composite is in the correct format for an AccelByte ID
+	 * 
+	 * The result of this check is cached when the ID is constructed, so this is cheap to call repeatedly.
 	 */
 	virtual bool IsValid() const override;
 
@@ -235,17 +255,17 @@ public:
 	/**
 	 * @brief Get the string representation of the AccelByte user ID from the composite ID
 	 */
-	FString GetAccelByteId() const;
+	const FString& GetAccelByteId() const;
 
 	/**
 	 * @brief Get the string representation of the type of platform for platform ID from the composite ID
 	 */
-	FString GetPlatformType() const;
+	const FString& GetPlatformType() const;
 
 	/**
 	 * @brief Get the string representation of the ID of the user for the platform type specified from the composite ID
 	 */
-	FString GetPlatformId() const;
+	const FString& GetPlatformId() const;
 
 	/**
 	 * @brief Checks whether or not this composite ID has platform information included
@@ -267,6 +287,11 @@ public:
 	 */
 	virtual bool Compare(const FUniqueNetId& Other) const override;
 
+	/**
+	 * @brief Hash the AccelByte ID rather than the encoded string, so that the same ID hashes the same in either encoding
+	 */
+	virtual uint32 GetTypeHash() const override;
+
 PACKAGE_SCOPE:
 
 	/**
@@ -275,6 +300,42 @@ PACKAGE_SCOPE:
 	UE_DEPRECATED(5.0, "Public constructors of FUniqueNetId types are deprecated. Please use the ::Create(Args) method instead to create a FUniqueNetIdRef")
 	explicit FUniqueNetIdAccelByteUser(const FAccelByteUniqueIdComposite& CompositeId, const FString& EncodedComposite);
 
+	/**
+	 * @brief Encode a composite structure to the string representation used for the underlying ID string, in the format
+	 * chosen by the bUseBinaryCompositeIds config value.
+	 * 
+	 * @param CompositeId Composite structure that we wish to encode
+	 * @param OutEncodedComposite Base64 string of the encoded composite
+	 * @return true if the composite was encoded, false otherwise
+	 */
+	static bool EncodeCompositeId(const FAccelByteUniqueIdComposite& CompositeId, FString& OutEncodedComposite);
+
+	/**
+	 * @brief Encode a composite structure to either the legacy JSON or the compact binary string representation.
+	 * 
+	 * @param CompositeId Composite structure that we wish to encode
+	 * @param OutEncodedComposite Base64 string of the encoded composite
+	 * @param bUseBinaryEncoding Whether to encode to the compact binary format rather than the legacy JSON format
+	 * @return true if the composite was encoded, false if it could not be converted or any of its fields are too large
+	 */
+	static bool EncodeCompositeId(const FAccelByteUniqueIdComposite& CompositeId, FString& OutEncodedComposite, bool bUseBinaryEncoding);
+
+	/**
+	 * @brief Whether new composite IDs are encoded with the compact binary format, read once from the
+	 * bUseBinaryCompositeIds config value. Defaults to false, keeping the legacy JSON format that older clients expect.
+	 */
+	static bool ShouldUseBinaryCompositeIds();
+
+	/**
+	 * @brief Decode an encoded composite string to its composite structure. Accepts both the compact binary encoding as
+	 * well as the legacy Base64 encoded JSON object.
+	 * 
+	 * @param EncodedComposite Base64 string that we wish to decode
+	 * @param OutCompositeId Composite structure decoded from the string
+	 * @return true if the string was decoded successfully, false otherwise
+	 */
+	static bool DecodeCompositeId(const FString& EncodedComposite, FAccelByteUniqueIdComposite& OutCompositeId);
+
 private:
 
 	/**
@@ -556,4 +617,4 @@ private:
 typedef TSharedRef<const FUniqueNetId, UNIQUENETID_ESPMODE> FUniqueNetIdRef;
 typedef TSharedPtr<const FUniqueNetId, UNIQUENETID_ESPMODE> FUniqueNetIdPtr;
 typedef TWeakPtr<const FUniqueNetId, UNIQUENETID_ESPMODE> FUniqueNetIdWeakPtr;
-#endif 
\ No newline at end of file
+#endif 
\ No newline at end of file
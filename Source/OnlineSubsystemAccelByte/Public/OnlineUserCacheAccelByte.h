@@ -4,6 +4,9 @@
 
 #pragma once
 #include "OnlineSubsystemAccelByteTypes.h"
+#include "Misc/ScopeRWLock.h"
+#include "Containers/StringView.h"
+#include <atomic>
 
 class FOnlineSubsystemAccelByte;
 class IOnlineSubsystem;
@@ -48,8 +51,16 @@ private:
 	/**
 	 * Timestamp denoting the last time that this particular user has been grabbed from the cache. If this exceeds the
 	 * maximum value set in the user cache, and if the user is not marked as important, they will be purged from the cache.
+	 * 
+	 * Atomic as cache reads refresh this while only holding a shared lock on their shard.
+	 */
+	std::atomic<double> LastAccessedTimeInSeconds{0.0};
+
+	/**
+	 * Whether this user was loaded from the persistent cache after its time to live had passed. Stale users are still
+	 * served from the cache, but are queued to be refreshed from the backend in the background.
 	 */
-	double LastAccessedTimeInSeconds = 0.0;
+	bool bIsStale = false;
 
 	/**
 	 * Setting the query async task as a friend class to set importance and last accessed
@@ -66,10 +77,85 @@ private:
 /**
  * Delegate for when querying a user through the user cache finishes.
  * 
+ * Queries are all or nothing. If fetching any of the IDs asked for fails, the query fails and no users are handed back,
+ * even though the users that were fetched are still added to the cache. Querying just the failed IDs again is enough to
+ * recover. IDs that the backend does not know are not failures, those users are simply left out of the results.
+ * 
  * @param bIsSuccessful Whether or not the query overall was a success
  * @param UserIds IDs of the users that we were successfully able to query, and thus are in the cache
+ * @param FailedIds IDs that could not be fetched because the request for them failed. These are platform IDs if looking up
+ * their AccelByte accounts failed, otherwise AccelByte IDs.
  */
-DECLARE_DELEGATE_TwoParams(FOnQueryUsersComplete, bool /*bIsSuccessful*/, TArray<TSharedRef<FAccelByteUserInfo>> /*UsersQueried*/);
+DECLARE_DELEGATE_ThreeParams(FOnQueryUsersComplete, bool /*bIsSuccessful*/, TArray<TSharedRef<FAccelByteUserInfo>> /*UsersQueried*/, TArray<FString> /*FailedIds*/);
+
+/**
+ * State shared between a user query and the user cache while that query is in flight.
+ * 
+ * Identifies the query as the owner of the IDs it is fetching, and collects users for IDs that the query found already
+ * being fetched by another query, so that it can wait on that result rather than fetching the same users again.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FAccelBytePendingUserQuery
+{
+public:
+
+	/**
+	 * Whether every in-flight ID that this query attached to has been resolved by its owner
+	 */
+	bool IsResolved() const;
+
+	/**
+	 * Whether any owner of an in-flight ID that this query attached to failed to fetch it
+	 */
+	bool HasFailure() const;
+
+	/**
+	 * Get the users that were resolved for this query by other queries' results
+	 */
+	TArray<TSharedRef<FAccelByteUserInfo>> GetResolvedUsers() const;
+
+	/**
+	 * Get the in-flight IDs that this query attached to and whose owner failed to fetch them
+	 */
+	TArray<FString> GetFailedIds() const;
+
+	/**
+	 * Set a callback fired once every in-flight ID that this query attached to has been resolved. Fired from whichever
+	 * thread resolved the last ID, and never while holding any cache lock.
+	 */
+	void SetOnResolved(TFunction<void()> InOnResolved);
+
+private:
+
+	/**
+	 * Lock guarding the state below, as owners resolve IDs from their own threads
+	 */
+	mutable FCriticalSection Lock;
+
+	/**
+	 * Number of in-flight IDs that this query is still waiting on
+	 */
+	int32 NumPendingIds = 0;
+
+	/**
+	 * IDs that we were waiting on and whose owner failed to fetch them
+	 */
+	TArray<FString> FailedIds;
+
+	/**
+	 * Users resolved for this query by other queries
+	 */
+	TArray<TSharedRef<FAccelByteUserInfo>> ResolvedUsers;
+
+	/**
+	 * Callback fired once the last in-flight ID that this query attached to is resolved
+	 */
+	TFunction<void()> OnResolved;
+
+	friend class FOnlineUserCacheAccelByte;
+
+};
+
+typedef TSharedRef<FAccelBytePendingUserQuery, ESPMode::ThreadSafe> FAccelBytePendingUserQueryRef;
 
 /**
  * Manages users that are queried from the AccelByte backend, making bulk calls to retrieve user data, as well as getting
@@ -83,9 +169,32 @@ DECLARE_DELEGATE_TwoParams(FOnQueryUsersComplete, bool /*bIsSuccessful*/, TArray
  * 
  * User data will be kept cached based on how long it has been since they have been accessed. You can configure how long
  * users will stay in cache with the `UserCachePurgeTimeoutSeconds` variable in the `OnlineSubsystemAccelByte` settings
- * in `DefaultEngine.ini`. Users will also not be purged if they were marked as important when queried.
+ * in `DefaultEngine.ini`. Users will also not be purged if they were marked as important when queried. You can also cap
+ * the number of users held with `UserCacheMaxEntries`, past which the least recently accessed users that are not
+ * important are purged first. This defaults to zero, meaning no cap.
+ * 
+ * Users that can be purged are tracked in a timing wheel of buckets keyed by when they were last accessed. Accessing a
+ * user only updates its timestamp, and a user is moved to a later bucket only when its old bucket comes due. This way a
+ * purge only ever looks at users in buckets that have come due, rather than scanning the whole cache.
+ * 
+ * Both maps are split across a fixed number of shards chosen by key hash, each guarded by its own reader/writer lock.
+ * Lookups only take a shared lock on a single shard, so reads from the game thread do not wait on bulk inserts from
+ * query tasks unless both touch the same shard at the same moment. No method ever holds more than one shard lock.
+ * 
+ * Queries by AccelByte ID can optionally be batched, so that many small queries made close together by different
+ * interfaces go out as a single bulk query. Set `bEnableUserQueryBatching` in the `OnlineSubsystemAccelByte` settings
+ * to enable this. A batch is sent once `UserQueryBatchWindowSeconds` has passed since its first query (default 0.05), or
+ * once it holds `UserQueryBatchMaxIds` unique IDs (default 100), whichever comes first.
+ * 
+ * The cache can optionally be persisted to disk so that users are available as soon as the game launches. Set
+ * `bEnableUserCachePersistence` in the `OnlineSubsystemAccelByte` settings to enable this. Users are loaded in the
+ * background on the first tick, and users fetched afterwards are appended to the file every
+ * `PersistentUserCacheFlushIntervalSeconds` (default 5). Each persisted user expires `PersistentUserCacheTTLSeconds`
+ * after it was fetched (default one day). Expired users are still served, but are refreshed from the backend in the
+ * background. Users that expired more than `PersistentUserCacheMaxStaleSeconds` ago (default one week) are discarded.
  */
 class ONLINESUBSYSTEMACCELBYTE_API FOnlineUserCacheAccelByte
+	: public TSharedFromThis<FOnlineUserCacheAccelByte, ESPMode::ThreadSafe>
 {
 public:
 	/**
@@ -114,7 +223,7 @@ public:
 	 * 
 	 * @param LocalUserNum Index of the user that is attempting to query for other users
 	 * @param AccelByteIds Array of strings that represent an ID for a single user
-	 * @param Delegate Delegate fired when the query is complete
+	 * @param Delegate Delegate fired when the query is complete, which fails if any of the IDs could not be fetched
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
 	 */
@@ -128,7 +237,7 @@ public:
 	 * @param LocalUserNum Index of the user that is attempting to query for other users
 	 * @param PlatformType String representing the type of platform that these IDs belong to
 	 * @param PlatformIds Array of strings that represent an ID for a single user
-	 * @param Delegate Delegate fired when the query is complete
+	 * @param Delegate Delegate fired when the query is complete, which fails if any of the IDs could not be fetched
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
 	 */
@@ -142,7 +251,7 @@ public:
 	 *
 	 * @param UserId FUniqueNetId of the user that is attempting to query for users
 	 * @param AccelByteIds Array of strings that represent an ID for a single user
-	 * @param Delegate Delegate fired when the query is complete
+	 * @param Delegate Delegate fired when the query is complete, which fails if any of the IDs could not be fetched
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
 	 */
@@ -156,7 +265,7 @@ public:
 	 * @param UserId FUniqueNetId of the user that is attempting to query for users
 	 * @param PlatformType String representing the type of platform that these IDs belong to
 	 * @param PlatformIds Array of strings that represent an ID for a single user
-	 * @param Delegate Delegate fired when the query is complete
+	 * @param Delegate Delegate fired when the query is complete, which fails if any of the IDs could not be fetched
 	 * @param bIsImportant Whether or not we want to mark these users as important so that they stay in the cache, defaults to false.
 	 * This should only be used for users that we want to persist for the length of the game session, such as friends.
 	 */
@@ -173,6 +282,17 @@ public:
 	 */
 	TSharedPtr<const FAccelByteUserInfo> GetUser(const FAccelByteUniqueIdComposite& UserId);
 
+	/**
+	 * Get the number of user queries that attached to IDs already being fetched by another query, rather than fetching
+	 * those users again.
+	 */
+	int32 GetNumCoalescedQueries() const;
+
+	/**
+	 * Writes any users fetched since the last flush to the persistent cache before the cache goes away.
+	 */
+	~FOnlineUserCacheAccelByte();
+
 PACKAGE_SCOPE:
 
 	/**
@@ -182,14 +302,48 @@ PACKAGE_SCOPE:
 	FOnlineUserCacheAccelByte(FOnlineSubsystemAccelByte* InSubsystem);
 
 	/**
-	 * Add an array of freshly queried users to the user cache
+	 * Add an array of freshly queried users to the user cache. Users are only persisted if they came from the live backend.
 	 */
 	void AddUsersToCache(const TArray<TSharedRef<FAccelByteUserInfo>>& UsersQueried);
 
+	/**
+	 * Remove users from the cache straight away, whenever they were last accessed. Important users are left in place.
+	 * 
+	 * Returns the number of users removed from the cache.
+	 */
+	int32 RemoveUsers(const TArray<FString>& AccelByteIds);
+
+	/**
+	 * Load the users stored in a persistent user cache file, rewriting the file with only its live records once more
+	 * than half of the records in it are dead weight. Safe to call from any thread.
+	 * 
+	 * @param MaxStaleSeconds How long after expiring a user is still loaded, as stale
+	 * @param OutUsers Users loaded from the file are added to this array
+	 * @return whether the file was rewritten
+	 */
+	static bool LoadPersistentCacheFile(const FString& FilePath, double MaxStaleSeconds, TArray<TSharedRef<FAccelByteUserInfo>>& OutUsers);
+
+	/**
+	 * Append users to a persistent user cache file, creating it if needed. Safe to call from any thread.
+	 * 
+	 * @param TTLSeconds How long from now the users expire
+	 */
+	static void AppendToPersistentCacheFile(const FString& FilePath, const TArray<TSharedRef<FAccelByteUserInfo>>& Users, double TTLSeconds);
+
+	/**
+	 * Get the string that a platform unique ID is looked up by in the platform ID maps, which is always what its ToString
+	 * gives. For IDs of a type in StringIdTypes, the string is borrowed from the ID, so every type in there must have its
+	 * IDs be FUniqueNetIdString. Any other ID is converted with ToString into OutIdStorage, which the result points into.
+	 */
+	static FStringView GetPlatformIdView(const FUniqueNetId& UserId, const TSet<FName>& StringIdTypes, FString& OutIdStorage);
+
 	/**
 	 * Searches through the user caches for a user that hasn't been accessed in longer than the maximum time set for this
 	 * cache. If a user is found that exceeds this max time, and they are not marked as important, they will be removed
-	 * from the cache entirely.
+	 * from the cache entirely. If the cache is still over its capacity after this, the least recently accessed users that
+	 * are not important are removed until it is back under.
+	 * 
+	 * Only users in timing wheel buckets that have come due are looked at, so this is cheap to call every tick.
 	 * 
 	 * Will return the number of users purged from the cache.
 	 * 
@@ -204,16 +358,318 @@ PACKAGE_SCOPE:
 
 	/**
 	 * Method used by user queries to get an array of users that we still need to query, as well as shared instances to
-	 * users that we have already queried and can retrieve from the cache
+	 * users that we have already queried and can retrieve from the cache.
+	 * 
+	 * IDs returned in UsersToQuery are marked as in flight and owned by the query passed in, which must later call
+	 * ResolvePendingUsers for them. IDs that are already in flight for another query are left out of both arrays, and
+	 * the query is instead attached as a waiter on them, which can be checked through the query's pending state.
+	 * 
+	 * Stale users are returned as cached and queued for a background refresh, unless bRefreshStaleUsers is set, in which
+	 * case they are returned in UsersToQuery to be fetched by this query.
+	 */
+	void GetQueryAndCacheArrays(const FAccelBytePendingUserQueryRef& Query, const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<TSharedRef<FAccelByteUserInfo>>& UsersInCache, bool bRefreshStaleUsers = false);
+
+	/**
+	 * Mark IDs owned by the query passed in as no longer in flight. On success, the users fetched are added to the cache
+	 * and handed to any queries that were waiting on them. IDs that are not owned by this query are ignored, so this is
+	 * safe to call more than once for the same IDs.
 	 */
-	void GetQueryAndCacheArrays(const TArray<FString>& AccelByteIds, TArray<FString>& UsersToQuery, TArray<TSharedRef<FAccelByteUserInfo>>& UsersInCache);
+	void ResolvePendingUsers(const FAccelBytePendingUserQueryRef& Query, const TArray<FString>& AccelByteIds, const TArray<TSharedRef<FAccelByteUserInfo>>& UsersQueried, bool bWasSuccessful);
+
+	/**
+	 * Sends any user query batches whose window has elapsed.
+	 * 
+	 * Do not call this method directly, it will be called from the owning OnlineSubsystem's tick!
+	 */
+	void Tick(float DeltaTime);
 
 private:
 
 	/**
-	 * Mutex used to lock maps while we add to or retrieve from cache
+	 * Number of shards that the cache maps are split across. Must be a power of two.
+	 */
+	static constexpr int32 NumShards = 16;
+
+	/**
+	 * Borrowed platform type and ID, used to probe the platform ID maps without joining or copying either string. Either
+	 * may point at any character storage, such as a stack buffer or the string inside a platform unique ID.
 	 */
-	FCriticalSection CacheLock;
+	struct FPlatformUserKeyView
+	{
+		FPlatformUserKeyView(const FString& InPlatformType, const FString& InPlatformId)
+			: FPlatformUserKeyView(FStringView(*InPlatformType, InPlatformType.Len()), FStringView(*InPlatformId, InPlatformId.Len()))
+		{
+		}
+
+		FPlatformUserKeyView(FStringView InPlatformType, FStringView InPlatformId)
+			: FPlatformUserKeyView(InPlatformType, InPlatformId, HashCombine(HashIgnoreCase(InPlatformType), HashIgnoreCase(InPlatformId)))
+		{
+		}
+
+		FPlatformUserKeyView(FStringView InPlatformType, FStringView InPlatformId, uint32 InHash)
+			: PlatformType(InPlatformType)
+			, PlatformId(InPlatformId)
+			, Hash(InHash)
+		{
+		}
+
+		/**
+		 * Case insensitive FNV-1a hash of the characters in a string, so that the hash does not depend on where they are stored
+		 */
+		static FORCEINLINE uint32 HashIgnoreCase(FStringView String)
+		{
+			uint32 Result = 2166136261u;
+			for (int32 Index = 0; Index < String.Len(); Index++)
+			{
+				Result = (Result ^ static_cast<uint32>(FChar::ToUpper(String[Index]))) * 16777619u;
+			}
+			return Result;
+		}
+
+		static FORCEINLINE bool EqualsIgnoreCase(FStringView A, FStringView B)
+		{
+			return A.Len() == B.Len() && FCString::Strnicmp(A.GetData(), B.GetData(), A.Len()) == 0;
+		}
+
+		const FStringView PlatformType;
+		const FStringView PlatformId;
+		const uint32 Hash;
+	};
+
+	/**
+	 * Platform type and ID owned by the platform ID maps, with the hash worked out once when the user was added
+	 */
+	struct FPlatformUserKey
+	{
+		explicit FPlatformUserKey(const FPlatformUserKeyView& View)
+			: PlatformType(View.PlatformType.Len(), View.PlatformType.GetData())
+			, PlatformId(View.PlatformId.Len(), View.PlatformId.GetData())
+			, Hash(View.Hash)
+		{
+		}
+
+		FPlatformUserKeyView GetView() const
+		{
+			return FPlatformUserKeyView(FStringView(*PlatformType, PlatformType.Len()), FStringView(*PlatformId, PlatformId.Len()), Hash);
+		}
+
+		FString PlatformType;
+		FString PlatformId;
+		uint32 Hash;
+	};
+
+	/**
+	 * Key funcs for the platform ID maps, which allow probing with a FPlatformUserKeyView through FindByHash. Comparisons
+	 * are case insensitive, same as the string keys that these replaced.
+	 */
+	struct FPlatformUserKeyFuncs : BaseKeyFuncs<TPair<FPlatformUserKey, TSharedRef<FAccelByteUserInfo>>, FPlatformUserKey, false>
+	{
+		static FORCEINLINE const FPlatformUserKey& GetSetKey(const TPair<FPlatformUserKey, TSharedRef<FAccelByteUserInfo>>& Element)
+		{
+			return Element.Key;
+		}
+
+		static FORCEINLINE bool Matches(const FPlatformUserKey& A, const FPlatformUserKeyView& B)
+		{
+			return A.Hash == B.Hash
+				&& FPlatformUserKeyView::EqualsIgnoreCase(FStringView(*A.PlatformId, A.PlatformId.Len()), B.PlatformId)
+				&& FPlatformUserKeyView::EqualsIgnoreCase(FStringView(*A.PlatformType, A.PlatformType.Len()), B.PlatformType);
+		}
+
+		static FORCEINLINE bool Matches(const FPlatformUserKey& A, const FPlatformUserKey& B)
+		{
+			return Matches(A, B.GetView());
+		}
+
+		static FORCEINLINE uint32 GetKeyHash(const FPlatformUserKey& Key)
+		{
+			return Key.Hash;
+		}
+	};
+
+	typedef TMap<FPlatformUserKey, TSharedRef<FAccelByteUserInfo>, FDefaultSetAllocator, FPlatformUserKeyFuncs> FPlatformIdToUserInfoMap;
+
+	/**
+	 * One segment of the user cache. A user lives in the AccelByte ID map of the shard that its AccelByte ID hashes to,
+	 * and in the platform map of the shard that its platform key hashes to, which are not necessarily the same shard.
+	 */
+	struct FUserCacheShard
+	{
+		/**
+		 * Lock guarding both maps in this shard
+		 */
+		mutable FRWLock Lock;
+
+		/**
+		 * User cache that maps AccelByte IDs to shared user instances
+		 */
+		TMap<FString, TSharedRef<FAccelByteUserInfo>> AccelByteIdToUserInfoMap;
+
+		/**
+		 * User cache that maps platform type and ID to shared user instances
+		 */
+		FPlatformIdToUserInfoMap PlatformIdToUserInfoMap;
+	};
+
+	/**
+	 * Shards that make up the user cache
+	 */
+	FUserCacheShard Shards[NumShards];
+
+	/**
+	 * Bookkeeping for an AccelByte ID that is currently being fetched from the backend
+	 */
+	struct FPendingUserEntry
+	{
+		/**
+		 * Query that is fetching this user
+		 */
+		TWeakPtr<FAccelBytePendingUserQuery, ESPMode::ThreadSafe> Owner;
+
+		/**
+		 * Queries waiting on the owner's result for this user
+		 */
+		TArray<FAccelBytePendingUserQueryRef> Waiters;
+	};
+
+	/**
+	 * Lock guarding the pending user map. When held together with a shard lock or a query's lock, this must be taken first.
+	 */
+	FCriticalSection PendingUsersLock;
+
+	/**
+	 * Map of AccelByte IDs currently being fetched from the backend to their in-flight bookkeeping
+	 */
+	TMap<FString, FPendingUserEntry> PendingUsers;
+
+	/**
+	 * Number of queries that attached to IDs already in flight rather than fetching them again
+	 */
+	FThreadSafeCounter NumCoalescedQueries;
+
+	/**
+	 * A single caller's query that has been folded into a batch
+	 */
+	struct FBatchedUserQuery
+	{
+		/**
+		 * IDs that this caller asked for
+		 */
+		TArray<FString> AccelByteIds;
+
+		/**
+		 * Delegate to fire with this caller's share of the batch results
+		 */
+		FOnQueryUsersComplete Delegate;
+	};
+
+	/**
+	 * Queries by AccelByte ID for a single local user that are waiting to be sent as one bulk query
+	 */
+	struct FUserQueryBatch
+	{
+		/**
+		 * Unique IDs requested across every query in the batch
+		 */
+		TSet<FString> AccelByteIds;
+
+		/**
+		 * Queries folded into this batch
+		 */
+		TArray<FBatchedUserQuery> Queries;
+
+		/**
+		 * Time that the first query was added to this batch
+		 */
+		double OpenedTimeInSeconds = 0.0;
+	};
+
+	/**
+	 * Whether queries by AccelByte ID are batched rather than sent as soon as they are made
+	 */
+	bool bIsQueryBatchingEnabled = false;
+
+	/**
+	 * Length of time in seconds that a batch will collect queries for before being sent
+	 */
+	double QueryBatchWindowSeconds = 0.05;
+
+	/**
+	 * Number of unique IDs that will cause a batch to be sent immediately
+	 */
+	int32 QueryBatchMaxIds = 100;
+
+	/**
+	 * Lock guarding the batch map
+	 */
+	FCriticalSection QueryBatchLock;
+
+	/**
+	 * Batches that are collecting queries, keyed by local user index and whether the users queried are important
+	 */
+	TMap<TPair<int32, bool>, FUserQueryBatch> QueryBatches;
+
+	/**
+	 * Platform unique ID types whose IDs are FUniqueNetIdString, so that lookups by them can borrow the ID's string
+	 * rather than copy it with ToString. Set with `+StringUniqueNetIdTypes` in the `OnlineSubsystemAccelByte` settings,
+	 * and only ever list types known to be FUniqueNetIdString, as their IDs are cast to it.
+	 */
+	TSet<FName> StringUniqueNetIdTypes;
+
+	/**
+	 * Whether users are persisted to disk between runs
+	 */
+	bool bIsPersistenceEnabled = false;
+
+	/**
+	 * Length of time in seconds after being fetched that a persisted user is considered stale
+	 */
+	double PersistentEntryTTLSeconds = 86400.0;
+
+	/**
+	 * Length of time in seconds after going stale that a persisted user is discarded rather than loaded
+	 */
+	double PersistentEntryMaxStaleSeconds = 604800.0;
+
+	/**
+	 * Length of time in seconds between appending newly fetched users to the persistent cache
+	 */
+	double PersistFlushIntervalSeconds = 5.0;
+
+	/**
+	 * Full path to the persistent cache file, set once loading starts
+	 */
+	FString PersistentCacheFilePath;
+
+	/**
+	 * Whether we have kicked off loading the persistent cache
+	 */
+	bool bHasStartedPersistentLoad = false;
+
+	/**
+	 * Whether the persistent cache has finished loading, we do not append to the file until it has
+	 */
+	std::atomic<bool> bHasLoadedPersistentCache{false};
+
+	/**
+	 * Time that we last appended users to the persistent cache
+	 */
+	double LastPersistFlushTimeInSeconds = 0.0;
+
+	/**
+	 * Lock guarding the persistence queues below
+	 */
+	FCriticalSection PersistLock;
+
+	/**
+	 * Users fetched since the last flush that still need to be appended to the persistent cache
+	 */
+	TArray<TSharedRef<FAccelByteUserInfo>> UsersToPersist;
+
+	/**
+	 * IDs of stale users that have been served and are waiting to be refreshed from the backend
+	 */
+	TSet<FString> StaleUsersToRefresh;
 
 	/**
 	 * Length of time in seconds that a user will stay in the cache without being accessed before being purged.
@@ -222,15 +678,57 @@ private:
 	double UserCachePurgeTimeoutSeconds = 600.0;
 
 	/**
-	 * User cache that maps AccelByte IDs to shared user instances
+	 * Maximum number of users to hold in the cache before purging the least recently accessed users that are not
+	 * important, or zero for no limit.
 	 */
-	TMap<FString, TSharedRef<FAccelByteUserInfo>> AccelByteIdToUserInfoMap;
+	int32 MaxCachedUsers = 0;
 
 	/**
-	 * User cache that maps platform type and ID to shared user instances. The key is just
-	 * a string that combines both type and ID, in the following format: "TYPE;ID".
+	 * Number of users currently held in the AccelByte ID maps
 	 */
-	TMap<FString, TSharedRef<FAccelByteUserInfo>> PlatformIdToUserInfoMap;
+	FThreadSafeCounter NumCachedUsers;
+
+	/**
+	 * Number of timing wheel buckets that span the purge timeout
+	 */
+	static constexpr int32 NumEvictionSlotsPerTimeout = 64;
+
+	/**
+	 * A user that may be purged, tracked in the timing wheel bucket for when it was last known to be accessed
+	 */
+	struct FEvictionEntry
+	{
+		/**
+		 * AccelByte ID of the user, used to find the user in the cache
+		 */
+		FString AccelByteId;
+
+		/**
+		 * User instance that this entry was made for. Only compared against the instance currently in the cache, to
+		 * drop entries for users that have since been replaced or removed, and never dereferenced.
+		 */
+		const FAccelByteUserInfo* User;
+	};
+
+	/**
+	 * Lock guarding the timing wheel. Never held together with a shard lock.
+	 */
+	FCriticalSection EvictionLock;
+
+	/**
+	 * Length of time in seconds covered by each timing wheel bucket
+	 */
+	double EvictionSlotSeconds = 1.0;
+
+	/**
+	 * Timing wheel of users that may be purged, keyed by absolute bucket index of their access time
+	 */
+	TMap<int64, TArray<FEvictionEntry>> EvictionWheel;
+
+	/**
+	 * Index of the oldest bucket that may still hold entries, every bucket before this has already been processed
+	 */
+	int64 NextEvictionSlot = 0;
 
 	/**
 	 * AccelByte online subsystem instance that owns this user cache.
@@ -243,8 +741,84 @@ private:
 	FOnlineUserCacheAccelByte() = delete;
 
 	/**
-	 * Internal convenience method to convert platform strings to a key for the PlatformIdToUserInfoMap.
+	 * Get the index of the shard that owns the given cache key
+	 */
+	static int32 GetShardIndex(const FString& Key);
+
+	/**
+	 * Get the index of the shard that owns a cache key with the given hash
+	 */
+	static int32 GetShardIndex(uint32 KeyHash);
+
+	/**
+	 * Find a user by AccelByte ID, taking a shared lock on the owning shard. Refreshes the user's access time if found
+	 * and requested.
+	 */
+	TSharedPtr<FAccelByteUserInfo> FindByAccelByteId(const FString& AccelByteId, bool bUpdateAccessTime) const;
+
+	/**
+	 * Find a user by platform cache key, taking a shared lock on the owning shard. Refreshes the user's access time if
+	 * found and requested.
+	 */
+	TSharedPtr<FAccelByteUserInfo> FindByPlatformKey(const FPlatformUserKeyView& PlatformKey, bool bUpdateAccessTime) const;
+
+	/**
+	 * Fold a query into the batch for the local user, sending the batch right away if it has grown past its limit.
+	 */
+	void AddQueryToBatch(int32 LocalUserNum, const TArray<FString>& AccelByteIds, const FOnQueryUsersComplete& Delegate, bool bIsImportant);
+
+	/**
+	 * Send every query in a batch as a single bulk query, fanning results back out to each caller in the batch.
+	 */
+	void DispatchQueryBatch(int32 LocalUserNum, bool bIsImportant, FUserQueryBatch&& Batch);
+
+	/**
+	 * Add users to the cache maps. Existing entries are only replaced if bOverwriteExisting is set, and replaced entries
+	 * keep their importance.
+	 */
+	void AddUsersToCacheInternal(const TArray<TSharedRef<FAccelByteUserInfo>>& Users, bool bOverwriteExisting);
+
+	/**
+	 * Get the absolute timing wheel bucket index for a time in seconds
+	 */
+	int64 GetEvictionSlot(double TimeInSeconds) const;
+
+	/**
+	 * Track users in the timing wheel bucket for their last access time, skipping any that are important. Must be called
+	 * while holding EvictionLock.
+	 */
+	void ScheduleEvictionLocked(const TArray<TSharedRef<FAccelByteUserInfo>>& Users);
+
+	/**
+	 * Pull every entry out of the given timing wheel buckets, in bucket order. Must be called while holding EvictionLock.
+	 */
+	void TakeEvictionSlotsLocked(int64 FirstSlot, int64 EndSlot, TArray<TPair<int64, FEvictionEntry>>& OutEntries);
+
+	/**
+	 * Remove a user from the cache maps if the instance in the cache is still the one given and it is not important.
+	 * Returns whether the user was removed.
+	 */
+	bool RemoveUserIfUnchanged(const FString& AccelByteId, const FAccelByteUserInfo* ExpectedUser, double AccessedBeforeTimeInSeconds);
+
+	/**
+	 * Queue a user for a background refresh if they were loaded stale from the persistent cache
+	 */
+	void MarkForRefreshIfStale(const TSharedPtr<FAccelByteUserInfo>& User);
+
+	/**
+	 * Kick off loading the persistent cache file on a background thread
+	 */
+	void StartPersistentCacheLoad();
+
+	/**
+	 * Append users fetched since the last flush to the persistent cache file, on a background thread unless told
+	 * otherwise
+	 */
+	void FlushPersistentCache(bool bIsSynchronous);
+
+	/**
+	 * Send a query for any stale users that have been served, if a local user is logged in to send it with
 	 */
-	FString ConvertPlatformTypeAndIdToCacheKey(const FString& Type, const FString& Id) const;
+	void RefreshStaleUsers();
 
-};
\ No newline at end of file
+};
\ No newline at end of file
@@ -0,0 +1,118 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineSubsystemAccelByteTypes.h"
+
+/**
+ * Interning hands the same ID out to every thread that asks for it, which is only safe if that ID's reference count is
+ * atomic. AccelByte user IDs use the default shared pointer mode, which is only ESPMode::ThreadSafe from UE5 onwards,
+ * or on UE4 when FORCE_THREADSAFE_SHAREDPTRS is set. Otherwise the registry passes straight through to creating IDs.
+ */
+#ifndef AB_OSS_USER_ID_INTERNING_ENABLED
+#if ENGINE_MAJOR_VERSION >= 5 || (defined(FORCE_THREADSAFE_SHAREDPTRS) && FORCE_THREADSAFE_SHAREDPTRS)
+#define AB_OSS_USER_ID_INTERNING_ENABLED 1
+#else
+#define AB_OSS_USER_ID_INTERNING_ENABLED 0
+#endif
+#endif
+
+/**
+ * Interning table for AccelByte user IDs, owned by the subsystem.
+ * 
+ * Session and party updates from the backend hand us the same members over and over again. Rather than creating a new
+ * FUniqueNetIdAccelByteUser for every member on every update, these updates should go through this registry, which
+ * will hand back the ID instance that is already in use for the same AccelByte ID and platform pair.
+ * 
+ * The registry only holds weak references to the IDs that it hands out, so an ID will be freed as soon as nothing else
+ * is referencing it. Entries for freed IDs are swept out of the registry as new IDs are added, so the cost of cleanup
+ * is amortized across insertions rather than requiring a tick.
+ * 
+ * Lookups and insertions are thread safe. Interning is compiled out when AB_OSS_USER_ID_INTERNING_ENABLED is off, in
+ * which case every call creates a new ID, the same as calling FUniqueNetIdAccelByteUser::Create directly.
+ */
+class ONLINESUBSYSTEMACCELBYTE_API FOnlineUserIdRegistryAccelByte
+{
+public:
+	/**
+	 * Get an existing ID for the composite passed in, or create and register a new ID if we have none in use.
+	 * 
+	 * @param CompositeId Composite structure for the ID that we want
+	 * @return Shared reference to the interned ID, or an invalid ID if the composite has no AccelByte ID
+	 */
+	FUniqueNetIdAccelByteUserRef FindOrCreate(const FAccelByteUniqueIdComposite& CompositeId);
+
+	/**
+	 * Get an existing ID for the AccelByte ID and platform pair passed in, or create and register a new ID if we have
+	 * none in use. Does not allocate if an ID is already registered for these values.
+	 * 
+	 * @param AccelByteId AccelByte ID of the user
+	 * @param PlatformType Type of platform that the platform ID belongs to, can be blank
+	 * @param PlatformId ID of the user on the platform type specified, can be blank
+	 * @return Shared reference to the interned ID, or an invalid ID if the AccelByte ID is blank
+	 */
+	FUniqueNetIdAccelByteUserRef FindOrCreate(const FString& AccelByteId, const FString& PlatformType = TEXT(""), const FString& PlatformId = TEXT(""));
+
+	/**
+	 * Get the number of entries in the registry, including entries for IDs that have been freed but not yet swept.
+	 * Always zero when interning is compiled out.
+	 */
+	int32 Num() const;
+
+PACKAGE_SCOPE:
+	FOnlineUserIdRegistryAccelByte() = default;
+
+	/**
+	 * Remove every entry from the registry whose ID has been freed. Returns the number of entries removed.
+	 */
+	int32 RemoveStaleEntries();
+
+private:
+#if AB_OSS_USER_ID_INTERNING_ENABLED
+	/**
+	 * Single platform variant of an interned ID. Platform strings are stored alongside the weak reference so that
+	 * matching an entry never requires pinning or copying out of the ID itself.
+	 */
+	struct FEntry
+	{
+		FString PlatformType;
+		FString PlatformId;
+		TWeakPtr<const FUniqueNetIdAccelByteUser, ESPMode::ThreadSafe> Id;
+	};
+
+	/**
+	 * Minimum number of insertions between sweeps of stale entries, keeps sweeps from running constantly on small registries
+	 */
+	static constexpr int32 MinInsertionsBetweenSweeps = 64;
+
+	/**
+	 * Lock guarding the entry map, lookups take a read lock and only insertions take a write lock
+	 */
+	mutable FRWLock RegistryLock;
+
+	/**
+	 * Map of AccelByte IDs to every platform variant of that ID that we have handed out. Almost every user will only
+	 * have a single variant, so these are stored inline.
+	 */
+	TMap<FString, TArray<FEntry, TInlineAllocator<1>>> EntryMap;
+
+	/**
+	 * Number of insertions since we last swept stale entries from the map
+	 */
+	int32 InsertionsSinceLastSweep = 0;
+
+	/**
+	 * Find a live ID for the values passed in, must be called with the registry lock held
+	 */
+	FUniqueNetIdAccelByteUserPtr FindLocked(const FString& AccelByteId, const FString& PlatformType, const FString& PlatformId) const;
+
+	/**
+	 * Remove every entry whose ID has been freed, must be called with the registry write lock held
+	 */
+	int32 RemoveStaleEntriesLocked();
+#endif
+
+};